@@ -0,0 +1,384 @@
+#!/usr/bin/env python3
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# Portions are copyright of other developers:
+# See the file CONTRIBUTORS.TXT in the top level directory
+# of the distribution for more information.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+"""Host performance benchmarks for the SST element library.
+
+Runs the configurations listed in a suite file (benchmarks/suite.json by
+default) and records, for every benchmark and scale, the wall clock time,
+peak resident set size, simulated time and simulated/wall time ratio.
+Events per second is not measured because sst --print-timing-info does not
+report an event count; the results file lists it under
+"unavailable_metrics" instead of recording nulls. Results are written as
+JSON and can be compared against a stored baseline, in which case the exit
+status is non-zero if anything failed or regressed past the configured
+thresholds.
+"""
+
+import argparse
+import datetime
+import json
+import os
+import platform
+import re
+import shlex
+import shutil
+import signal
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+RESULTS_VERSION = 1
+
+TIME_UNITS = {
+    "fs": 1e-15,
+    "ps": 1e-12,
+    "ns": 1e-9,
+    "us": 1e-6,
+    "ms": 1e-3,
+    "s": 1.0,
+}
+
+SIM_TIME_RE = re.compile(r"simulated time:\s*([0-9.eE+-]+)\s*([a-z]*s)\b", re.IGNORECASE)
+RUN_LOOP_RE = re.compile(r"run loop time:\s*([0-9.eE+-]+)\s*seconds", re.IGNORECASE)
+
+# Metrics the core's output does not let us compute, recorded in the report with the reason
+UNAVAILABLE_METRICS = {
+    "events_per_s": "sst --print-timing-info reports times and memory use but no event count",
+}
+
+
+def parse_sst_output(text):
+    """Pull simulated time and run loop time out of sst's output"""
+    info = {"sim_time_s": None, "run_loop_s": None}
+
+    # The last match wins, the completion message and timing info both report simulated time
+    for match in SIM_TIME_RE.finditer(text):
+        unit = match.group(2).lower()
+        if unit in TIME_UNITS:
+            info["sim_time_s"] = float(match.group(1)) * TIME_UNITS[unit]
+
+    match = RUN_LOOP_RE.search(text)
+    if match:
+        info["run_loop_s"] = float(match.group(1))
+
+    return info
+
+
+def wait_with_timeout(proc, timeout):
+    """Wait for proc and return (status, rusage, timed_out) with the child's own rusage"""
+    deadline = time.monotonic() + timeout if timeout else None
+    while True:
+        pid, status, rusage = os.wait4(proc.pid, os.WNOHANG)
+        if pid != 0:
+            proc.returncode = os.waitstatus_to_exitcode(status) if hasattr(os, "waitstatus_to_exitcode") else status
+            return status, rusage, False
+        if deadline is not None and time.monotonic() > deadline:
+            os.killpg(proc.pid, signal.SIGKILL)
+            pid, status, rusage = os.wait4(proc.pid, 0)
+            proc.returncode = -signal.SIGKILL
+            return status, rusage, True
+        time.sleep(0.05)
+
+
+def peak_rss_kb(rusage):
+    # ru_maxrss is in bytes on macOS and kilobytes elsewhere
+    if sys.platform == "darwin":
+        return rusage.ru_maxrss // 1024
+    return rusage.ru_maxrss
+
+
+def run_once(args, bench, scale_name, scale, elements_dir, workdir):
+    config = os.path.join(elements_dir, scale["config"])
+    config_dir = os.path.dirname(config)
+
+    if bench.get("copy_dir", False):
+        rundir = os.path.join(workdir, "run")
+        shutil.copytree(config_dir, rundir, ignore=shutil.ignore_patterns("refFiles"))
+        config = os.path.join(rundir, os.path.basename(config))
+        config_dir = rundir
+    else:
+        rundir = workdir
+
+    cmd = [args.sst, "--print-timing-info"]
+    if args.num_ranks > 1:
+        cmd = ["mpirun", "-np", str(args.num_ranks)] + cmd
+    if args.num_threads > 1:
+        cmd.append("--num-threads={0}".format(args.num_threads))
+    cmd += shlex.split(scale.get("sst_args", ""))
+    if scale.get("model_options"):
+        cmd += ["--model-options", scale["model_options"]]
+    cmd.append(config)
+
+    env = dict(os.environ)
+    env["PYTHONPATH"] = os.pathsep.join([config_dir] + ([env["PYTHONPATH"]] if env.get("PYTHONPATH") else []))
+
+    outpath = os.path.join(workdir, "sst.out")
+    timeout = scale.get("timeout", bench.get("timeout", args.timeout))
+
+    with open(outpath, "w") as out:
+        start = time.monotonic()
+        proc = subprocess.Popen(cmd, cwd=rundir, env=env, stdout=out, stderr=subprocess.STDOUT,
+                                start_new_session=True)
+        status, rusage, timed_out = wait_with_timeout(proc, timeout)
+        wall = time.monotonic() - start
+
+    with open(outpath, "r", errors="replace") as out:
+        text = out.read()
+
+    result = parse_sst_output(text)
+    result["wall_time_s"] = wall
+    result["peak_rss_kb"] = peak_rss_kb(rusage)
+    result["command"] = " ".join(shlex.quote(c) for c in cmd)
+
+    if timed_out:
+        result["status"] = "timeout"
+    elif proc.returncode != 0:
+        result["status"] = "failed"
+    else:
+        result["status"] = "ok"
+
+    if result["status"] != "ok":
+        result["output_tail"] = text[-2000:]
+
+    return result
+
+
+def run_benchmark(args, bench, scale_name, scale, elements_dir):
+    runs = []
+    for i in range(args.repeat):
+        workdir = tempfile.mkdtemp(prefix="sst-bench-")
+        try:
+            run = run_once(args, bench, scale_name, scale, elements_dir, workdir)
+        finally:
+            if args.keep_output:
+                print("    output kept in {0}".format(workdir))
+            else:
+                shutil.rmtree(workdir, ignore_errors=True)
+        runs.append(run)
+        if run["status"] != "ok":
+            break
+
+    result = {
+        "name": bench["name"],
+        "scale": scale_name,
+        "config": scale["config"],
+        "model_options": scale.get("model_options", ""),
+        "command": runs[-1]["command"],
+        "repeats": len(runs),
+        "status": runs[-1]["status"],
+    }
+
+    if result["status"] != "ok":
+        result["output_tail"] = runs[-1].get("output_tail", "")
+        return result
+
+    # Use the median run for times and the largest footprint for memory
+    walls = [r["wall_time_s"] for r in runs]
+    result["wall_time_s"] = statistics.median(walls)
+    result["wall_time_min_s"] = min(walls)
+    result["peak_rss_kb"] = max(r["peak_rss_kb"] for r in runs)
+    result["sim_time_s"] = runs[-1]["sim_time_s"]
+    result["run_loop_s"] = runs[-1]["run_loop_s"]
+
+    wall = result["wall_time_s"]
+    result["sim_wall_ratio"] = result["sim_time_s"] / wall if result["sim_time_s"] is not None and wall > 0 else None
+    return result
+
+
+def sst_version(sst):
+    try:
+        out = subprocess.run([sst, "--version"], stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                             universal_newlines=True, timeout=60).stdout
+        return out.strip().splitlines()[0] if out.strip() else None
+    except (OSError, subprocess.SubprocessError):
+        return None
+
+
+def git_revision(path):
+    try:
+        out = subprocess.run(["git", "-C", path, "rev-parse", "HEAD"], stdout=subprocess.PIPE,
+                             stderr=subprocess.DEVNULL, universal_newlines=True, timeout=60)
+        return out.stdout.strip() or None
+    except (OSError, subprocess.SubprocessError):
+        return None
+
+
+def compare(results, baseline, suite, args):
+    """Compare against a baseline results file, returns the number of regressions"""
+    base = {(r["name"], r["scale"]): r for r in baseline.get("results", [])}
+    defaults = suite.get("thresholds", {})
+    overrides = {}
+    if args.wall_threshold is not None:
+        overrides["wall_time"] = args.wall_threshold
+    if args.rss_threshold is not None:
+        overrides["peak_rss"] = args.rss_threshold
+    per_bench = {b["name"]: b.get("thresholds", {}) for b in suite["benchmarks"]}
+
+    regressions = 0
+    print("\n{0:<28} {1:<8} {2:>12} {3:>12} {4:>8}   {5:>10} {6:>10} {7:>8}".format(
+        "benchmark", "scale", "wall (s)", "baseline", "change", "RSS (MB)", "baseline", "change"))
+
+    for r in results:
+        b = base.get((r["name"], r["scale"]))
+        if b is None or r["status"] != "ok" or b.get("status") != "ok":
+            print("{0:<28} {1:<8} {2}".format(r["name"], r["scale"],
+                  "no baseline" if b is None else "not compared ({0})".format(r["status"])))
+            continue
+
+        # Suite defaults, then the benchmark's own values, then only the keys given on the command line
+        thresholds = dict(defaults)
+        thresholds.update(per_bench.get(r["name"], {}))
+        thresholds.update(overrides)
+
+        wall_change = 100.0 * (r["wall_time_s"] - b["wall_time_s"]) / b["wall_time_s"] if b["wall_time_s"] > 0 else 0.0
+        rss_change = 100.0 * (r["peak_rss_kb"] - b["peak_rss_kb"]) / b["peak_rss_kb"] if b["peak_rss_kb"] > 0 else 0.0
+
+        flags = []
+        if "wall_time" in thresholds and wall_change > thresholds["wall_time"]:
+            flags.append("wall time")
+        if "peak_rss" in thresholds and rss_change > thresholds["peak_rss"]:
+            flags.append("peak RSS")
+        if b.get("sim_time_s") is not None and r["sim_time_s"] is not None and \
+                abs(r["sim_time_s"] - b["sim_time_s"]) > 1e-6 * max(abs(b["sim_time_s"]), 1e-15):
+            # Not a performance regression but the numbers are no longer comparable
+            flags.append("simulated time changed")
+
+        r["baseline_wall_time_s"] = b["wall_time_s"]
+        r["baseline_peak_rss_kb"] = b["peak_rss_kb"]
+        r["regressions"] = flags
+        if flags:
+            regressions += 1
+
+        print("{0:<28} {1:<8} {2:>12.3f} {3:>12.3f} {4:>+7.1f}%   {5:>10.1f} {6:>10.1f} {7:>+7.1f}%{8}".format(
+            r["name"], r["scale"], r["wall_time_s"], b["wall_time_s"], wall_change,
+            r["peak_rss_kb"] / 1024.0, b["peak_rss_kb"] / 1024.0, rss_change,
+            "  REGRESSION: " + ", ".join(flags) if flags else ""))
+
+    return regressions
+
+
+def main():
+    srcdir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+    parser = argparse.ArgumentParser(description="Run the SST element host performance benchmarks.")
+    parser.add_argument("--suite", default=os.path.join(srcdir, "benchmarks", "suite.json"),
+                        help="Suite file listing the benchmarks (default: %(default)s)")
+    parser.add_argument("--elements-dir", default=os.path.join(srcdir, "src", "sst", "elements"),
+                        help="Directory the suite's config paths are relative to (default: %(default)s)")
+    parser.add_argument("--sst", default=shutil.which("sst") or "sst", help="sst executable (default: %(default)s)")
+    parser.add_argument("--output", default="benchmark-results.json", help="Results file to write (default: %(default)s)")
+    parser.add_argument("--baseline", help="Results file from an earlier run to compare against")
+    parser.add_argument("--update-baseline", action="store_true", help="Also write the results to the --baseline file")
+    parser.add_argument("--wall-threshold", type=float,
+                        help="Allowed wall time increase over the baseline in percent, overrides the suite")
+    parser.add_argument("--rss-threshold", type=float,
+                        help="Allowed peak RSS increase over the baseline in percent, overrides the suite")
+    parser.add_argument("--filter", help="Only run benchmarks whose name matches this regular expression")
+    parser.add_argument("--scales", help="Comma separated list of scales to run (default: all)")
+    parser.add_argument("--repeat", type=int, default=1, help="Runs per benchmark, the median wall time is reported")
+    parser.add_argument("--timeout", type=int, default=1800, help="Default per-run timeout in seconds")
+    parser.add_argument("--num-ranks", type=int, default=1, help="MPI ranks per run")
+    parser.add_argument("--num-threads", type=int, default=1, help="Threads per rank")
+    parser.add_argument("--keep-output", action="store_true", help="Keep each run's working directory")
+    parser.add_argument("--list", action="store_true", help="List the benchmarks and exit")
+    args = parser.parse_args()
+
+    if args.repeat < 1:
+        parser.error("--repeat must be at least 1")
+    if args.update_baseline and not args.baseline:
+        parser.error("--update-baseline needs --baseline")
+
+    with open(args.suite) as f:
+        suite = json.load(f)
+
+    scales = set(args.scales.split(",")) if args.scales else None
+    selected = []
+    for bench in suite["benchmarks"]:
+        if args.filter and not re.search(args.filter, bench["name"]):
+            continue
+        for scale_name, scale in bench["scales"].items():
+            if scales is None or scale_name in scales:
+                selected.append((bench, scale_name, scale))
+
+    if args.list:
+        for bench, scale_name, scale in selected:
+            print("{0:<28} {1:<8} {2} {3}".format(bench["name"], scale_name, scale["config"], scale.get("model_options", "")))
+        return 0
+
+    if not selected:
+        print("No benchmarks selected")
+        return 1
+
+    baseline = None
+    if args.baseline and os.path.exists(args.baseline):
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+    elif args.baseline and not args.update_baseline:
+        print("Baseline {0} does not exist".format(args.baseline))
+        return 1
+
+    for metric, reason in UNAVAILABLE_METRICS.items():
+        print("Warning: {0} is not measured, {1}".format(metric, reason))
+
+    results = []
+    for bench, scale_name, scale in selected:
+        print("Running {0} ({1})...".format(bench["name"], scale_name))
+        sys.stdout.flush()
+        r = run_benchmark(args, bench, scale_name, scale, args.elements_dir)
+        results.append(r)
+        if r["status"] == "ok":
+            print("    wall {0:.3f} s, peak RSS {1:.1f} MB{2}".format(
+                r["wall_time_s"], r["peak_rss_kb"] / 1024.0,
+                ", sim/wall {0:.3e}".format(r["sim_wall_ratio"]) if r["sim_wall_ratio"] is not None else ""))
+        else:
+            print("    {0}".format(r["status"].upper()))
+
+    failures = sum(1 for r in results if r["status"] != "ok")
+    regressions = compare(results, baseline, suite, args) if baseline is not None else 0
+
+    report = {
+        "version": RESULTS_VERSION,
+        "date": datetime.datetime.now().isoformat(timespec="seconds"),
+        "host": platform.node(),
+        "platform": platform.platform(),
+        "cpu_count": os.cpu_count(),
+        "sst": sst_version(args.sst),
+        "revision": git_revision(srcdir),
+        "num_ranks": args.num_ranks,
+        "num_threads": args.num_threads,
+        "repeat": args.repeat,
+        "unavailable_metrics": UNAVAILABLE_METRICS,
+        "results": results,
+    }
+
+    with open(args.output, "w") as f:
+        json.dump(report, f, indent=2)
+    print("\nResults written to {0}".format(args.output))
+
+    if args.update_baseline:
+        with open(args.baseline, "w") as f:
+            json.dump(report, f, indent=2)
+        print("Baseline {0} updated".format(args.baseline))
+
+    print("{0} benchmarks, {1} failed, {2} regressed".format(len(results), failures, regressions))
+    return 1 if failures or regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
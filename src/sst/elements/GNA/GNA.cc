@@ -109,6 +109,8 @@ void GNA::init(unsigned int phase)
     ifstream ifs (modelPath.c_str());
     if (! ifs.good()) cerr << "Failed to open file: " << modelPath << endl;
     int countLinks = 0;
+    struct LIFParams {float Vinit, Vthreshold, Vreset, leak, p;};
+    map<int,LIFParams> lifParams;  // LIF state is added to lif by index once all neurons are read
     string line;
     while (ifs.good()) {
         getline(ifs, line);
@@ -130,7 +132,8 @@ void GNA::init(unsigned int phase)
             float leak = 1 - atof(piece);  // The parameter in the file is the portion of voltage to get rid of each cycle. It's simpler for us to compute with (1-decay).
             piece = strtok(0, ",");  // Actually, there should only be one piece left, with no more commas.
             float p = atof(piece);
-            n = neurons[id] = new NeuronLIF(Vinit, Vthreshold, Vreset, leak, p);
+            n = neurons[id] = new NeuronLIF(&lif, 0);
+            lifParams[id] = {Vinit, Vthreshold, Vreset, leak, p};
         } else {
             n = neurons[id] = new NeuronInput();
         }
@@ -210,12 +213,26 @@ void GNA::init(unsigned int phase)
         }
     }
 
+    for (auto & i : lifParams) {
+        const LIFParams & lp = i.second;
+        ((NeuronLIF *) neurons[i.first])->slot = lif.add(i.first, lp.Vinit, lp.Vthreshold, lp.Vreset, lp.leak, lp.p);
+    }
+    for (uint32_t id = 0; id < neurons.size(); id++) {
+        Neuron * n = neurons[id];
+        if (! n) continue;
+        NeuronLIF * lifN = dynamic_cast<NeuronLIF *>(n);
+        if (! lifN) inputIDs.push_back(id);
+        if (n->traces) traced.push_back({id, lifN ? &lif.V[lifN->slot] : nullptr});
+    }
+    firedFlag.resize(neurons.size(), 0);
+
     // Synapses
     // This requires a second pass, now that we know the memory size for each neuron.
     ifs.close ();
     ifs.open (modelPath.c_str());
     assert(sizeof(Synapse) == 8);
     uint64_t startAddr = 0x10000;
+    uint maxDelay = 0;
     while (ifs.good()) {
         getline(ifs, line);
         if (line.empty()) break;
@@ -258,8 +275,10 @@ void GNA::init(unsigned int phase)
             synapse->weight = weight;
             synapse->delay  = delay;
             memory->sendUntimedData(req);
+            if (synapse->delay > maxDelay) maxDelay = synapse->delay;
         }
     }
+    lif.initDelayLine(maxDelay);
 
     int numNeurons = neurons.size();
     printf("Constructed %d neurons with %d links\n", numNeurons, countLinks);
@@ -325,6 +344,30 @@ void GNA::processFire()
     if (allSpikesDelivered & firedNeurons.empty()) state = LIF;
 }
 
+void GNA::updateNeurons()
+{
+    firedLIF.clear();
+    lif.update(now, firedLIF);
+    firedInput.clear();
+    for (auto id : inputIDs) if (((NeuronInput *) neurons[id])->update(now)) firedInput.push_back(id);
+
+    // Merge the two lists, so spikes are dispatched in neuron index order.
+    auto f = firedLIF.begin();
+    for (auto id : firedInput) {
+        for (; f != firedLIF.end()  &&  lif.id[*f] < id; ++f) firedNeurons.push_back(neurons[lif.id[*f]]);
+        firedNeurons.push_back(neurons[id]);
+    }
+    for (; f != firedLIF.end(); ++f) firedNeurons.push_back(neurons[lif.id[*f]]);
+
+    // Outputs
+    if (traced.empty()) return;
+    for (auto s  : firedLIF)   firedFlag[lif.id[s]] = 1;
+    for (auto id : firedInput) firedFlag[id]        = 1;
+    for (auto & t : traced) neurons[t.id]->writeTraces(now, firedFlag[t.id], t.V);
+    for (auto s  : firedLIF)   firedFlag[lif.id[s]] = 0;
+    for (auto id : firedInput) firedFlag[id]        = 0;
+}
+
 bool GNA::clockTic(Cycle_t)
 {
     // send some outgoing mem reqs
@@ -341,7 +384,7 @@ bool GNA::clockTic(Cycle_t)
         processFire();
         break;
     case LIF:
-        for (auto n : neurons) if (n->update(now)) firedNeurons.push_back(n);
+        updateNeurons();
         now++;
         if (now >= steps) primaryComponentOKToEndSim();
         state = PROCESS_FIRE;
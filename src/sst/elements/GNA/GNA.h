@@ -78,6 +78,7 @@ public:
     void readMem(Interfaces::StandardMem::Request *req, STS *requestor);
     void assignSTS();
     void processFire();
+    void updateNeurons();
     virtual bool clockTic(SST::Cycle_t);
 
     typedef enum {IDLE, PROCESS_FIRE, LIF, LAST_STATE} gnaState_t;
@@ -99,6 +100,19 @@ public:
     std::vector<Neuron *> neurons;
     std::vector<STS> STSUnits;
 
+    // Neuron state for the LIF step. Input neurons and neurons with traces
+    // are listed in index order so a step can skip everything else.
+    LIFPopulation            lif;
+    std::vector<uint32_t>    inputIDs;
+    struct Traced {
+        uint32_t      id;
+        const float * V;  // null for input neurons
+    };
+    std::vector<Traced>      traced;
+    std::vector<uint32_t>    firedLIF;    // scratch: slots in lif which fired this step
+    std::vector<uint32_t>    firedInput;  // scratch: input neurons which fired this step
+    std::vector<uint8_t>     firedFlag;   // scratch: by neuron index, for traces
+
     std::deque<Neuron *> firedNeurons;
     std::map<uint64_t, STS*> requests;
 
@@ -61,57 +61,117 @@ void Neuron::deliverSpike(float str, uint when)
     // Do nothing
 }
 
+void Neuron::writeTraces(const uint now, bool spiked, const float * V) const
+{
+    Trace * t = traces;
+    while (t) {
+        if (t->probe == 0) {
+            if (spiked) t->holder->trace (now*dt, t->column, 1, t->mode);
+        } else if (t->probe == 1  &&  V) {
+            t->holder->trace(now*dt, t->column, *V, t->mode);
+        }
+        t = t->next;
+    }
+}
+
 
-// NeuronLIF -----------------------------------------------------------------
+// class LIFPopulation -------------------------------------------------------
 
-SST::RNG::MarsagliaRNG NeuronLIF::rng(1,13);
+SST::RNG::MarsagliaRNG LIFPopulation::rng(1,13);
 
-NeuronLIF::NeuronLIF(float Vinit, float Vthreshold, float Vreset, float leak, float p)
-:   V          (Vinit),
-    Vthreshold (Vthreshold),
-    Vreset     (Vreset),
-    leak       (leak),
-    p          (p)
+LIFPopulation::LIFPopulation()
 {
+    delaySlots = 0;
+    delayMask  = 0;
+    nextStep   = 0;
 }
 
-void NeuronLIF::deliverSpike(float str, uint when)
+uint32_t LIFPopulation::add(uint32_t id, float Vinit, float Vthreshold, float Vreset, float leak, float p)
 {
-    temporalBuffer[when] += str;
+    this->id        .push_back(id);
+    this->V         .push_back(Vinit);
+    this->Vthreshold.push_back(Vthreshold);
+    this->Vreset    .push_back(Vreset);
+    this->leak      .push_back(leak);
+    this->p         .push_back(p);
+    over.push_back(0);
+    return this->id.size() - 1;
 }
 
-bool NeuronLIF::update(const uint now)
+void LIFPopulation::initDelayLine(uint maxDelay)
 {
-    // Add inputs
-    temporalBuffer_t::iterator i = temporalBuffer.find(now);
-    if (i != temporalBuffer.end()) {
-        V += i->second;
-        temporalBuffer.erase(i);
-    }
+    // Every delay up to 15 steps goes straight into the ring. Longer ones
+    // are rare enough that the far map is cheaper than a ring that deep.
+    if (maxDelay > 15) maxDelay = 15;
+    delaySlots = 1;
+    while (delaySlots <= maxDelay) delaySlots <<= 1;
+    delayMask = delaySlots - 1;
+    delayLine.assign((size_t) delaySlots * size(), 0);
+}
 
-    // Check for spike
-    bool spiked = false;
-    if (V > Vthreshold) {
-        if (p >= 1  ||  p > 0  &&  rng.nextUniform() <= p) {
-            V = Vreset;
-            spiked = true;
-        }
+void LIFPopulation::deliverSpike(uint32_t slot, float str, uint when)
+{
+    if (when < nextStep) return;  // The step is already past, so the input could never be used.
+    if (when - nextStep < delaySlots) {
+        delayLine[(size_t) (when & delayMask) * size() + slot] += str;
     } else {
-        V *= leak;
+        farInputs[when].push_back(make_pair(slot, str));
     }
+}
 
-    // Outputs
-    Trace * t = traces;
-    while (t) {
-        if (t->probe == 0) {
-            if (spiked) t->holder->trace (now*dt, t->column, 1, t->mode);
-        } else if (t->probe == 1) {
-            t->holder->trace(now*dt, t->column, V, t->mode);
+void LIFPopulation::update(const uint now, std::vector<uint32_t> & fired)
+{
+    const uint32_t count = size();
+    float       * __restrict__ in         = delayLine.data() + (size_t) (now & delayMask) * count;
+    float       * __restrict__ v          = V.data();
+    const float * __restrict__ threshold  = Vthreshold.data();
+    const float * __restrict__ retain     = leak.data();
+    uint8_t     * __restrict__ overThresh = over.data();
+
+    // Add inputs and leak. Neurons over threshold keep their V for now;
+    // whether they actually fire depends on p, checked below.
+    // No branches or calls, so the compiler vectorizes this loop.
+    for (uint32_t i = 0; i < count; i++) {
+        float x = v[i] + in[i];
+        in[i] = 0;
+        bool o = x > threshold[i];
+        overThresh[i] = o;
+        v[i] = o ? x : x * retain[i];
+    }
+
+    // Check for spike, in slot order so RNG draws happen in neuron order.
+    for (uint32_t i = 0; i < count; i++) {
+        if (! overThresh[i]) continue;
+        float pi = p[i];
+        if (pi >= 1  ||  pi > 0  &&  rng.nextUniform() <= pi) {
+            v[i] = Vreset[i];
+            fired.push_back(i);
         }
-        t = t->next;
     }
 
-    return spiked;
+    // The step after the last ring entry is now within range.
+    nextStep = now + 1;
+    while (! farInputs.empty()) {
+        farInputs_t::iterator f = farInputs.begin();
+        if (f->first - nextStep >= delaySlots) break;
+        float * row = &delayLine[(size_t) (f->first & delayMask) * count];
+        for (auto & e : f->second) row[e.first] += e.second;
+        farInputs.erase(f);
+    }
+}
+
+
+// class NeuronLIF -----------------------------------------------------------
+
+NeuronLIF::NeuronLIF(LIFPopulation * population, uint32_t slot)
+:   population (population),
+    slot       (slot)
+{
+}
+
+void NeuronLIF::deliverSpike(float str, uint when)
+{
+    population->deliverSpike(slot, str, when);
 }
 
 
@@ -127,14 +187,6 @@ bool NeuronInput::update(const uint now)
     if (nextSpike >= spikes.size()) return false;
     if (spikes[nextSpike] > now)    return false;
     nextSpike++;
-
-    // Outputs
-    Trace * t = traces;
-    while (t) {
-        if (t->probe == 0) t->holder->trace(now*dt, t->column, 1, t->mode);
-        t = t->next;
-    }
-
     return true;
 }
 
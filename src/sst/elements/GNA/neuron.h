@@ -17,6 +17,7 @@
 #define _NEURON_H
 
 #include <map>
+#include <vector>
 #include <cstdint>
 
 #include <sst/core/interfaces/stdMem.h>  // supplies type uint
@@ -58,27 +59,63 @@ public:
     virtual ~Neuron();
 
     virtual void deliverSpike(float str, uint when);
-    virtual bool update      (const uint now) = 0;  ///< performs Leaky Integrate and Fire. Returns true if fired.
+
+    void writeTraces(const uint now, bool spiked, const float * V) const;  ///< V is null for neurons without a voltage, which skips probe 1
 };
 
-class NeuronLIF : public Neuron {
+/// State of all the LIF neurons, one array per field so the update for a
+/// whole step is a single pass over contiguous memory.
+/// Slots are assigned in neuron index order, so a step visits (and draws
+/// from the RNG for) neurons in the same order as a walk over GNA::neurons.
+class LIFPopulation {
 public:
-    float V;          // "voltage"; generally in the normal range [0,1]
-    float Vthreshold; // value of V which triggers a spike
-    float Vreset;     // value of V immediately after a spike
-    float leak;       // fraction of V to retain after present cycle, in [0,1]
-    float p;          // probability of firing when over threshold, in [0,1]
+    std::vector<uint32_t> id;         // neuron index
+    std::vector<float>    V;          // "voltage"; generally in the normal range [0,1]
+    std::vector<float>    Vthreshold; // value of V which triggers a spike
+    std::vector<float>    Vreset;     // value of V immediately after a spike
+    std::vector<float>    leak;       // fraction of V to retain after present cycle, in [0,1]
+    std::vector<float>    p;          // probability of firing when over threshold, in [0,1]
+    std::vector<uint8_t>  over;       // scratch: V was over threshold in the present step
 
     static SST::RNG::MarsagliaRNG rng;
 
-    // temporal buffer
-    typedef std::map<const uint, float> temporalBuffer_t;
-    temporalBuffer_t temporalBuffer;
+    LIFPopulation();
+
+    uint32_t add(uint32_t id, float Vinit, float Vthreshold, float Vreset, float leak, float p);
+    uint32_t size() const {return id.size();}
+
+    /// Sizes the delay line. Must be called once all neurons are added and
+    /// before any spike is delivered.
+    void initDelayLine(uint maxDelay);
+
+    void deliverSpike(uint32_t slot, float str, uint when);
+
+    /// Performs Leaky Integrate and Fire on every neuron for step now, which
+    /// must be one past the previous step. Appends the slots which fired, in
+    /// ascending order.
+    void update(const uint now, std::vector<uint32_t> & fired);
+
+protected:
+    // Delay line: input arriving at step t for slot s is summed in
+    // delayLine[(t & delayMask) * size() + s]. Inputs that are more than
+    // delaySlots steps ahead wait in farInputs, in delivery order, until
+    // they come within range.
+    std::vector<float> delayLine;
+    uint               delaySlots;
+    uint               delayMask;
+    uint               nextStep;  // step which the next update() consumes
+    typedef std::map<uint, std::vector<std::pair<uint32_t,float> > > farInputs_t;
+    farInputs_t        farInputs;
+};
+
+class NeuronLIF : public Neuron {
+public:
+    LIFPopulation * population;
+    uint32_t        slot;  // index of this neuron's state in population
 
-    NeuronLIF (float Vinit = 0, float Vthreshold = 1, float Vreset = 0, float leak = 1, float p = 1);
+    NeuronLIF (LIFPopulation * population, uint32_t slot);
 
     virtual void deliverSpike(float str, uint when);
-    virtual bool update      (const uint now);
 };
 
 class NeuronInput : public Neuron {
@@ -88,7 +125,7 @@ public:
 
     NeuronInput();
 
-    virtual bool update(const uint now);
+    bool update(const uint now);  ///< Returns true if fired. Does not write traces.
 };
 }
 }
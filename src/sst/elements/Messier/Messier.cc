@@ -149,6 +149,13 @@ void Messier::parser(NVM_PARAMS * nvm, SST::Params& params)
 
 	nvm->lock_period = (uint32_t) params.find<uint32_t>("lock_period", 10000) ;
 
+	int declock = (uint32_t) params.find<uint32_t>("declock", 0) ;
+
+	if(declock)
+		nvm->declock = true;
+	else
+		nvm->declock = false;
+
 }
 
 // Here we do the initialization of the Samba units of the system, connecting them to the cores and instantiating TLB hierachy objects for each one
@@ -195,7 +202,11 @@ Messier::Messier(SST::ComponentId_t id, SST::Params& params): Component(id) {
         event_link->setDefaultTimeBase(tc);
 
 
-	registerClock( cpu_clock, new Clock::Handler<Messier>(this, &Messier::tick ) );
+	Clock::HandlerBase * clock_handler = new Clock::Handler<Messier>(this, &Messier::tick );
+
+	registerClock( cpu_clock, clock_handler );
+
+	DIMM->setClock(tc, clock_handler);
 
 }
 
@@ -214,7 +225,5 @@ bool Messier::tick(SST::Cycle_t x)
 
 	// We tick the MMU hierarchy of each core
 //	for(uint32_t i = 0; i < core_count; ++i)
-	DIMM->tick();
-
-	return false;
+	return DIMM->tick();
 }
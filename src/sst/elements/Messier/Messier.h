@@ -98,7 +98,8 @@ namespace SST {
                     {"write_cancel", "This indicates that the write cancellation optimization: 0 means not enabled", "0"},
                     {"write_cancel_th", "This indicates that the write cancellation threshold: 0 means dynamic", "0"},
                     {"group_size", "This indicates the number of banks in each group, to be locked when draining", "0"},
-                    {"lock_period", "This indicates the period of locking a group in cycles", "10000"}
+                    {"lock_period", "This indicates the period of locking a group in cycles", "10000"},
+                    {"declock", "Turn the controller clock off while no requests are pending: 0 means not enabled", "0"}
                 )
 
                 SST_ELI_DOCUMENT_STATISTICS(
@@ -26,6 +26,7 @@
 #include <cstddef>
 #include<iostream>
 #include<list>
+#include <algorithm>
 #include "Rank.h"
 #include "WriteBuffer.h"
 #include "NVM_DIMM.h"
@@ -95,6 +96,18 @@ NVM_DIMM::NVM_DIMM(ComponentId_t id, NVM_PARAMS par) : ComponentExtension(id)
 	curr_reads = 0;
 	curr_writes = 0;
 
+	outstanding = 0;
+
+	bank_hist.resize(params->num_banks, 0);
+
+	// Reads complete tRCD + tCMD after activation, writes tCMD + tCL_W + tBURST after being issued
+	completions.init(std::max(params->tRCD + params->tCMD, params->tCMD + params->tCL_W + params->tBURST));
+
+	clock_tc = NULL;
+	clock_handler = NULL;
+	clock_on = true;
+	last_tick = 0;
+
 	gs = params->group_size;
 	lg = group_locked;
 
@@ -132,7 +145,14 @@ bool NVM_DIMM::tick()
 
 
 	if(!enabled)
+	{
+		if(params->declock)
+		{
+			clock_on = false;
+			return true;
+		}
 		return false;
+	}
 
 
 	// Incrementing the cycles count
@@ -140,17 +160,10 @@ bool NVM_DIMM::tick()
 	cycles++;
 
 
-	if(READS_COMPLETE.find(cycles)!=READS_COMPLETE.end())
-	{
-		curr_reads = curr_reads - READS_COMPLETE[cycles];
-		READS_COMPLETE.erase(cycles);
-	}
-
-	if(WRITES_COMPLETE.find(cycles)!=WRITES_COMPLETE.end())
-	{
-		curr_writes = curr_writes - WRITES_COMPLETE[cycles];
-		WRITES_COMPLETE.erase(cycles);
-	}
+	int reads_done, writes_done;
+	completions.collect(cycles, reads_done, writes_done);
+	curr_reads = curr_reads - reads_done;
+	curr_writes = curr_writes - writes_done;
 
 
 
@@ -215,6 +228,12 @@ bool NVM_DIMM::tick()
 	}
 
 
+	if(params->declock && idle())
+	{
+		clock_on = false;
+		last_tick = getCurrentSimTime(clock_tc);
+		return true;
+	}
 
 	return false;
 
@@ -222,10 +241,56 @@ bool NVM_DIMM::tick()
 }
 
 
+bool NVM_DIMM::idle()
+{
+
+	return transactions.empty() && WB->empty() && ready_at_NVM.empty() && completions.empty();
+
+}
+
+
+void NVM_DIMM::wake()
+{
+
+	if(clock_on)
+		return;
+
+	clock_on = true;
+
+	if(enabled)
+	{
+		// While idle a tick only advances the cycle count (and the modulo read count, as the write buffer is empty), so apply the ticks that were skipped. A tick due now would already have run before this event
+		SimTime_t skipped = getCurrentSimTime(clock_tc) - last_tick;
+		cycles += skipped;
+		if(params->modulo)
+			read_count += skipped;
+	}
+
+	reregisterClock(clock_tc, clock_handler);
+
+}
+
+
+void NVM_DIMM::schedule_completion(bool read, long long int delay)
+{
+
+	// Completions are only checked at the start of a tick, so one due in the current cycle is never seen
+	if(delay <= 0)
+		return;
+
+	if(read)
+		completions.add_read(cycles + delay);
+	else
+		completions.add_write(cycles + delay);
+
+}
+
+
 void NVM_DIMM::schedule_delivery()
 {
 
-	std::map<NVM_Request *, long long int>::iterator st_1, en_1;
+	// Requests are added to ready_at_NVM by events, which are handled after the tick of the same cycle, so every request here became ready in an earlier cycle
+	std::vector<NVM_Request *>::iterator st_1, en_1;
 	st_1 = ready_at_NVM.begin();
 	en_1 = ready_at_NVM.end();
 
@@ -233,38 +298,28 @@ void NVM_DIMM::schedule_delivery()
 	{
 
 		bool ready = false;
-
-		if(st_1->second <= cycles)
+		// Check if the bank and rank are free to submit the command there
+		long long int add = (*st_1)->Address;
+		if (getRank(add)->getBusyUntil() < cycles)
 		{
+			if(getBank(add)->getBusyUntil() < cycles)
+				ready = true;
+		}
 
+		if(ready) // This means that the request is ready and the data is ready to be ready by internal controller
+		{
 
-			bool ready = false;
-			// Check if the bank and rank are free to submit the command there
-			long long int add = (st_1->first)->Address;
-			if (getRank(add)->getBusyUntil() < cycles)
-			{
-				if(getBank(add)->getBusyUntil() < cycles)
-					ready = true;
-			}
-
-			if(ready) // This means that the request is ready and the data is ready to be ready by internal controller
-			{
-
-				// Occuping the rank and back for reading the ready data
-				getRank(add)->setBusyUntil(cycles + params->tCMD + params->tCL + params->tBURST);
-				(getBank(add))->setBusyUntil(cycles + params->tCMD + params->tCL + params->tBURST);
-				(getBank(add))->set_last(true);
-				ready_trans[st_1->first] = cycles + params->tCMD + params->tCL + params->tBURST;
-				(st_1->first)->meta_data = EventType::READ_COMPLETION;
-                                m_EventChan->send(params->tCMD + params->tCL + params->tBURST, new MessierEvent(st_1->first, EventType::READ_COMPLETION));
-				ready_at_NVM.erase(st_1);
-				break;
-			}
-
+			// Occuping the rank and back for reading the ready data
+			getRank(add)->setBusyUntil(cycles + params->tCMD + params->tCL + params->tBURST);
+			(getBank(add))->setBusyUntil(cycles + params->tCMD + params->tCL + params->tBURST);
+			(getBank(add))->set_last(true);
+			(*st_1)->meta_data = EventType::READ_COMPLETION;
+                        m_EventChan->send(params->tCMD + params->tCL + params->tBURST, new MessierEvent(*st_1, EventType::READ_COMPLETION));
+			ready_at_NVM.erase(st_1);
+			break;
 		}
 
-		if(!ready)
-			st_1++;
+		st_1++;
 
 	}
 
@@ -302,9 +357,10 @@ bool NVM_DIMM::try_flush_wb()
 	{
 
 
-		std::list<NVM_Request *> writes_list = WB->getList();
+		// Iterating the write buffer directly is safe, the loop returns as soon as an entry is erased
+		const std::list<NVM_Request *> & writes_list = WB->getList();
 
-		std::list<NVM_Request *>::iterator st_wl, en_wl;
+		std::list<NVM_Request *>::const_iterator st_wl, en_wl;
 
 		st_wl = writes_list.begin();
 		en_wl = writes_list.end();
@@ -349,7 +405,7 @@ bool NVM_DIMM::try_flush_wb()
 				temp_bank->set_last(false); // setting it to write
 				temp_bank->set_last_address(temp->Address);
 				curr_writes++;
-				WRITES_COMPLETE[cycles + params->tCMD + params->tCL_W + params->tBURST]++;
+				schedule_completion(false, params->tCMD + params->tCL_W + params->tBURST);
 
 				delete temp;
 
@@ -383,7 +439,6 @@ bool NVM_DIMM::find_in_wb(NVM_Request * temp)
 		{
 
 			m_memChan->send(respEvent); //(SST::Event *)NVM_EVENT_MAP[temp]);
-			TIME_STAMP.erase(temp);
 
 
 		}
@@ -451,13 +506,13 @@ bool NVM_DIMM::pop_optimal()
 
 		RANK * corresp_rank = getRank(temp->Address);
 		BANK * corresp_bank = getBank(temp->Address);
-		if ((!params->adaptive_writes || group_locked!=(WhichBank(temp->Address)/params->group_size)) &&  (HOLD.find(temp->req_ID)==HOLD.end()) && temp->Read && (corresp_rank->getBusyUntil() < cycles) && (corresp_bank->getBusyUntil() < cycles) && !corresp_bank->getLocked() && (outstanding.size() < params->max_outstanding))
+		if ((!params->adaptive_writes || group_locked!=(WhichBank(temp->Address)/params->group_size)) &&  (HOLD.find(temp->req_ID)==HOLD.end()) && temp->Read && (corresp_rank->getBusyUntil() < cycles) && (corresp_bank->getBusyUntil() < cycles) && !corresp_bank->getLocked() && (outstanding < params->max_outstanding))
 		{
 
 			if ( row_buffer_hit(temp->Address, corresp_bank->getRB()))
 			{
 				time_ready = cycles + 1;
-				outstanding.push_back(temp);
+				outstanding++;
 				transactions.erase(st);
 				// Lock the bank so no other request comes in and try to activate another row while waiting for the activation
 
@@ -572,7 +627,7 @@ bool NVM_DIMM::submit_request_opt()
 					BANK * corresp_bank = getBank(temp->Address);
 
 					// Check if the rank is not busy
-					if ((!params->adaptive_writes || group_locked!=(WhichBank(temp->Address)/params->group_size)) && (HOLD.find(temp->req_ID)==HOLD.end()) &&   (corresp_rank->getBusyUntil() < cycles) && (((corresp_bank->getBusyUntil() < cycles) && !corresp_bank->getLocked()) || (params->write_cancel && !WB->flush() && !corresp_bank->read() &&(corresp_bank->getBusyUntil() - cycles < (100-4*WB->getSize())*1.0*params->tCL_W/100.0 ))) && (outstanding.size() < params->max_outstanding))
+					if ((!params->adaptive_writes || group_locked!=(WhichBank(temp->Address)/params->group_size)) && (HOLD.find(temp->req_ID)==HOLD.end()) &&   (corresp_rank->getBusyUntil() < cycles) && (((corresp_bank->getBusyUntil() < cycles) && !corresp_bank->getLocked()) || (params->write_cancel && !WB->flush() && !corresp_bank->read() &&(corresp_bank->getBusyUntil() - cycles < (100-4*WB->getSize())*1.0*params->tCL_W/100.0 ))) && (outstanding < params->max_outstanding))
 					{
 
 
@@ -611,13 +666,13 @@ bool NVM_DIMM::submit_request_opt()
 							corresp_bank->set_last(true);
 							time_ready = cycles + params->tRCD + params->tCMD;
 							curr_reads++;
-							READS_COMPLETE[cycles + params->tRCD + params->tCMD]++;
+							schedule_completion(true, params->tRCD + params->tCMD);
 							corresp_bank->setRB(temp->Address/params->row_buffer_size);
 							issued = true;
 						}
 						if(issued)
 						{
-							outstanding.push_back(temp);
+							outstanding++;
 							transactions.erase(st);
 							removed=true;
 							// Lock the bank so no other request comes in and try to activate another row while waiting for the activation
@@ -667,6 +722,8 @@ void NVM_DIMM::handleEvent( SST::Event* e )
 
 
 
+	wake();
+
 	MessierEvent * temp_ptr =  dynamic_cast<MessierComponent::MessierEvent*> (e);
 
 	if(temp_ptr==NULL)
@@ -686,8 +743,7 @@ void NVM_DIMM::handleEvent( SST::Event* e )
 		{
 			NVM_Request * temp = req;
 
-			histogram_idle->addData((cycles - TIME_STAMP[temp])/1000);
-			TIME_STAMP.erase(temp);
+			histogram_idle->addData((cycles - temp->time_stamp)/1000);
 			if(SQUASHED.find(temp->req_ID)==SQUASHED.end())
 			{
 				MemRespEvent *respEvent = new MemRespEvent(
@@ -754,8 +810,7 @@ void NVM_DIMM::handleEvent( SST::Event* e )
 				}
 
 			(getBank(req->Address))->setLocked(false, cycles);
-			ready_trans.erase(req);
-			outstanding.remove(req);
+			outstanding--;
 			delete req;
 
 		}
@@ -765,7 +820,13 @@ void NVM_DIMM::handleEvent( SST::Event* e )
 	{
 
 		NVM_Request * req = tmp.getReq();
-		ready_at_NVM[req] = cycles;
+
+		// Keep the ready requests in request ID order, there are only a handful of them
+		std::vector<NVM_Request *>::iterator pos = ready_at_NVM.end();
+		while(pos != ready_at_NVM.begin() && (*(pos - 1))->req_ID > req->req_ID)
+			pos--;
+		if(pos == ready_at_NVM.begin() || (*(pos - 1))->req_ID != req->req_ID)
+			ready_at_NVM.insert(pos, req);
 		delete e;
 
 	}
@@ -796,7 +857,7 @@ void NVM_DIMM::handleEvent( SST::Event* e )
 				if(params->cache_persistent)
 					HOLD.erase(temp->req_ID);
 
-				SQUASHED[temp->req_ID] = 1;
+				SQUASHED.insert(temp->req_ID);
 
 
 			}
@@ -918,6 +979,8 @@ void NVM_DIMM::handleEvent( SST::Event* e )
 void NVM_DIMM::handleRequest(SST::Event* e)
 {
 
+	wake();
+
 	enabled = true;
 
 
@@ -985,7 +1048,7 @@ void NVM_DIMM::handleRequest(SST::Event* e)
 		{
 			// Hold servicing the request till we check the cache!
 			if(params->cache_persistent)
-				HOLD[tmp2->req_ID] = 1;
+				HOLD.insert(tmp2->req_ID);
 
 			tmp2->meta_data = EventType::HIT_MISS;
 			m_EventChan->send(params->cache_latency, new MessierEvent(tmp2, EventType::HIT_MISS));
@@ -27,12 +27,16 @@
 #include <sst/elements/memHierarchy/memEvent.h>
 #include <map>
 #include <list>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
 #include "Rank.h"
 #include "WriteBuffer.h"
 #include "NVM_Params.h"
 #include "NVM_Request.h"
 #include "memReqEvent.h"
 #include "Cache.h"
+#include "TimingWheel.h"
 
 using namespace SST;
 using namespace SST::MessierComponent;
@@ -54,27 +58,14 @@ namespace SST { namespace MessierComponent{
 		// This is the requests buffer, where all transactions are buffered before being processed by the controller
 		std::list<NVM_Request *> transactions;
 
-		// This tracks the currently outstanding requests
-		std::list<NVM_Request *> outstanding;
+		// This tracks the number of currently outstanding requests
+		unsigned int outstanding;
 
-		// This is used to quickly track the number of writes complete at a specific cycle to remove them from the currently executed writes
-		std::map<long long int, int> WRITES_COMPLETE;
+		// This tracks the number of reads and writes completing at each upcoming cycle to remove them from the currently executed reads and writes
+		NVM_TIMING_WHEEL completions;
 
-		// This is used to quickly track the number of reads complete at a specific cycle to remove them from the currently executed reads
-		std::map<long long int, int> READS_COMPLETE;
-
-                // Deterministic sort function for NVM_Request pointers
-                struct NVMReqPtrCompare {
-                    bool operator()(const NVM_Request* ptrA, const NVM_Request* ptrB) const {
-                        return (ptrA->req_ID < ptrB->req_ID);
-                    }
-                };
-
-		// This is the queue of the ready requests
-		std::map<NVM_Request *, long long int, NVMReqPtrCompare> ready_trans;
-
-		// This tracks if a request is expected to be ready at the PCM
-		std::map<NVM_Request *, long long int, NVMReqPtrCompare> ready_at_NVM;
+		// This tracks the requests whose data is ready at the PCM, ordered by request ID. There are at most max_outstanding of them
+		std::vector<NVM_Request *> ready_at_NVM;
 
 		// This determines the completed requests and when they are completed
 		std::list<NVM_Request *> completed_requests;
@@ -101,31 +92,48 @@ namespace SST { namespace MessierComponent{
 
 		SST::Link * m_EventChan;
 
-		std::map<long long int, MemReqEvent *> NVM_EVENT_MAP;
-
-		std::map<NVM_Request *, long long int, NVMReqPtrCompare> TIME_STAMP;
+		std::unordered_map<long long int, MemReqEvent *> NVM_EVENT_MAP;
 
 		// This keeps track of the squashed requests, as they hit in the cache
-		std::map<long long int, int> SQUASHED;
+		std::unordered_set<long long int> SQUASHED;
 
 		// This structure prevents returning data before checking the cache, to avoid any inconsistency issues
-		std::map<long long int, int> HOLD;
+		std::unordered_set<long long int> HOLD;
 
 		// This defines the internal cache of the NVM-based DIMM
 		NVM_CACHE * cache;
 
-		std::map<int, int> bank_hist;
+		std::vector<int> bank_hist;
 
 		int group_locked;
 
+		// Declocking: the clock is turned off while nothing is pending and the skipped cycles are accounted for when it is turned back on
+		TimeConverter * clock_tc;
+
+		Clock::HandlerBase * clock_handler;
+
+		bool clock_on;
+
+		// The clock cycle of the last tick before the clock was turned off
+		SimTime_t last_tick;
+
+		// Returns true if ticking would only advance the cycle count
+		bool idle();
+
+		// Turns the clock back on, called before handling any event
+		void wake();
+
 		public:
 
 		// This is the constructor for the NVM-based DIMM
 		NVM_DIMM(SST::ComponentId_t id, NVM_PARAMS par);
 
 		// This is the clock of the near memory controller
+		// Returns true if the clock should be turned off
 		bool tick();
 
+		void setClock(TimeConverter * tc, Clock::HandlerBase * handler) { clock_tc = tc; clock_handler = handler; }
+
 		void finish(){}
 
 		RANK * getRank(long long int add){ return ranks[WhichRank(add)]; }
@@ -142,7 +150,7 @@ namespace SST { namespace MessierComponent{
 
 		//bool push_request(NVM_Request * req) { if(transactions.size() >= params->max_requests) return false; else {transactions.push_back(req); return true; }}
 
-		bool push_request(NVM_Request * req) { transactions.push_back(req);  if(req->Read) TIME_STAMP[req]= cycles; return true;}
+		bool push_request(NVM_Request * req) { transactions.push_back(req);  if(req->Read) req->time_stamp = cycles; return true;}
 
 		// This is the optimized version that basiclly tries to find out if there is any possibility to achieve a row buffer hit from the current transactions
 		bool submit_request_opt();
@@ -153,6 +161,9 @@ namespace SST { namespace MessierComponent{
 		// This schedule a deliver for data ready at the NVM Chips
 		void schedule_delivery();
 
+		// This records a read or write completing delay cycles from now
+		void schedule_completion(bool read, long long int delay);
+
 		// Try to flush the write buffer
 		bool try_flush_wb();
 
@@ -151,6 +151,9 @@ class NVM_PARAMS
 		// This indicates the write cancellation threshold
 		int write_cancel_th;
 
+		// This indicates if the controller clock is turned off while there is nothing to do
+		bool declock;
+
 
 	public:
 
@@ -231,6 +234,8 @@ class NVM_PARAMS
 
 			write_cancel_th = D.write_cancel_th;
 
+			declock = D.declock;
+
 		}
 };
 }}
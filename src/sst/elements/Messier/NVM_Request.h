@@ -35,13 +35,15 @@ class NVM_Request
 {
 
 	public:
-		NVM_Request() {}
-		NVM_Request(long long id, bool R, int size, long long int Add) { req_ID = id; Read = R; Size = size; Address = Add;}
+		NVM_Request() : time_stamp(0) {}
+		NVM_Request(long long id, bool R, int size, long long int Add) : time_stamp(0) { req_ID = id; Read = R; Size = size; Address = Add;}
 		long long int req_ID;
 		bool Read;
 		int Size;
 		long long int Address;
 		int meta_data;
+		// The cycle a read was queued at the controller
+		long long int time_stamp;
 
 };
 
@@ -0,0 +1,71 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+//
+
+
+#ifndef _H_SST_NVM_TIMING_WHEEL
+#define _H_SST_NVM_TIMING_WHEEL
+
+#include <vector>
+
+namespace SST{ namespace MessierComponent{
+
+// This counts the reads and writes completing at each upcoming cycle. Completions are always scheduled a bounded number of cycles ahead (the longest read or write latency), so a ring of per-cycle buckets at least that long replaces a map keyed by cycle
+class NVM_TIMING_WHEEL
+{
+
+	struct Bucket {
+		Bucket() : reads(0), writes(0) {}
+		int reads;
+		int writes;
+	};
+
+	std::vector<Bucket> buckets;
+
+	long long int mask;
+
+	// The number of completions still to be collected
+	long long int pending;
+
+	Bucket & at(long long int cycle) { return buckets[cycle & mask]; }
+
+	public:
+
+	NVM_TIMING_WHEEL() : buckets(1), mask(0), pending(0) {}
+
+	// The wheel must be longer than the largest delay completions are scheduled with
+	void init(long long int max_delay) {
+		long long int size = 1;
+		while(size <= max_delay)
+			size <<= 1;
+		buckets.assign(size, Bucket());
+		mask = size - 1;
+	}
+
+	void add_read(long long int cycle) { at(cycle).reads++; pending++; }
+	void add_write(long long int cycle) { at(cycle).writes++; pending++; }
+
+	// Collects the number of reads and writes completing at this cycle
+	void collect(long long int cycle, int & reads, int & writes) {
+		Bucket & b = at(cycle);
+		reads = b.reads;
+		writes = b.writes;
+		pending -= b.reads + b.writes;
+		b.reads = 0;
+		b.writes = 0;
+	}
+
+	bool empty() { return pending == 0; }
+
+};
+
+}}
+#endif
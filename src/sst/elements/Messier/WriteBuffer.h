@@ -98,7 +98,7 @@ class NVM_WRITE_BUFFER
 
 	void erase_entry(NVM_Request *);
 
-	std::list<NVM_Request *> getList() { return mem_reqs;}
+	const std::list<NVM_Request *> & getList() { return mem_reqs;}
 
 
 };
@@ -257,6 +257,10 @@ REQRESPONSE Opal::allocateSharedMemory(int node, int coreId, uint64_t vAddress,
 
 	int sharedMemPoolId;
 
+	// A fragmented buddy pool can have enough free frames but no contiguous
+	// run of them, so a failed allocation moves on to the next pool. Only
+	// running out of single frames is fatal, a multi page request that no
+	// pool can satisfy returns status 0.
 	if(nodeInfo[node]->memoryAllocationPolicy) {
 
 		sharedMemPoolId = nodeInfo[node]->allocatedmempool - 1;
@@ -269,21 +273,19 @@ REQRESPONSE Opal::allocateSharedMemory(int node, int coreId, uint64_t vAddress,
 			if( sharedMemoryInfo[i]->pool->available_frames >= pages )
 			{
 				Pool *pool = sharedMemoryInfo[i]->pool;
-				for(int j=0; j<pages; j++) {
-					response = pool->allocate_frame(1);
-					if(!response.status)
-						output->fatal(CALL_INFO, -1, "Opal: Allocating shared memory. This should never happen\n");
+				response = pool->allocate_frame(pages);
+				if(!response.status)
+					continue;
 
+				for(int j=0; j<pages; j++)
 					nodeInfo[node]->profileEvent(SST::OpalComponent::MemType::SHARED);
-				}
 
 				response.pages = pages;
-				response.status = 1;
 				break;
 			}
 		}
 
-		if(!response.status)
+		if(!response.status && pages == 1)
 			output->fatal(CALL_INFO, -1, "Opal(%s): Memory is drained out\n",getName().c_str());
 
 		return response;
@@ -291,17 +293,15 @@ REQRESPONSE Opal::allocateSharedMemory(int node, int coreId, uint64_t vAddress,
 
 	if( sharedMemoryInfo[sharedMemPoolId]->pool->available_frames >= pages ) {
 		Pool *pool = sharedMemoryInfo[sharedMemPoolId]->pool;
-		for(int j=0; j<pages; j++) {
-			response = pool->allocate_frame(1);
-			if(!response.status)
-				output->fatal(CALL_INFO, -1, "Opal: Allocating shared memory. This should never happen\n");
+		response = pool->allocate_frame(pages);
+	}
 
+	if( response.status ) {
+		for(int j=0; j<pages; j++)
 			nodeInfo[node]->profileEvent(SST::OpalComponent::MemType::SHARED);
-		}
 
 		setNextMemPool( node,fault_level );
 		response.pages = pages;
-		response.status = 1;
 	}
 	else
 	{
@@ -315,22 +315,20 @@ REQRESPONSE Opal::allocateSharedMemory(int node, int coreId, uint64_t vAddress,
 
 			if( sharedMemoryInfo[sharedMemPoolId]->pool->available_frames >= pages ) {
 				Pool *pool = sharedMemoryInfo[sharedMemPoolId]->pool;
-				for(int j=0; j<pages; j++) {
-					response = pool->allocate_frame(1);
-					if(!response.status)
-						output->fatal(CALL_INFO, -1, "Opal: Allocating shared memory. This should never happen\n");
+				response = pool->allocate_frame(pages);
+				if(!response.status)
+					continue;
 
+				for(int j=0; j<pages; j++)
 					nodeInfo[node]->profileEvent(SST::OpalComponent::MemType::SHARED);
-				}
 
 				setNextMemPool( node,fault_level );
 				response.pages = pages;
-				response.status = 1;
 				break;
 			}
 		}
 
-		if(!response.status)
+		if(!response.status && pages == 1)
 			output->fatal(CALL_INFO, -1, "Opal: Memory is drained out\n");
 
 	}
@@ -347,20 +345,18 @@ REQRESPONSE Opal::allocateLocalMemory(int node, int coreId, uint64_t vAddress, i
 
 	if(nodeInfo[node]->pool->available_frames >= pages) {
 		Pool *pool = nodeInfo[node]->pool;
-		for(int i=0; i<pages; i++) {
-			response = pool->allocate_frame(1);
-			if(!response.status)
-				output->fatal(CALL_INFO, -1, "Opal: Allocating local memory. This should never happen\n");
+		response = pool->allocate_frame(pages);
+	}
 
+	if(response.status) {
+		for(int i=0; i<pages; i++)
 			nodeInfo[node]->profileEvent(SST::OpalComponent::MemType::LOCAL);
-		}
 
 		response.pages = pages;
-		response.status = 1;
 		setNextMemPool( node,fault_level );
 	}
 	else {
-		OPAL_VERBOSE(8, output->verbose(CALL_INFO, 8, 0, "Node%" PRIu32 " Local Memory is drained out\n", node));
+		OPAL_VERBOSE(8, output->verbose(CALL_INFO, 8, 0, "Node%" PRIu32 " Local Memory has no %d free contiguous frames\n", node, pages));
 
 		setNextMemPool( node,fault_level );
 		response = allocateSharedMemory(node, coreId, vAddress, fault_level, pages);
@@ -382,6 +378,10 @@ REQRESPONSE Opal::allocateFromReservedMemory(int node, uint64_t reserved_vAddres
 
 	std::vector<uint64_t> *reserved_pAddress = opalBase->mmapFileIdHints[fileID].second;
 
+	// Reserved frames are handed out one at a time, they need not be contiguous
+	if(pages != 1)
+		output->fatal(CALL_INFO, -1, "Opal: reserved memory for file ID: %d only supports single page allocations\n", fileID);
+
 	//Allocate all the pages. TODO: pages can be reserved on demand instead of allocating all the pages at a time. But what if the memory is drained out.
 	if(reserved_pAddress->empty()) {
 
@@ -428,6 +428,18 @@ REQRESPONSE Opal::allocateFromReservedMemory(int node, uint64_t reserved_vAddres
 	return response;
 }
 
+bool Opal::contiguousFrames(int node)
+{
+	if(!nodeInfo[node]->pool->supportsContiguous())
+		return false;
+
+	for(uint32_t i = 0; i < num_shared_mempools; i++)
+		if(!sharedMemoryInfo[i]->pool->supportsContiguous())
+			return false;
+
+	return true;
+}
+
 bool Opal::processRequest(int node, int coreId, uint64_t vAddress, int fault_level, int size)
 {
 
@@ -437,8 +449,9 @@ bool Opal::processRequest(int node, int coreId, uint64_t vAddress, int fault_lev
 	int pages = ceil(size/(nodeInfo[node]->page_size));
 
 	// If multiple pages are requested how are the physical addresses sent to the requester as in future sue to opal parallelization continuous addresses cannot be allocated
-	if(pages != 1)
-		output->fatal(CALL_INFO, -1, "Opal: currently opal does not support multiple page allocations\n");
+	// Buddy pools can hand out a contiguous (huge) frame instead, e.g. 512 frames for a 2MB page
+	if(pages != 1 && !contiguousFrames(node))
+		output->fatal(CALL_INFO, -1, "Opal: multiple page allocations need the buddy allocator in every memory pool\n");
 
 	// if the page fault request is for CR3 register allocate the memory from local memory
 	if(4 == fault_level)
@@ -470,6 +483,14 @@ bool Opal::processRequest(int node, int coreId, uint64_t vAddress, int fault_lev
 		tse->setCoreId(coreId);
 		nodeInfo[node]->coreInfo[coreId].mmuLink->send(tse);
 	}
+	else if( pages != 1 ) {
+		// No pool has a free contiguous run this large. A size of 0 tells
+		// the requester nothing was allocated, it can retry with smaller pages
+		OpalEvent *tse = new OpalEvent(EventType::RESPONSE);
+		tse->setResp(vAddress, 0, 0);
+		tse->setCoreId(coreId);
+		nodeInfo[node]->coreInfo[coreId].mmuLink->send(tse);
+	}
 	else
 		output->fatal(CALL_INFO, -1, "Opal(%s): Memory is drained out\n",getName().c_str());
 
@@ -273,6 +273,9 @@ namespace SST
 
 				REQRESPONSE allocateFromReservedMemory(int node, uint64_t reserved_vAddress, uint64_t vAddress, int pages);
 
+				// True if the node's memory pools can all allocate contiguous runs of frames
+				bool contiguousFrames(int node);
+
 				REQRESPONSE isAddressReserved(int node, uint64_t vAddress);
 
 				bool processRequest(int node, int coreId, uint64_t vAddress, int fault_level, int size);
@@ -322,10 +325,12 @@ namespace SST
 							{"shared_mem.mempool%(shared_mempools)d.size", "Size of each shared memory pool in KBs", "1024"},
 							{"shared_mem.mempool%(shared_mempools)d.frame_size", "Size of each shared memory pool in KBs", "4"},
 							{"shared_mem.mempool%(shared_mempools)d.mem_tech", "memory technology of each shared memory pool in KBs", "0"},
+							{"shared_mem.mempool%(shared_mempools)d.allocator", "Frame allocator of each shared memory pool, 'list' or 'buddy' (contiguous and huge frames, no per-frame state)", "list"},
 							{"local_mem.mempool%(num_nodes)d.start", "the starting physical address of each local memory pool in KBs", "0"},
 							{"local_mem.mempool%(num_nodes)d.size", "Size of each local memory pool in KBs", "1024"},
 							{"local_mem.mempool%(num_nodes)d.frame_size", "frame size of each local memory pool in KBs", "4"},
 							{"local_mem.mempool%(num_nodes)d.mem_tech", "memory technology of each local memory pool in KBs", "0"},
+							{"local_mem.mempool%(num_nodes)d.allocator", "Frame allocator of each local memory pool, 'list' or 'buddy' (contiguous and huge frames, no per-frame state)", "list"},
 							{"startaddress%(num_pools)d", "the starting physical address of the pool", "0"},
 							{"type%(num_pools)d", "0 means private for specific NUMA domain, 1 means shared among specific NUMA domains, 2 means public", "2"},
 							{"cluster_size", "This determines the number of NUMA domains in each cluster, if clustering is used", "1"},
@@ -37,6 +37,18 @@ Pool::Pool(Params params, SST::OpalComponent::MemType mem_type, int id)
 
 	frsize = params.find<int>("frame_size", 4); //4KB frame size
 
+	std::string allocator = params.find<std::string>("allocator", "list");
+	if(allocator == "buddy")
+		use_buddy = true;
+	else if(allocator == "list")
+		use_buddy = false;
+	else
+		output->fatal(CALL_INFO, -1, "Unknown frame allocator '%s', expected 'list' or 'buddy'\n", allocator.c_str());
+
+	// Buddy blocks are aligned to physical frame numbers, so a 2MB block is 2MB aligned in memory
+	if(use_buddy && start % ((uint64_t) frsize*1024))
+		output->fatal(CALL_INFO, -1, "The buddy allocator needs the pool start (%" PRIu64 ") aligned to the frame size\n", start);
+
 	memType = mem_type;
 
 	poolId = id;
@@ -94,8 +106,13 @@ void Pool::build_mem()
 	//unsigned seed = std::chrono::system_clock::now().time_since_epoch().count();
 	//std::shuffle(numbers.begin(), numbers.end(), std::default_random_engine(seed));
 
-	for(i=0; i< num_frames; i++) {
-		freelist.push_back(((uint64_t) i*frsize*1024) + start);
+	if(use_buddy) {
+		buddy.init(start / ((uint64_t) frsize*1024), num_frames);
+	}
+	else {
+		for(i=0; i< num_frames; i++) {
+			freelist.push_back(((uint64_t) i*frsize*1024) + start);
+		}
 	}
 
 	available_frames = num_frames;
@@ -114,6 +131,10 @@ REQRESPONSE Pool::allocate_frames(int pages)
 		return response;
 	}
 
+	// The frames are freed as one run, so they have to be contiguous
+	if(use_buddy)
+		return buddy_allocate(pages);
+
 	int frames = pages;
 	std::list<Frame*> frames_allocated;
 
@@ -158,6 +179,9 @@ REQRESPONSE Pool::allocate_frames(int pages)
 REQRESPONSE Pool::allocate_frame(int N)
 {
 
+	if(use_buddy)
+		return buddy_allocate(N);
+
 	REQRESPONSE response;
 	response.status = 0;
 
@@ -193,6 +217,9 @@ REQRESPONSE Pool::allocate_frame(int N)
 REQRESPONSE Pool::deallocate_frames(int pages, uint64_t starting_pAddress)
 {
 
+	if(use_buddy)
+		return buddy_deallocate(starting_pAddress, pages);
+
 	REQRESPONSE response;
 	int frames = pages;
 	uint64_t pAddress = starting_pAddress;
@@ -232,6 +259,9 @@ REQRESPONSE Pool::deallocate_frames(int pages, uint64_t starting_pAddress)
 REQRESPONSE Pool::deallocate_frame(uint64_t X, int N)
 {
 
+	if(use_buddy)
+		return buddy_deallocate(X, N);
+
 	REQRESPONSE response;
 	response.status = 0;
 
@@ -262,12 +292,169 @@ REQRESPONSE Pool::deallocate_frame(uint64_t X, int N)
 
 bool Pool::isAllocated(uint64_t address)
 {
+	if(use_buddy) {
+		uint64_t frame_bytes = (uint64_t) frsize*1024;
+		if(address % frame_bytes)
+			return false;
+		return buddy.isAllocated(address / frame_bytes);
+	}
+
 	if(alloclist.find(address)==alloclist.end())
 		return false;
 
 	return true;
 }
 
+REQRESPONSE Pool::buddy_allocate(int N)
+{
+	REQRESPONSE response;
+	response.status = 0;
+
+	uint64_t index;
+	if(N < 1 || !buddy.allocate(N, index))
+		return response;
+
+	available_frames -= N;
+	response.address = index*frsize*1024;
+	response.pages = N;
+	response.status = 1;
+	return response;
+}
+
+REQRESPONSE Pool::buddy_deallocate(uint64_t X, int N)
+{
+	REQRESPONSE response;
+	response.address = X;
+	response.pages = N;
+	response.status = 0;
+
+	uint64_t frame_bytes = (uint64_t) frsize*1024;
+	if(N < 1 || X % frame_bytes)
+		return response;
+
+	if(!buddy.release(X / frame_bytes, N))
+		return response;
+
+	available_frames += N;
+	response.status = 1;
+	return response;
+}
+
+void BuddyFrames::init(uint64_t first, uint64_t frames)
+{
+	first_frame = first;
+	num_frames = frames;
+	free_frames = 0;
+	free_blocks.assign(64, std::set<uint64_t>());
+	// Grown as frames are handed out
+	allocated.clear();
+
+	freeRange(first, frames);
+}
+
+bool BuddyFrames::allocate(uint64_t frames, uint64_t &index)
+{
+	if(frames == 0 || frames > free_frames)
+		return false;
+
+	int order = 0;
+	while(((uint64_t) 1 << order) < frames)
+		order++;
+
+	// Smallest free block that is big enough, lowest address first
+	int found = order;
+	while(found < (int) free_blocks.size() && free_blocks[found].empty())
+		found++;
+
+	if(found == (int) free_blocks.size())
+		return false;
+
+	index = *free_blocks[found].begin();
+	free_blocks[found].erase(free_blocks[found].begin());
+
+	// Split it down, keeping the upper halves free
+	while(found > order) {
+		found--;
+		free_blocks[found].insert(index + ((uint64_t) 1 << found));
+	}
+
+	free_frames -= (uint64_t) 1 << order;
+	mark(index, frames, true);
+
+	// Give back the tail of the block if the request was not a power of two
+	freeRange(index + frames, ((uint64_t) 1 << order) - frames);
+
+	return true;
+}
+
+bool BuddyFrames::release(uint64_t index, uint64_t frames)
+{
+	if(frames == 0 || index < first_frame || index - first_frame >= num_frames || frames > num_frames - (index - first_frame))
+		return false;
+
+	for(uint64_t i = index; i < index + frames; i++) {
+		if(!isAllocated(i))
+			return false;
+	}
+
+	mark(index, frames, false);
+	freeRange(index, frames);
+
+	return true;
+}
+
+void BuddyFrames::freeRange(uint64_t index, uint64_t frames)
+{
+	// Split into the largest aligned blocks that fit
+	while(frames) {
+		int order = 0;
+		while(order < 63 && !(index & ((uint64_t) 1 << order)) && ((uint64_t) 2 << order) <= frames)
+			order++;
+
+		freeBlock(index, order);
+		index += (uint64_t) 1 << order;
+		frames -= (uint64_t) 1 << order;
+	}
+}
+
+void BuddyFrames::freeBlock(uint64_t index, int order)
+{
+	free_frames += (uint64_t) 1 << order;
+
+	// Merge with the buddy for as long as it is free as a whole
+	while(order < 63) {
+		uint64_t buddy = index ^ ((uint64_t) 1 << order);
+		if(!free_blocks[order].erase(buddy))
+			break;
+
+		index = std::min(index, buddy);
+		order++;
+	}
+
+	free_blocks[order].insert(index);
+}
+
+void BuddyFrames::mark(uint64_t index, uint64_t frames, bool value)
+{
+	index -= first_frame;
+
+	if(value && allocated.size() < (index + frames + 63) / 64)
+		allocated.resize((index + frames + 63) / 64, 0);
+
+	for(uint64_t i = index; i < index + frames; ) {
+		uint64_t bit = i % 64;
+		uint64_t count = std::min((uint64_t) 64 - bit, index + frames - i);
+		uint64_t mask = (count == 64) ? ~(uint64_t) 0 : (((uint64_t) 1 << count) - 1) << bit;
+
+		if(value)
+			allocated[i / 64] |= mask;
+		else
+			allocated[i / 64] &= ~mask;
+
+		i += count;
+	}
+}
+
 /*REQRESPONSE Pool::allocate_frame_address(uint64_t address)
 {
 
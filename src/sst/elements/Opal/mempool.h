@@ -22,6 +22,8 @@
 
 #include <list>
 #include <map>
+#include <set>
+#include <vector>
 #include <cmath>
 
 
@@ -56,6 +58,53 @@ class Frame{
 };
 
 
+// Buddy allocator over the frames of a pool. Free space is kept as naturally
+// aligned power-of-two blocks of frames, one ordered set per block order, and
+// a bitmap records which frames are allocated. Nothing is created per frame,
+// so a pool of any size starts with O(log n) free blocks. Frames are numbered
+// by physical address, so runs of 512 and 262144 frames come out 2MB and 1GB
+// aligned in memory when the frame size is 4KB, wherever the pool starts.
+class BuddyFrames{
+
+	public:
+		BuddyFrames() : first_frame(0), num_frames(0), free_frames(0) {}
+
+		// Manage frames first to first + frames - 1
+		void init(uint64_t first, uint64_t frames);
+
+		// Allocate 'frames' contiguous frames, index is set to the first frame
+		bool allocate(uint64_t frames, uint64_t &index);
+
+		// Free 'frames' frames starting at index, fails if any of them are not allocated
+		bool release(uint64_t index, uint64_t frames);
+
+		bool isAllocated(uint64_t index) const {
+			if(index < first_frame)
+				return false;
+			index -= first_frame;
+			return index / 64 < allocated.size() && (allocated[index / 64] >> (index % 64)) & 1;
+		}
+
+		uint64_t available() const { return free_frames; }
+
+	private:
+		void freeRange(uint64_t index, uint64_t frames);
+		void freeBlock(uint64_t index, int order);
+		void mark(uint64_t index, uint64_t frames, bool value);
+
+		uint64_t first_frame;
+		uint64_t num_frames;
+		uint64_t free_frames;
+
+		// Free blocks of 2^order frames, keyed by first frame
+		std::vector< std::set<uint64_t> > free_blocks;
+
+		// One bit per frame, set when allocated. Only covers frames up to the
+		// highest one allocated so far, the rest are free.
+		std::vector<uint64_t> allocated;
+};
+
+
 // This class defines a memory pool
 
 class Pool{
@@ -103,8 +152,11 @@ class Pool{
 
 		bool isAllocated(uint64_t address);
 
+		// True if allocate_frame(N) can hand out N > 1 contiguous frames
+		bool supportsContiguous() { return use_buddy; }
+
 		// Current number of free frames
-		int freeframes() { return freelist.size(); }
+		int freeframes() { return use_buddy ? buddy.available() : freelist.size(); }
 
 		// Frame size in KBs
 		int frsize;
@@ -155,5 +207,14 @@ class Pool{
 		// The list of allocated frames --- the key is the starting physical address
 		std::map<uint64_t, Frame*> alloclist;
 
+		// Use the buddy allocator instead of the free and allocated lists
+		bool use_buddy;
+
+		BuddyFrames buddy;
+
+		REQRESPONSE buddy_allocate(int N);
+
+		REQRESPONSE buddy_deallocate(uint64_t X, int N);
+
 };
 
@@ -108,6 +108,7 @@ PageTableWalker::PageTableWalker(ComponentId_t id, int tlb_id, PageTableWalker *
 	// The stats that will appear, not that these stats are going to be part of the Samba unit
 	statPageTableWalkerHits = registerStatistic<uint64_t>( "tlb_hits", subID);
 	statPageTableWalkerMisses = registerStatistic<uint64_t>( "tlb_misses", subID );
+	statPageWalkCacheSkipped = registerStatistic<uint64_t>( "ptwc_levels_skipped", subID );
 
 
 	size = new int[sizes];
@@ -376,28 +377,26 @@ void PageTableWalker::recvResp(SST::Event * event)
 	MemEvent * ev = static_cast<MemEvent*>(event);
 
 
-	long long int pw_id;
-	if(!self_connected)
-		pw_id = MEM_REQ[ev->getResponseToID()];
-	else
-		pw_id = MEM_REQ[ev->getID()];
-
-    //WID_Add[] is virtual address, WSR_PT_LEVEL[] is level of page table
-	insert_way(WID_Add[pw_id], find_victim_way(WID_Add[pw_id], WSR_PT_LEVEL[pw_id]), WSR_PT_LEVEL[pw_id]);
+	id_type req_id = self_connected ? ev->getID() : ev->getResponseToID();
+	long long int pw_id = MEM_REQ[req_id];
+	WalkState & walk = WALKS[pw_id];
 
-	Address_t addr = WID_Add[pw_id];
+    //walk.addr is virtual address, walk.level is level of page table
+	insert_way(walk.addr, find_victim_way(walk.addr, walk.level), walk.level);
 
-	WSR_READY[pw_id]=true;
+	Address_t addr = walk.addr;
 
 	// Avoiding memory leak by deleting the newly generated dummy requests
-	MEM_REQ.erase(ev->getID());
+	MEM_REQ.erase(req_id);
 	delete ev;
 
-	if(WSR_PT_LEVEL[pw_id]==0)
+	if(walk.level==0)
 	{
-		ready_by[WID_EV[pw_id]] =  currTime + latency + 2*upper_link_latency;
+		ready_by[walk.ev] =  currTime + latency + 2*upper_link_latency;
 
-		ready_by_size[WID_EV[pw_id]] = os_page_size; // FIXME: This hardcoded for now assuming the OS maps virtual pages to 4KB pages only
+		ready_by_size[walk.ev] = os_page_size; // FIXME: This hardcoded for now assuming the OS maps virtual pages to 4KB pages only
+
+		WALKS.erase(pw_id);
 	}
 	else
 	{
@@ -411,28 +410,28 @@ void PageTableWalker::recvResp(SST::Event * event)
 			if(!ptw_confined)
 			{
 				Address_t page_table_start = 0;
-				if(WSR_PT_LEVEL[pw_id]==4)
+				if(walk.level==4)
 					page_table_start = (*PGD)[addr/page_size[3]];
-				else if(WSR_PT_LEVEL[pw_id]==3)
+				else if(walk.level==3)
 					page_table_start = (*PUD) [addr/page_size[2]];
-				else if(WSR_PT_LEVEL[pw_id]==2)
+				else if(walk.level==2)
 					page_table_start = (*PMD) [addr/page_size[1]];
-				else if (WSR_PT_LEVEL[pw_id] == 1)
+				else if (walk.level == 1)
 					page_table_start = (*PTE) [addr/page_size[0]];
 
-				dummy_add = page_table_start + (addr/page_size[WSR_PT_LEVEL[pw_id]-1])%512;
+				dummy_add = page_table_start + (addr/page_size[walk.level-1])%512;
 			}
 			else
 			{
-				if(WSR_PT_LEVEL[pw_id]==4) {
+				if(walk.level==4) {
 					dummy_add = (*CR3) + ((addr/page_size[3])%512)*8;
 				}
-				else if(WSR_PT_LEVEL[pw_id]==3) {
+				else if(walk.level==3) {
 					dummy_add = (*PGD)[(addr/page_size[3])%512] + ((addr/page_size[2])%512)*8;
 				}
-				else if(WSR_PT_LEVEL[pw_id]==2) {
+				else if(walk.level==2) {
 					dummy_add = (*PUD)[(addr/page_size[2])%(512*512)] + ((addr/page_size[1])%512)*8;}
-				else if(WSR_PT_LEVEL[pw_id]==1) {
+				else if(walk.level==1) {
 					uint64_t offset = (uint64_t)512*512*512;
 					dummy_add = (*PMD)[(addr/page_size[1])%offset] + ((addr/page_size[0])%512)*8;
 				}
@@ -444,7 +443,7 @@ void PageTableWalker::recvResp(SST::Event * event)
 		MemEvent *e = new MemEvent(getName(), dummy_add, dummy_base_add, Command::GetS);
 		e->setVirtualAddress(addr);
 
-		WSR_PT_LEVEL[pw_id]--;
+		walk.level--;
 		MEM_REQ[e->getID()]=pw_id;
 		to_mem->send(e);
 
@@ -722,6 +721,7 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 
 			// Note that this is a hack to reduce the number of walks needed for large pages, however, in case of full-system, the content of the page table
 			// will tell us that no next level, but since we don't have a full-system status, we will just stop at the priori-known leaf level
+			int pwc_level = k;
 			if(os_page_size == 2048)
 				k = max(k-1, 1);
 			else if(os_page_size == 1024*1024)
@@ -736,7 +736,12 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 				if(to_mem!=nullptr)
 				{
 
-					WID_EV[++mmu_id] = (*st_1);
+					WalkState & walk = WALKS[++mmu_id];
+					walk.ev = (*st_1);
+
+					// Upper levels that hit in the page walk cache are not fetched
+					if(pwc_level < sizes)
+						statPageWalkCacheSkipped->addData(sizes - pwc_level);
 
 					Address_t dummy_add = rand()%10000000;
 
@@ -768,12 +773,10 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 					Address_t dummy_base_add = dummy_add & ~(line_size - 1);
 					MemEvent *e = new MemEvent(getName(), dummy_add, dummy_base_add, Command::GetS);
 
-                    // Record this walk request into WSR_ and WID_ structs
-					WSR_PT_LEVEL[mmu_id] = k-1;
-					//		WID_EV[mmu_id] = e;
-					WID_Add[mmu_id] = addr;
+                    // Record this walk request into WALKS
+					walk.level = k-1;
+					walk.addr = addr;
 					e->setVirtualAddress(addr);
-					WSR_READY[mmu_id] = false;
 
 					// Add it to the tracking structure
 					MEM_REQ[e->getID()]=mmu_id;
@@ -30,11 +30,16 @@
 #include <sst/core/sst_types.h>
 
 #include "utils.h"
+#include "RadixTable.h"
 #include "PageFaultHandler.h"
 
 // This file defines the page table walker and
 
 typedef std::pair<uint64_t, int> id_type;
+
+struct id_type_hash {
+	size_t operator()(const id_type & id) const { return std::hash<uint64_t>()(id.first * 0x9e3779b97f4a7c15ULL + id.second); }
+};
 typedef uint64_t Address_t;
 enum PageMigrationType { NONE, FTP};
 // FTP: First touch policy
@@ -127,24 +132,24 @@ namespace SST { namespace SambaComponent{
 		int *cr3_init;
 
 		// Holds the PGD, PUD, PMT, PTE physical pointers
-		std::map<Address_t, Address_t> * PGD; // key is 9 bits 39-47, i.e., VA/(4096*512*512*512)
-		std::map<Address_t, Address_t> * PUD; // key is 9 bits 30-38, i.e., VA/(4096*512*512)
-		std::map<Address_t, Address_t> * PMD; // key is 9 bits 21-29, i.e., VA/(4096*512)
-		std::map<Address_t, Address_t> * PTE; // key is 9 bits 12-20, i.e., VA/(4096)         
+		RadixTable<Address_t> * PGD; // key is 9 bits 39-47, i.e., VA/(4096*512*512*512)
+		RadixTable<Address_t> * PUD; // key is 9 bits 30-38, i.e., VA/(4096*512*512)
+		RadixTable<Address_t> * PMD; // key is 9 bits 21-29, i.e., VA/(4096*512)
+		RadixTable<Address_t> * PTE; // key is 9 bits 12-20, i.e., VA/(4096)         
                                               // PTE should give you the exact physical address of the page
 
 
 		// The structures below are used to quickly check if the page is mapped or not
-		std::map<Address_t,int> * MAPPED_PAGE_SIZE4KB;
-		std::map<Address_t,int> * MAPPED_PAGE_SIZE2MB;
-		std::map<Address_t,int> * MAPPED_PAGE_SIZE1GB;
+		RadixTable<int> * MAPPED_PAGE_SIZE4KB;
+		RadixTable<int> * MAPPED_PAGE_SIZE2MB;
+		RadixTable<int> * MAPPED_PAGE_SIZE1GB;
 
-		std::map<Address_t,int> *PENDING_PAGE_FAULTS;
-		std::map<Address_t,int> *PENDING_PAGE_FAULTS_PGD;
-		std::map<Address_t,int> *PENDING_PAGE_FAULTS_PUD;
-		std::map<Address_t,int> *PENDING_PAGE_FAULTS_PMD;
-		std::map<Address_t,int> *PENDING_PAGE_FAULTS_PTE;
-//		std::map<Address_t,int> *PENDING_SHOOTDOWN_EVENTS;
+		RadixTable<int> *PENDING_PAGE_FAULTS;
+		RadixTable<int> *PENDING_PAGE_FAULTS_PGD;
+		RadixTable<int> *PENDING_PAGE_FAULTS_PUD;
+		RadixTable<int> *PENDING_PAGE_FAULTS_PMD;
+		RadixTable<int> *PENDING_PAGE_FAULTS_PTE;
+//		RadixTable<int> *PENDING_SHOOTDOWN_EVENTS;
 
 
 
@@ -233,9 +238,9 @@ namespace SST { namespace SambaComponent{
 		PageTableWalker(ComponentId_t id, int page_size, int assoc, PageTableWalker * next_level, int size);
 		PageTableWalker(ComponentId_t id, int tlb_id, PageTableWalker * Next_level,int level, SST::Params& params);
 
-		void setPageTablePointers( Address_t * cr3, std::map<Address_t, Address_t> * pgd,  std::map<Address_t, Address_t> * pud,  std::map<Address_t, Address_t> * pmd, std::map<Address_t, Address_t> * pte,
-				std::map<Address_t,int> * gb,  std::map<Address_t,int> * mb,  std::map<Address_t,int> * kb, std::map<Address_t,int> * pr, int *cr3I, std::map<Address_t,int> *pf_pgd,  std::map<Address_t,int> *pf_pud,
-				std::map<Address_t,int> *pf_pmd, std::map<Address_t,int> * pf_pte)
+		void setPageTablePointers( Address_t * cr3, RadixTable<Address_t> * pgd,  RadixTable<Address_t> * pud,  RadixTable<Address_t> * pmd, RadixTable<Address_t> * pte,
+				RadixTable<int> * gb,  RadixTable<int> * mb,  RadixTable<int> * kb, RadixTable<int> * pr, int *cr3I, RadixTable<int> *pf_pgd,  RadixTable<int> *pf_pud,
+				RadixTable<int> *pf_pmd, RadixTable<int> * pf_pte)
 		{
 			CR3 = cr3;
 			PGD = pgd;
@@ -320,19 +325,22 @@ namespace SST { namespace SambaComponent{
         // which 
         //
 
-        //Autoincrementing ID, used to index events held in the `WSR_` and `WID_` maps
+        //Autoincrementing ID, used to index walks held in `WALKS`
 		long long int mmu_id=0;
 
         // For a given page-walk memory request:
-		std::map<long long int, int> WSR_PT_LEVEL; // what level of the PT does it refer to (0 = PTE, 3 = PGD)
-		std::map<long long int, bool> WSR_READY;
+		struct WalkState {
+			int level; // what level of the PT does it refer to (0 = PTE, 3 = PGD)
+			Address_t addr; // virtual address being translated
+			MemHierarchy::MemEventBase* ev; // the request waiting for the translation
+		};
 
-		std::map<long long int, Address_t> WID_Add;
-		std::map<long long int, MemHierarchy::MemEventBase*> WID_EV;
+		// In-flight walks, removed once the leaf level returns
+		FlatTable<long long int, WalkState> WALKS;
 
         // Each Walk request generates a MemEvent that is sent out;
-        // This maps `memevent->getID()` to the corresponding `mmu_id`  used in the WSR_ and WID_ objects
-		std::map<id_type, long long int> MEM_REQ;
+        // This maps `memevent->getID()` to the corresponding `mmu_id` used in `WALKS`
+		FlatTable<id_type, long long int, id_type_hash> MEM_REQ;
 
         //=== Etc
 
@@ -342,6 +350,8 @@ namespace SST { namespace SambaComponent{
 
 		Statistic<uint64_t>* statPageTableWalkerMisses;
 
+		Statistic<uint64_t>* statPageWalkCacheSkipped;
+
 		void handleEvent(SST::Event* event);
 
 		int getHits(){return hits;}
@@ -0,0 +1,175 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_SST_SAMBA_RADIX_TABLE
+#define _H_SST_SAMBA_RADIX_TABLE
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+namespace SST {
+namespace SambaComponent {
+
+	// Radix tree keyed by page number, 9 bits per level like the x86-64 page
+	// table it holds. A lookup is a fixed number of array indexes instead of a
+	// walk down a balanced tree, and nodes are only created for the parts of
+	// the address space that are touched. The tree grows upwards as larger keys
+	// are inserted. Only the subset of the std::map interface used by the page
+	// table code is provided; find() returns a pointer to the value or end().
+	template<typename T>
+	class RadixTable
+	{
+		static const int Bits = 9;
+		static const int Fanout = 1 << Bits;
+		static const int MaxHeight = (64 + Bits - 1) / Bits;
+
+		struct Leaf {
+			Leaf() : value(), present() {}
+			T value[Fanout];
+			uint64_t present[Fanout / 64];
+		};
+
+		struct Node {
+			Node() { memset(child, 0, sizeof(child)); }
+			void * child[Fanout];
+		};
+
+		public:
+
+		typedef T * iterator;
+
+		RadixTable() : root(NULL), height(0), count(0) {}
+
+		~RadixTable() { destroy(root, height); }
+
+		iterator end() const { return NULL; }
+
+		size_t size() const { return count; }
+
+		bool empty() const { return count == 0; }
+
+		iterator find(uint64_t key) const
+		{
+			Leaf * leaf = lookup(key, false);
+			if(!leaf || !isPresent(leaf, key))
+				return end();
+			return &leaf->value[key % Fanout];
+		}
+
+		// Inserts a value-initialized entry if the key is not present
+		T & operator[](uint64_t key)
+		{
+			Leaf * leaf = lookup(key, true);
+			uint64_t & word = leaf->present[(key % Fanout) / 64];
+			uint64_t bit = (uint64_t) 1 << (key % 64);
+			if(!(word & bit)) {
+				word |= bit;
+				leaf->value[key % Fanout] = T();
+				count++;
+			}
+			return leaf->value[key % Fanout];
+		}
+
+		size_t erase(uint64_t key)
+		{
+			Leaf * leaf = lookup(key, false);
+			if(!leaf || !isPresent(leaf, key))
+				return 0;
+			leaf->present[(key % Fanout) / 64] &= ~((uint64_t) 1 << (key % 64));
+			count--;
+			return 1;
+		}
+
+		private:
+
+		RadixTable(const RadixTable &); // do not implement
+		void operator=(const RadixTable &); // do not implement
+
+		static bool isPresent(const Leaf * leaf, uint64_t key)
+		{
+			return (leaf->present[(key % Fanout) / 64] >> (key % 64)) & 1;
+		}
+
+		// Number of levels needed to index key
+		static int levelsFor(uint64_t key)
+		{
+			int levels = 1;
+			while(levels < MaxHeight && (key >> (Bits * levels)))
+				levels++;
+			return levels;
+		}
+
+		Leaf * lookup(uint64_t key, bool create) const
+		{
+			RadixTable * self = const_cast<RadixTable *>(this);
+
+			if(levelsFor(key) > height) {
+				if(!create)
+					return NULL;
+				self->grow(levelsFor(key));
+			}
+
+			void * node = root;
+			for(int level = height - 1; level > 0; level--) {
+				void ** slot = &static_cast<Node *>(node)->child[(key >> (Bits * level)) % Fanout];
+				if(!*slot) {
+					if(!create)
+						return NULL;
+					*slot = (level == 1) ? (void *) new Leaf() : (void *) new Node();
+				}
+				node = *slot;
+			}
+
+			return static_cast<Leaf *>(node);
+		}
+
+		void grow(int levels)
+		{
+			if(!root) {
+				root = (levels == 1) ? (void *) new Leaf() : (void *) new Node();
+				height = levels;
+				return;
+			}
+
+			while(height < levels) {
+				Node * top = new Node();
+				top->child[0] = root;
+				root = top;
+				height++;
+			}
+		}
+
+		static void destroy(void * node, int levels)
+		{
+			if(!node)
+				return;
+
+			if(levels == 1) {
+				delete static_cast<Leaf *>(node);
+				return;
+			}
+
+			Node * inner = static_cast<Node *>(node);
+			for(int i = 0; i < Fanout; i++)
+				destroy(inner->child[i], levels - 1);
+			delete inner;
+		}
+
+		void * root;
+		int height;
+		size_t count;
+	};
+
+}
+}
+
+#endif
@@ -65,7 +65,8 @@ namespace SST {
                     { "total_waiting",   "The total waiting time", "cycles", 1},   // Name, Desc, Enable Level
                     { "write_requests",  "Stat write_requests", "requests", 1},
                     { "tlb_shootdown",   "Number of TLB clears because of page-frees", "shootdowns", 2 },
-                    { "tlb_page_allocs", "Number of pages allocated by the memory manager", "pages", 2 }
+                    { "tlb_page_allocs", "Number of pages allocated by the memory manager", "pages", 2 },
+                    { "ptwc_levels_skipped", "Page table levels not fetched from memory because an upper level hit in the page walk cache", "accesses", 2 }
                 )
 
                 SST_ELI_DOCUMENT_PARAMS(
@@ -111,19 +112,19 @@ namespace SST {
 				// Note, the application might be multi-threaded, however, all threads will share the sambe page table components below
 
 				Address_t CR3;
-				std::map<Address_t, Address_t> PGD;
-				std::map<Address_t, Address_t> PUD;
-				std::map<Address_t, Address_t> PMD;
-				std::map<Address_t, Address_t> PTE;
-				std::map<Address_t,int>  MAPPED_PAGE_SIZE4KB;
-				std::map<Address_t,int>  MAPPED_PAGE_SIZE2MB;
-				std::map<Address_t,int>  MAPPED_PAGE_SIZE1GB;
-
-				std::map<Address_t,int> PENDING_PAGE_FAULTS;
-                std::map<Address_t,int> PENDING_PAGE_FAULTS_PGD;
-                std::map<Address_t,int> PENDING_PAGE_FAULTS_PUD;
-                std::map<Address_t,int> PENDING_PAGE_FAULTS_PMD;
-                std::map<Address_t,int> PENDING_PAGE_FAULTS_PTE;
+				RadixTable<Address_t> PGD;
+				RadixTable<Address_t> PUD;
+				RadixTable<Address_t> PMD;
+				RadixTable<Address_t> PTE;
+				RadixTable<int>  MAPPED_PAGE_SIZE4KB;
+				RadixTable<int>  MAPPED_PAGE_SIZE2MB;
+				RadixTable<int>  MAPPED_PAGE_SIZE1GB;
+
+				RadixTable<int> PENDING_PAGE_FAULTS;
+                RadixTable<int> PENDING_PAGE_FAULTS_PGD;
+                RadixTable<int> PENDING_PAGE_FAULTS_PUD;
+                RadixTable<int> PENDING_PAGE_FAULTS_PMD;
+                RadixTable<int> PENDING_PAGE_FAULTS_PTE;
                 int cr3I;
 				std::map<Address_t,int> PENDING_SHOOTDOWN_EVENTS;
 
@@ -112,23 +112,23 @@ namespace SST { namespace SambaComponent{
 		Address_t *CR3;
 
 		// Holds the PGD, PUD, PMT, PTE physical pointers
-		std::map<Address_t, Address_t> * PGD; // key is 9 bits 39-47, i.e., VA/(4096*512*512*512)
-		std::map<Address_t, Address_t> * PUD; // key is 9 bits 30-38, i.e., VA/(4096*512*512)
-		std::map<Address_t, Address_t> * PMD; // key is 9 bits 21-29, i.e., VA/(4096*512)
-		std::map<Address_t, Address_t> * PTE; // key is 9 bits 12-20, i.e., VA/(4096)         
+		RadixTable<Address_t> * PGD; // key is 9 bits 39-47, i.e., VA/(4096*512*512*512)
+		RadixTable<Address_t> * PUD; // key is 9 bits 30-38, i.e., VA/(4096*512*512)
+		RadixTable<Address_t> * PMD; // key is 9 bits 21-29, i.e., VA/(4096*512)
+		RadixTable<Address_t> * PTE; // key is 9 bits 12-20, i.e., VA/(4096)         
                                               // PTE should give you the exact physical address of the page
 
 		// The structures below are used to quickly check if the page is mapped or not
-		std::map<Address_t,int> * MAPPED_PAGE_SIZE4KB;
-		std::map<Address_t,int> * MAPPED_PAGE_SIZE2MB;
-		std::map<Address_t,int> * MAPPED_PAGE_SIZE1GB;
+		RadixTable<int> * MAPPED_PAGE_SIZE4KB;
+		RadixTable<int> * MAPPED_PAGE_SIZE2MB;
+		RadixTable<int> * MAPPED_PAGE_SIZE1GB;
 
-		std::map<Address_t,int> *PENDING_PAGE_FAULTS;
-		std::map<Address_t,int> *PENDING_PAGE_FAULTS_PGD;
-		std::map<Address_t,int> *PENDING_PAGE_FAULTS_PUD;
-		std::map<Address_t,int> *PENDING_PAGE_FAULTS_PMD;
-		std::map<Address_t,int> *PENDING_PAGE_FAULTS_PTE;
-		std::map<Address_t,int> *PENDING_SHOOTDOWN_EVENTS;
+		RadixTable<int> *PENDING_PAGE_FAULTS;
+		RadixTable<int> *PENDING_PAGE_FAULTS_PGD;
+		RadixTable<int> *PENDING_PAGE_FAULTS_PUD;
+		RadixTable<int> *PENDING_PAGE_FAULTS_PMD;
+		RadixTable<int> *PENDING_PAGE_FAULTS_PTE;
+		RadixTable<int> *PENDING_SHOOTDOWN_EVENTS;
 
 
 		public:
@@ -143,19 +143,19 @@ namespace SST { namespace SambaComponent{
 
 
 		void setPageTablePointers(  Address_t * cr3, 
-                                    std::map<Address_t, Address_t> * pgd,  
-                                    std::map<Address_t, Address_t> * pud,  
-                                    std::map<Address_t, Address_t> * pmd, 
-                                    std::map<Address_t, Address_t> * pte,
-                                    std::map<Address_t,int> * gb,  
-                                    std::map<Address_t,int> * mb,  
-                                    std::map<Address_t,int> * kb, 
-                                    std::map<Address_t,int> * pr, 
+                                    RadixTable<Address_t> * pgd,  
+                                    RadixTable<Address_t> * pud,  
+                                    RadixTable<Address_t> * pmd, 
+                                    RadixTable<Address_t> * pte,
+                                    RadixTable<int> * gb,  
+                                    RadixTable<int> * mb,  
+                                    RadixTable<int> * kb, 
+                                    RadixTable<int> * pr, 
                                     int *cr3I, 
-                                    std::map<Address_t,int> *pf_pgd,
-                                    std::map<Address_t,int> *pf_pud,  
-                                    std::map<Address_t,int> *pf_pmd, 
-                                    std::map<Address_t,int> * pf_pte)
+                                    RadixTable<int> *pf_pgd,
+                                    RadixTable<int> *pf_pud,  
+                                    RadixTable<int> *pf_pmd, 
+                                    RadixTable<int> * pf_pte)
 		{
                         CR3 = cr3;
                         PGD = pgd;
@@ -16,6 +16,10 @@
 #include <sst/core/event.h>
 #include <sst/elements/memHierarchy/memEventBase.h>
 
+#include <functional>
+#include <utility>
+#include <vector>
+
 namespace SST {
 namespace SambaComponent {
 
@@ -29,6 +33,102 @@ namespace SambaComponent {
             }
         }
     };
+
+    // Open-addressed hash table with linear probing for in-flight request
+    // state. Entries sit in one flat array and are removed by shifting later
+    // entries of the probe run back, so there are no tombstones or per-entry
+    // allocations. Like RadixTable, find() returns a pointer to the value or
+    // end(). Pointers are invalidated by inserting into the table.
+    template<typename K, typename V, typename Hash = std::hash<K> >
+    class FlatTable {
+        struct Slot {
+            Slot() : used(false) {}
+            bool used;
+            K key;
+            V value;
+        };
+
+    public:
+        typedef V* iterator;
+
+        FlatTable() : slots(16), count(0) {}
+
+        iterator end() const { return nullptr; }
+
+        size_t size() const { return count; }
+
+        bool empty() const { return count == 0; }
+
+        iterator find(const K& key) {
+            size_t i = probe(key);
+            return slots[i].used ? &slots[i].value : end();
+        }
+
+        // Inserts a value-initialized entry if the key is not present
+        V& operator[](const K& key) {
+            size_t i = probe(key);
+            if (!slots[i].used) {
+                if (2 * (count + 1) > slots.size()) {
+                    rehash(2 * slots.size());
+                    i = probe(key);
+                }
+                slots[i].used = true;
+                slots[i].key = key;
+                slots[i].value = V();
+                count++;
+            }
+            return slots[i].value;
+        }
+
+        size_t erase(const K& key) {
+            size_t hole = probe(key);
+            if (!slots[hole].used)
+                return 0;
+
+            // Backward shift: pull up any later entry that may not sit
+            // between its home slot and the hole
+            size_t mask = slots.size() - 1;
+            for (size_t i = (hole + 1) & mask; slots[i].used; i = (i + 1) & mask) {
+                size_t home = hasher(slots[i].key) & mask;
+                if (((i - home) & mask) >= ((i - hole) & mask)) {
+                    slots[hole].key = std::move(slots[i].key);
+                    slots[hole].value = std::move(slots[i].value);
+                    hole = i;
+                }
+            }
+
+            slots[hole].used = false;
+            slots[hole].value = V();
+            count--;
+            return 1;
+        }
+
+    private:
+        size_t probe(const K& key) const {
+            size_t mask = slots.size() - 1;
+            size_t i = hasher(key) & mask;
+            while (slots[i].used && !(slots[i].key == key))
+                i = (i + 1) & mask;
+            return i;
+        }
+
+        void rehash(size_t capacity) {
+            std::vector<Slot> old(capacity);
+            old.swap(slots);
+            for (size_t i = 0; i < old.size(); i++) {
+                if (old[i].used) {
+                    Slot& slot = slots[probe(old[i].key)];
+                    slot.used = true;
+                    slot.key = std::move(old[i].key);
+                    slot.value = std::move(old[i].value);
+                }
+            }
+        }
+
+        std::vector<Slot> slots;
+        size_t count;
+        Hash hasher;
+    };
 }
 }
 
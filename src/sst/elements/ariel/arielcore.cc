@@ -125,6 +125,19 @@ ArielCore::ArielCore(ComponentId_t id, ArielTunnel *tunnel,
         traceGen->setCoreID(coreID);
     }
 
+    commandRecord = NULL;
+    std::string recordPrefix = params.find<std::string>("recordprefix", "");
+
+    if("" != recordPrefix) {
+        const std::string recordPath = ArielCommandFile::getFileName(recordPrefix, coreID);
+        commandRecord = new ArielCommandFile();
+
+        if(!commandRecord->openWrite(recordPath)) {
+            output->fatal(CALL_INFO, -1, "Unable to open command record file: \"%s\"\n",
+                    recordPath.c_str());
+        }
+    }
+
     currentCycles = 0;
 }
 
@@ -137,6 +150,7 @@ ArielCore::~ArielCore() {
         delete traceGen;
     }
 
+    delete commandRecord;
     delete stdMemHandlers;
 }
 
@@ -552,6 +566,9 @@ void ArielCore::finishCore() {
         delete traceGen;
         traceGen = NULL;
     }
+
+    delete commandRecord;
+    commandRecord = NULL;
 }
 
 void ArielCore::halt(){
@@ -579,7 +596,7 @@ void ArielCore::setPhysicalAddresses(SST::Event *ev){
     uint64_t addr_offset;
     uint64_t current_transfer;
     current_transfer = (getRemainingTransfer() > 64) ? 64 : getRemainingTransfer();
-    phy_addr = memmgr->translateAddress(getCurrentAddress());
+    phy_addr = memmgr->translateCoreAddress(coreID, getCurrentAddress());
     addr_offset = phy_addr % ((uint64_t) cacheLineSize);
     if((addr_offset + current_transfer <= cacheLineSize)){
         physicalAddresses.push_back(phy_addr);
@@ -589,7 +606,7 @@ void ArielCore::setPhysicalAddresses(SST::Event *ev){
         uint64_t rightAddr = (getCurrentAddress() + ((uint64_t) cacheLineSize)) - addr_offset;
         uint64_t rightSize = current_transfer - leftSize;
         uint64_t physLeftAddr = phy_addr;
-        uint64_t physRightAddr = memmgr->translateAddress(rightAddr);
+        uint64_t physRightAddr = memmgr->translateCoreAddress(coreID, rightAddr);
         physicalAddresses.push_back(physLeftAddr);
     }
 }
@@ -851,6 +868,10 @@ bool ArielCore::refillQueue() {
 
         ARIEL_CORE_VERBOSE(32, output->verbose(CALL_INFO, 32, 0, "Tunnel reads data on core: %" PRIu32 "\n", coreID));
 
+        if(commandRecord) {
+            commandRecord->write(ac);
+        }
+
         // There is data on the pipe
         switch(ac.command) {
             case ARIEL_OUTPUT_STATS:
@@ -886,6 +907,10 @@ bool ArielCore::refillQueue() {
                 while(ac.command != ARIEL_END_INSTRUCTION) {
                         ac = tunnel->readMessage(coreID);
 
+                        if(commandRecord) {
+                            commandRecord->write(ac);
+                        }
+
                         switch(ac.command) {
                             case ARIEL_PERFORM_READ:
                                     createReadEvent(ac.inst.addr, ac.inst.size);
@@ -985,7 +1010,7 @@ void ArielCore::handleReadRequest(ArielReadEvent* rEv) {
     // There is a chance that the non-alignment causes an undetected bug if an access spans multiple malloc regions that are contiguous in VA space but non-contiguous in PA space.
     // However, a single access spanning multiple malloc'd regions shouldn't happen...
     // Addresses mapped via first touch are always line/page aligned
-    const uint64_t physAddr = memmgr->translateAddress(readAddress);
+    const uint64_t physAddr = memmgr->translateCoreAddress(coreID, readAddress);
     const uint64_t addr_offset  = physAddr % ((uint64_t) cacheLineSize);
 
     if((addr_offset + readLength) <= cacheLineSize) {
@@ -1010,7 +1035,7 @@ void ArielCore::handleReadRequest(ArielReadEvent* rEv) {
         const uint64_t rightSize = readLength - leftSize;
 
         const uint64_t physLeftAddr = physAddr;
-        const uint64_t physRightAddr = memmgr->translateAddress(rightAddr);
+        const uint64_t physRightAddr = memmgr->translateCoreAddress(coreID, rightAddr);
 
         ARIEL_CORE_VERBOSE(4, output->verbose(CALL_INFO, 4, 0, "Core %" PRIu32 " issuing split-address read, LeftVAddr=%" PRIu64 ", RightVAddr=%" PRIu64 ", LeftSize=%" PRIu64 ", RightSize=%" PRIu64 ", LeftPhysAddr=%" PRIu64 ", RightPhysAddr=%" PRIu64 "\n",
                             coreID, leftAddr, rightAddr, leftSize, rightSize, physLeftAddr, physRightAddr));
@@ -1056,7 +1081,7 @@ void ArielCore::handleWriteRequest(ArielWriteEvent* wEv) {
     }*/
 
     // See note in handleReadRequest() on alignment issues
-    const uint64_t physAddr = memmgr->translateAddress(writeAddress);
+    const uint64_t physAddr = memmgr->translateCoreAddress(coreID, writeAddress);
     const uint64_t addr_offset  = physAddr % ((uint64_t) cacheLineSize);
 
     // We do not need to perform a split operation
@@ -1093,7 +1118,7 @@ void ArielCore::handleWriteRequest(ArielWriteEvent* wEv) {
         const uint64_t rightSize = writeLength - leftSize;
 
         const uint64_t physLeftAddr = physAddr;
-        const uint64_t physRightAddr = memmgr->translateAddress(rightAddr);
+        const uint64_t physRightAddr = memmgr->translateCoreAddress(coreID, rightAddr);
 
         ARIEL_CORE_VERBOSE(4, output->verbose(CALL_INFO, 4, 0, "Core %" PRIu32 " issuing split-address write, LeftVAddr=%" PRIu64 ", RightVAddr=%" PRIu64 ", LeftSize=%" PRIu64 ", RightSize=%" PRIu64 ", LeftPhysAddr=%" PRIu64 ", RightPhysAddr=%" PRIu64 "\n",
                             coreID, leftAddr, rightAddr, leftSize, rightSize, physLeftAddr, physRightAddr));
@@ -1148,7 +1173,7 @@ void ArielCore::handleFlushEvent(ArielFlushEvent *flEv) {
     const uint64_t virtualAddress = (uint64_t) flEv->getVirtualAddress();
     const uint64_t readLength = (uint64_t) flEv->getLength();
 
-    const uint64_t physAddr = memmgr->translateAddress(virtualAddress);
+    const uint64_t physAddr = memmgr->translateCoreAddress(coreID, virtualAddress);
     commitFlushEvent(physAddr, virtualAddress, (uint32_t) readLength);
 }
 
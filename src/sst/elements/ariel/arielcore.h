@@ -51,6 +51,7 @@
 
 #include "ariel_shmem.h"
 #include "arieltracegen.h"
+#include "arielrecord.h"
 
 #ifdef HAVE_CUDA
 #include "arielgpuev.h"
@@ -255,6 +256,9 @@ class ArielCore : public ComponentExtension {
 
         ArielTraceGenerator* traceGen;
 
+        // Every command read from the tunnel, when recordprefix is set
+        ArielCommandFile* commandRecord;
+
         Statistic<uint64_t>* statReadRequests;
         Statistic<uint64_t>* statWriteRequests;
         Statistic<uint64_t>* statFlushRequests;
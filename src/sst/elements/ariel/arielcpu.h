@@ -75,6 +75,7 @@ class ArielCPU : public SST::Component {
         {"tracePrefix", "Prefix when tracing is enable", ""},
         {"clock", "Clock rate at which events are generated and processed", "1GHz"},
         {"tracegen", "Select the trace generator for Ariel (which records traced memory operations", ""},
+        {"recordprefix", "If set, record every command each core reads from the tunnel to <prefix>-<core>.arielrec, for replay with frontend.replay", ""},
         {"memmgr", "Memory manager to use for address translation", "ariel.MemoryManagerSimple"},
         {"writepayloadtrace", "Trace write payloads and put real memory contents into the memory system", "0"},
         {"instrument_instructions", "turn on or off instruction instrumentation in fesimple", "1"},
@@ -16,6 +16,8 @@
 #include <sst_config.h>
 #include <stdio.h>
 
+#include <iterator>
+
 #include "arielmemmgr_malloc.h"
 
 using namespace SST::ArielComponent;
@@ -82,6 +84,26 @@ ArielMemoryManagerMalloc::ArielMemoryManagerMalloc(ComponentId_t id, Params& par
     }
 
     free(level_buffer);
+
+    // Per-core translation caches are direct mapped on the smallest page size
+    minPageSize = pageSizes[0];
+    maxPageSize = pageSizes[0];
+    for (uint32_t i = 1; i < memoryLevels; ++i) {
+        if (pageSizes[i] < minPageSize) minPageSize = pageSizes[i];
+        if (pageSizes[i] > maxPageSize) maxPageSize = pageSizes[i];
+    }
+
+    coreTranslationShift = 0;
+    while ((UINT64_C(2) << coreTranslationShift) <= minPageSize && coreTranslationShift < 62) {
+        coreTranslationShift++;
+    }
+
+    coreTranslationMask = 0;
+    if (translationCacheEntries > 0) {
+        uint64_t entries = 1;
+        while ((entries << 1) <= translationCacheEntries) entries <<= 1;
+        coreTranslationMask = entries - 1;
+    }
 }
 
 ArielMemoryManagerMalloc::~ArielMemoryManagerMalloc() {
@@ -162,6 +184,12 @@ void ArielMemoryManagerMalloc::allocate(const uint64_t size, const uint32_t leve
     // Record the complete entry in the allocation table (what we allocated in size against the virtual address)
     // this means we know how much to free and can translate the address successfully.
     pageAllocations[level]->insert( std::pair<uint64_t, uint64_t>(virtualAddress, roundedSize) );
+
+    // A page larger than the smallest page size may cover addresses cached
+    // from another level, smaller pages can never overlap an existing one
+    if (pageSize != minPageSize) {
+        invalidateTranslations(virtualAddress, virtualAddress + roundedSize);
+    }
 }
 
 /*
@@ -176,17 +204,18 @@ void ArielMemoryManagerMalloc::allocate(const uint64_t size, const uint32_t leve
 bool ArielMemoryManagerMalloc::allocateMalloc(const uint64_t size, const uint32_t level, const uint64_t virtualAddress, const uint64_t instructionPointer, const uint32_t thread) {
     output->verbose(CALL_INFO, 4, 0, "Allocate malloc received. VA: %" PRIu64 ". Size: %" PRIu64 ". Level: %" PRIu32 ".\n", virtualAddress, size, level);
 
-    // Check whether a malloc mapping already exists (i.e., we missed a free)
-    std::map<uint64_t, uint64_t>::iterator it = mallocTranslations.upper_bound(virtualAddress);
-    if (it == mallocTranslations.begin()) it = mallocTranslations.end();
-    else if (!mallocTranslations.empty()) it--;
+    // Check whether existing malloc mappings overlap this one (i.e., we missed a free)
+    mallocMap_t::iterator it = findMalloc(virtualAddress);
+    if (it == mallocInformation.end()) {
+        it = mallocInformation.lower_bound(virtualAddress);
+    }
 
-    if (it != mallocTranslations.end() && it->first <= virtualAddress) {
-        uint64_t primaryAddr = mallocPrimaryVAMap.find(it->first)->second;
-        if (virtualAddress < primaryAddr + (mallocInformation.find(primaryAddr)->second).size) {
-            output->verbose(CALL_INFO, 4, 0, "Found conflicting malloc, freeing address %" PRIu64 "\n", primaryAddr);
-            freeMalloc(primaryAddr);
-        }
+    while (it != mallocInformation.end() && it->first < virtualAddress + size) {
+        const uint64_t primaryAddr = it->first;
+        it++;
+
+        output->verbose(CALL_INFO, 4, 0, "Found conflicting malloc, freeing address %" PRIu64 "\n", primaryAddr);
+        freeMalloc(primaryAddr);
     }
 
     // Allocate new page(s). Round malloc to nearest whole page TODO fix so we can map partial pages -> needs a local VA->Ariel_VA mapping
@@ -200,24 +229,20 @@ bool ArielMemoryManagerMalloc::allocateMalloc(const uint64_t size, const uint32_
     }
 
     // Allocate the pages
-    std::unordered_set<uint64_t>* virtualPages = new std::unordered_set<uint64_t>;
-    uint64_t nextVirtPage = virtualAddress;
-    uint64_t firstPhysAddr, lastPhysAddr;
-    firstPhysAddr = freePages[level]->front();
+    mallocInfo& info = mallocInformation.insert(std::make_pair(virtualAddress, mallocInfo(size, level))).first->second;
+    info.physPages.reserve(pageCount);
+
     for (uint64_t i = 0; i != pageCount; i++) {
-        uint64_t nextPhysPage = freePages[level]->front();
-        mallocTranslations.insert(std::make_pair(nextVirtPage, nextPhysPage));
-        mallocPrimaryVAMap.insert(std::make_pair(nextVirtPage, virtualAddress));
+        info.physPages.push_back(freePages[level]->front());
         freePages[level]->pop_front();
-        virtualPages->insert(nextVirtPage);
-        nextVirtPage += pageSizes[level];
-        lastPhysAddr = nextPhysPage;
     }
 
-    output->verbose(CALL_INFO, 4, 0, "Malloc mapped %" PRIu64 " to [%" PRIu64 ", %" PRIu64 "] (%" PRIu64 " pages).\n", virtualAddress, firstPhysAddr, lastPhysAddr, pageCount);
+    if (pageCount > 0) {
+        output->verbose(CALL_INFO, 4, 0, "Malloc mapped %" PRIu64 " to [%" PRIu64 ", %" PRIu64 "] (%" PRIu64 " pages).\n", virtualAddress, info.physPages.front(), info.physPages.back(), pageCount);
+    }
 
-    // Record malloc
-    mallocInformation.insert(std::make_pair(virtualAddress, mallocInfo(size, level, virtualPages)));
+    // The malloc takes precedence over any demand pages cached for its range
+    invalidateTranslations(virtualAddress, virtualAddress + size);
 
     statBytesAlloc[level]->addData(size);
     return true;
@@ -228,26 +253,69 @@ void ArielMemoryManagerMalloc::freeMalloc(const uint64_t virtualAddress) {
     output->verbose(CALL_INFO, 4, 0, "Freeing %" PRIu64 "\n", virtualAddress);
 
     // Lookup VA in mallocInformation
-    std::map<uint64_t, mallocInfo>::iterator it = mallocInformation.find(virtualAddress);
+    mallocMap_t::iterator it = mallocInformation.find(virtualAddress);
     if (it == mallocInformation.end()) return;
 
     statBytesFree[it->second.level]->addData(it->second.size);
 
-    // Free each VA in mallocInformation from mallocTranslations & mallocPrimaryVAMap TODO fix so that mapping stays but address is available for future mallocs
-    std::unordered_set<uint64_t>* myKeys = (it->second.VAKeys);
-    for (std::unordered_set<uint64_t>::iterator vaIt = myKeys->begin(); vaIt != myKeys->end(); vaIt++) {
-        mallocPrimaryVAMap.erase(*vaIt);
-        freePages[(it->second).level]->push_front(mallocTranslations.find(*vaIt)->second);
-        mallocTranslations.erase(*vaIt);
+    // Return the pages so that the next allocation gets them back in the same order TODO fix so that mapping stays but address is available for future mallocs
+    std::vector<uint64_t>& pages = it->second.physPages;
+    for (std::vector<uint64_t>::reverse_iterator pageIt = pages.rbegin(); pageIt != pages.rend(); pageIt++) {
+        freePages[it->second.level]->push_front(*pageIt);
     }
 
-    // Remove mallocInformation entry
-    delete myKeys;
-    mallocInformation.erase(virtualAddress);
+    const uint64_t mallocEnd = virtualAddress + it->second.size;
+    mallocInformation.erase(it);
+
+    statTranslationShootdown->addData(1);
+    invalidateTranslations(virtualAddress, mallocEnd);
+}
+
+
+/*
+ *  Find the malloc containing virtAddr, if any
+ */
+ArielMemoryManagerMalloc::mallocMap_t::iterator ArielMemoryManagerMalloc::findMalloc(const uint64_t virtAddr) {
+    mallocMap_t::iterator it = mallocInformation.upper_bound(virtAddr);
+    if (it == mallocInformation.begin()) return mallocInformation.end();
+
+    it--;
+    if (virtAddr < it->first + it->second.size) return it;
+
+    return mallocInformation.end();
+}
+
+
+/*
+ *  Drop every core's cached translations that overlap [start, end), used when
+ *  a mapping goes away or a new one takes precedence over existing ones.
+ *  An entry is never larger than the largest page and is stored in the slot
+ *  of an address it covers, so only the slots around the range need a look.
+ */
+void ArielMemoryManagerMalloc::invalidateTranslations(const uint64_t start, const uint64_t end) {
+    const uint64_t firstSlot = (start > maxPageSize ? start - maxPageSize : 0) >> coreTranslationShift;
+    const uint64_t lastSlot = (end + maxPageSize) >> coreTranslationShift;
+    const uint64_t slotCount = (lastSlot - firstSlot) > coreTranslationMask ? (coreTranslationMask + 1) : (lastSlot - firstSlot + 1);
+
+    for (std::vector<translationEntry>& cache : coreTranslations) {
+        for (uint64_t i = 0; i < slotCount; i++) {
+            translationEntry& entry = cache[(firstSlot + i) & coreTranslationMask];
+
+            if (entry.vBase < end && start < entry.vLimit) {
+                entry.vBase = 0;
+                entry.vLimit = 0;
+            }
+        }
+    }
 }
 
 
 uint64_t ArielMemoryManagerMalloc::translateAddress(uint64_t virtAddr) {
+    return translateCoreAddress(0, virtAddr);
+}
+
+
+uint64_t ArielMemoryManagerMalloc::translateCoreAddress(const uint32_t core, uint64_t virtAddr) {
     // If translation is disabled, then just return address
     if( ! translationEnabled ) {
         return virtAddr;
@@ -256,95 +324,127 @@ uint64_t ArielMemoryManagerMalloc::translateAddress(uint64_t virtAddr) {
     // Keep track of how many translations we are performing
     statTranslationQueries->addData(1);
 
-    uint64_t physAddr = (uint64_t) -1;
-    bool found = false;
-
     output->verbose(CALL_INFO, 4, 0, "Page Table: translate virtual address %" PRIu64 "\n", virtAddr);
 
-    // Check the translation cache otherwise carry on
-    auto checkCache = translationCache->find(virtAddr);
-    if(checkCache != translationCache->end()) {
+    if (translationCacheEntries == 0) {
+        translationEntry unused;
+        return translateMiss(virtAddr, unused);
+    }
+
+    if (coreTranslations.size() <= core) {
+        translationEntry invalid = { 0, 0, 0 };
+        coreTranslations.resize(core + 1, std::vector<translationEntry>(coreTranslationMask + 1, invalid));
+    }
+
+    // Check this core's translation cache otherwise carry on
+    translationEntry& entry = coreTranslations[core][(virtAddr >> coreTranslationShift) & coreTranslationMask];
+
+    if (entry.vBase <= virtAddr && virtAddr < entry.vLimit) {
         statTranslationCacheHits->addData(1);
-        return checkCache->second;
+        return entry.pBase + (virtAddr - entry.vBase);
+    }
+
+    if (entry.vLimit != 0) {
+        statTranslationCacheEvict->addData(1);
     }
 
+    return translateMiss(virtAddr, entry);
+}
+
+
+/*
+ *  Walk the malloc mappings and then the demand page tables. Fills entry with
+ *  the largest range around virtAddr that translates with the same offset.
+ */
+uint64_t ArielMemoryManagerMalloc::translateMiss(const uint64_t virtAddr, translationEntry& entry) {
     // Check malloc mappings
-    if (!mallocTranslations.empty()) {
-        std::map<uint64_t, uint64_t>::iterator it = mallocTranslations.upper_bound(virtAddr);
-        if (it == mallocTranslations.begin()) it = mallocTranslations.end();
-        else it--;
-
-        if (it != mallocTranslations.end() && (it->first <= virtAddr)) {
-            uint64_t primaryAddr = mallocPrimaryVAMap.find(it->first)->second;
-            if (virtAddr < (primaryAddr + (mallocInformation.find(primaryAddr)->second).size)) {
-                uint64_t offset = virtAddr - it->first;
-                physAddr = offset + it->second;
-                found = true;
-            }
-        }
+    mallocMap_t::iterator mallocIt = findMalloc(virtAddr);
+
+    if (mallocIt != mallocInformation.end()) {
+        const uint64_t pageSize = pageSizes[mallocIt->second.level];
+        const uint64_t pageIndex = (virtAddr - mallocIt->first) / pageSize;
+        const uint64_t pageStart = mallocIt->first + (pageIndex * pageSize);
+        const uint64_t mallocEnd = mallocIt->first + mallocIt->second.size;
+
+        entry.vBase = pageStart;
+        entry.vLimit = (pageStart + pageSize) < mallocEnd ? (pageStart + pageSize) : mallocEnd;
+        entry.pBase = mallocIt->second.physPages[pageIndex];
+
+        return entry.pBase + (virtAddr - pageStart);
     }
 
     // We will have to search every memory level to find where the address lies
     for(uint32_t i = 0; i < memoryLevels; ++i) {
-        if (!found) {
         std::unordered_map<uint64_t, uint64_t>::iterator page_itr;
         const uint64_t pageSize = pageSizes[i];
-            const uint64_t page_offset = virtAddr % pageSize;
+        const uint64_t page_offset = virtAddr % pageSize;
         const uint64_t page_start = virtAddr - page_offset;
 
         page_itr = pageTables[i]->find(page_start);
 
-            if (page_itr != pageTables[i]->end()) {
-                // Located
-            physAddr = page_itr->second + page_offset;
+        if (page_itr != pageTables[i]->end()) {
+            // Located
+            const uint64_t physAddr = page_itr->second + page_offset;
 
-                output->verbose(CALL_INFO, 4, 0, "Page table hit: virtual address=%" PRIu64 " hit in level: %" PRIu32 ", virtual page start=%" PRIu64 ", virtual end=%" PRIu64 ", translates to phys page start=%" PRIu64 " translates to: phys address: %" PRIu64 " (offset added to phys start=%" PRIu64 ")\n",
-                    virtAddr, i, page_itr->first, page_itr->first + pageSize, page_itr->second, physAddr, page_offset);
+            output->verbose(CALL_INFO, 4, 0, "Page table hit: virtual address=%" PRIu64 " hit in level: %" PRIu32 ", virtual page start=%" PRIu64 ", virtual end=%" PRIu64 ", translates to phys page start=%" PRIu64 " translates to: phys address: %" PRIu64 " (offset added to phys start=%" PRIu64 ")\n",
+                virtAddr, i, page_itr->first, page_itr->first + pageSize, page_itr->second, physAddr, page_offset);
 
-            found = true;
-            break;
-        }
-        } else {
-            break;
+            // Only cache the smallest page around the address (a smaller page
+            // in another level could cover the rest) and not the parts of it
+            // that a malloc takes over
+            const uint64_t block_start = virtAddr - (virtAddr % minPageSize);
+            entry.vBase = block_start > page_start ? block_start : page_start;
+            entry.vLimit = (block_start + minPageSize) < (page_start + pageSize) ? (block_start + minPageSize) : (page_start + pageSize);
+
+            mallocMap_t::iterator nextMalloc = mallocInformation.upper_bound(virtAddr);
+            if (nextMalloc != mallocInformation.end() && nextMalloc->first < entry.vLimit) {
+                entry.vLimit = nextMalloc->first;
+            }
+
+            if (nextMalloc != mallocInformation.begin()) {
+                mallocMap_t::iterator prevMalloc = std::prev(nextMalloc);
+                const uint64_t prevEnd = prevMalloc->first + prevMalloc->second.size;
+                if (prevEnd > entry.vBase) {
+                    entry.vBase = prevEnd;
+                }
+            }
+
+            entry.pBase = page_itr->second + (entry.vBase - page_start);
+            return physAddr;
         }
     }
 
-    if(found) {
-        cacheTranslation(virtAddr, physAddr);
-        return physAddr;
+    output->verbose(CALL_INFO, 4, 0, "Page table miss for virtual address: %" PRIu64 "\n", virtAddr);
+
+    // We did not find the address in memory, that means we should allocate it one from our default pool
+    uint64_t offset = virtAddr % pageSizes[defaultLevel];
+
+    output->verbose(CALL_INFO, 4, 0, "Page offset calculation (generating a new page allocation request) for address %" PRIu64 ", offset=%" PRIu64 ", requesting virtual map to address: %" PRIu64 "\n",
+            virtAddr, offset, (virtAddr - offset));
+
+    // Perform an allocation so we can then re-find the address
+    // Attempt defaultLevel but fall through to other levels if needed/available
+    if (canAllocateInLevel(8, defaultLevel)) {
+        allocate(8, defaultLevel, virtAddr - offset);
     } else {
-        output->verbose(CALL_INFO, 4, 0, "Page table miss for virtual address: %" PRIu64 "\n", virtAddr);
-
-        // We did not find the address in memory, that means we should allocate it one from our default pool
-        uint64_t offset = virtAddr % pageSizes[defaultLevel];
-
-        output->verbose(CALL_INFO, 4, 0, "Page offset calculation (generating a new page allocation request) for address %" PRIu64 ", offset=%" PRIu64 ", requesting virtual map to address: %" PRIu64 "\n",
-                virtAddr, offset, (virtAddr - offset));
-
-        // Perform an allocation so we can then re-find the address
-        // Attempt defaultLevel but fall through to other levels if needed/available
-            if (canAllocateInLevel(8, defaultLevel)) {
-                allocate(8, defaultLevel, virtAddr - offset);
-            } else {
-                bool allocated = false;
-                for (uint32_t i = 0; i < memoryLevels; i++) {
-                    if (canAllocateInLevel(8, i)) {
-                        offset = virtAddr % pageSizes[i];
-                        allocate(8, i, virtAddr - offset);
-                        allocated = true;
-                        break;
-                    }
-                }
-                if (!allocated) output->fatal(CALL_INFO, -1, "Attempted to allocate page for address %" PRIu64 " but no free pages are available\n", virtAddr);
+        bool allocated = false;
+        for (uint32_t i = 0; i < memoryLevels; i++) {
+            if (canAllocateInLevel(8, i)) {
+                offset = virtAddr % pageSizes[i];
+                allocate(8, i, virtAddr - offset);
+                allocated = true;
+                break;
             }
+        }
+        if (!allocated) output->fatal(CALL_INFO, -1, "Attempted to allocate page for address %" PRIu64 " but no free pages are available\n", virtAddr);
+    }
 
-        // Now attempt to refind it
-        const uint64_t newPhysAddr = translateAddress(virtAddr);
+    // Now attempt to refind it
+    const uint64_t newPhysAddr = translateMiss(virtAddr, entry);
 
-        output->verbose(CALL_INFO, 4, 0, "Page allocation routine mapped to address: %" PRIu64 "\n", newPhysAddr );
+    output->verbose(CALL_INFO, 4, 0, "Page allocation routine mapped to address: %" PRIu64 "\n", newPhysAddr );
 
-        return newPhysAddr;
-    }
+    return newPhysAddr;
 }
 
 void ArielMemoryManagerMalloc::printStats() {
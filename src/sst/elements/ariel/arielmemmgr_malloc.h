@@ -24,6 +24,7 @@
 
 #include <stdint.h>
 #include <deque>
+#include <map>
 #include <vector>
 #include <unordered_map>
 
@@ -67,6 +68,7 @@ class ArielMemoryManagerMalloc : public ArielMemoryManagerCache {
         uint32_t getDefaultPool();
 
         uint64_t translateAddress(uint64_t virtAddr);
+        uint64_t translateCoreAddress(const uint32_t core, uint64_t virtAddr);
         void printStats();
 
         void freeMalloc(const uint64_t vAddr);
@@ -79,13 +81,37 @@ class ArielMemoryManagerMalloc : public ArielMemoryManagerCache {
         struct mallocInfo {
             uint64_t size;
             uint32_t level;
-            std::unordered_set<uint64_t>* VAKeys;
-            mallocInfo(uint64_t size, uint32_t level, std::unordered_set<uint64_t>* VAKeys) : size(size), level(level), VAKeys(VAKeys) {};
+            std::vector<uint64_t> physPages;    // Physical page backing each page of the malloc, in VA order
+            mallocInfo(uint64_t size, uint32_t level) : size(size), level(level) {};
         };
 
-        std::map<uint64_t, uint64_t> mallocPrimaryVAMap;    // Map VA of each PA to the primary VA of the malloc -> used to find the mallocInfo
-        std::map<uint64_t, uint64_t> mallocTranslations;    // Map VA to PA for mallocs -> primary lookup
-        std::map<uint64_t, mallocInfo> mallocInformation;   // Map mallocID to information about the malloc -> use for frees/allocs
+        /*
+         * One entry of a core's direct-mapped translation cache. The entry
+         * maps every address in [vBase, vLimit) to the same offset in a
+         * physical page, so one entry covers a whole page (or the part of
+         * it that no other mapping takes precedence over). An empty range
+         * marks an invalid entry.
+         */
+        struct translationEntry {
+            uint64_t vBase;
+            uint64_t vLimit;
+            uint64_t pBase;
+        };
+
+        typedef std::map<uint64_t, mallocInfo> mallocMap_t;
+
+        mallocMap_t::iterator findMalloc(const uint64_t virtAddr);
+        uint64_t translateMiss(const uint64_t virtAddr, translationEntry& entry);
+        void invalidateTranslations(const uint64_t start, const uint64_t end);
+
+        mallocMap_t mallocInformation;    // Map primary VA of each malloc to its pages, mallocs never overlap
+
+        // Per-core translation caches, indexed by virtual address on the smallest page size
+        std::vector<std::vector<translationEntry> > coreTranslations;
+        uint64_t coreTranslationMask;
+        uint32_t coreTranslationShift;
+        uint64_t minPageSize;
+        uint64_t maxPageSize;
 
         uint32_t defaultLevel;
         uint32_t memoryLevels;
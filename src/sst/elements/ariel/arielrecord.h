@@ -0,0 +1,249 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_SST_ARIEL_RECORD
+#define _H_SST_ARIEL_RECORD
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <string>
+
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+#include "ariel_shmem.h"
+
+namespace SST {
+namespace ArielComponent {
+
+#define ARIEL_RECORD_MAGIC   "ARIELREC"
+#define ARIEL_RECORD_VERSION 1
+
+/*
+ * One core's ArielCommand stream as written by ariel's recordprefix option
+ * and read back by the arielreplay tool (frontend.replay).
+ *
+ * The file starts with the 8 byte magic and a uint32_t version. Every
+ * command is then a one byte command code followed by the fields Ariel
+ * uses for that command, in host byte order:
+ *
+ *   START_INSTRUCTION  instClass (u32), simdElemCount (u32)
+ *   PERFORM_READ       addr (u64), size (u32)
+ *   PERFORM_WRITE      addr (u64), size (u32), min(size, 64) payload bytes
+ *   FLUSHLINE          vaddr (u64)
+ *   ISSUE_TLM_MAP      vaddr (u64), alloc_len (u64), alloc_level (u32), instPtr (u64)
+ *   ISSUE_TLM_MMAP     fileID (u32), vaddr (u64), alloc_len (u64), alloc_level (u32), instPtr (u64)
+ *   ISSUE_TLM_FREE     vaddr (u64)
+ *   SWITCH_POOL        pool (u32)
+ *   END_INSTRUCTION, NOOP, FENCE_INSTRUCTION, PERFORM_EXIT, OUTPUT_STATS
+ *                      nothing
+ *   anything else      the whole ArielCommand
+ *
+ * Files are gzip compressed when built with libz, reading also accepts
+ * uncompressed files.
+ */
+class ArielCommandFile {
+public:
+    ArielCommandFile() : file(NULL) {
+#ifdef HAVE_LIBZ
+        gzFileHandle = NULL;
+#endif
+    }
+
+    ~ArielCommandFile() {
+        close();
+    }
+
+    static std::string getFileName(const std::string& prefix, const uint32_t core) {
+        char suffix[32];
+        snprintf(suffix, sizeof(suffix), "-%" PRIu32 ".arielrec", core);
+        return prefix + suffix;
+    }
+
+    bool openWrite(const std::string& path) {
+#ifdef HAVE_LIBZ
+        gzFileHandle = gzopen(path.c_str(), "wb1");
+        if (NULL == gzFileHandle) {
+            return false;
+        }
+#else
+        file = fopen(path.c_str(), "wb");
+        if (NULL == file) {
+            return false;
+        }
+#endif
+        uint32_t version = ARIEL_RECORD_VERSION;
+        return put(ARIEL_RECORD_MAGIC, 8) && put(&version, sizeof(version));
+    }
+
+    // Returns false if the file cannot be opened or is not a command record
+    bool openRead(const std::string& path) {
+#ifdef HAVE_LIBZ
+        gzFileHandle = gzopen(path.c_str(), "rb");
+        if (NULL == gzFileHandle) {
+            return false;
+        }
+        gzbuffer(gzFileHandle, 1 << 20);
+#else
+        file = fopen(path.c_str(), "rb");
+        if (NULL == file) {
+            return false;
+        }
+#endif
+        char magic[8];
+        uint32_t version = 0;
+
+        return get(magic, 8) && 0 == memcmp(magic, ARIEL_RECORD_MAGIC, 8) &&
+            get(&version, sizeof(version)) && ARIEL_RECORD_VERSION == version;
+    }
+
+    void close() {
+#ifdef HAVE_LIBZ
+        if (NULL != gzFileHandle) {
+            gzclose(gzFileHandle);
+            gzFileHandle = NULL;
+        }
+#endif
+        if (NULL != file) {
+            fclose(file);
+            file = NULL;
+        }
+    }
+
+    bool write(const ArielCommand& ac) {
+        const uint8_t cmd = (uint8_t) ac.command;
+        bool ok = put(&cmd, sizeof(cmd));
+
+        switch (ac.command) {
+        case ARIEL_START_INSTRUCTION:
+            ok = ok && put(&ac.inst.instClass, sizeof(uint32_t)) && put(&ac.inst.simdElemCount, sizeof(uint32_t));
+            break;
+        case ARIEL_PERFORM_READ:
+            ok = ok && put(&ac.inst.addr, sizeof(uint64_t)) && put(&ac.inst.size, sizeof(uint32_t));
+            break;
+        case ARIEL_PERFORM_WRITE:
+            ok = ok && put(&ac.inst.addr, sizeof(uint64_t)) && put(&ac.inst.size, sizeof(uint32_t)) &&
+                put(&ac.inst.payload[0], payloadLength(ac.inst.size));
+            break;
+        case ARIEL_FLUSHLINE_INSTRUCTION:
+            ok = ok && put(&ac.flushline.vaddr, sizeof(uint64_t));
+            break;
+        case ARIEL_ISSUE_TLM_MAP:
+            ok = ok && put(&ac.mlm_map.vaddr, sizeof(uint64_t)) && put(&ac.mlm_map.alloc_len, sizeof(uint64_t)) &&
+                put(&ac.mlm_map.alloc_level, sizeof(uint32_t)) && put(&ac.instPtr, sizeof(uint64_t));
+            break;
+        case ARIEL_ISSUE_TLM_MMAP:
+            ok = ok && put(&ac.mlm_mmap.fileID, sizeof(uint32_t)) && put(&ac.mlm_mmap.vaddr, sizeof(uint64_t)) &&
+                put(&ac.mlm_mmap.alloc_len, sizeof(uint64_t)) && put(&ac.mlm_mmap.alloc_level, sizeof(uint32_t)) &&
+                put(&ac.instPtr, sizeof(uint64_t));
+            break;
+        case ARIEL_ISSUE_TLM_FREE:
+            ok = ok && put(&ac.mlm_free.vaddr, sizeof(uint64_t));
+            break;
+        case ARIEL_SWITCH_POOL:
+            ok = ok && put(&ac.switchPool.pool, sizeof(uint32_t));
+            break;
+        case ARIEL_END_INSTRUCTION:
+        case ARIEL_NOOP:
+        case ARIEL_FENCE_INSTRUCTION:
+        case ARIEL_PERFORM_EXIT:
+        case ARIEL_OUTPUT_STATS:
+            break;
+        default:
+            ok = ok && put(&ac, sizeof(ArielCommand));
+            break;
+        }
+
+        return ok;
+    }
+
+    // Returns false at the end of the file
+    bool read(ArielCommand& ac) {
+        uint8_t cmd;
+
+        if (!get(&cmd, sizeof(cmd))) {
+            return false;
+        }
+
+        memset(&ac, 0, sizeof(ArielCommand));
+        ac.command = (ArielShmemCmd_t) cmd;
+
+        switch (ac.command) {
+        case ARIEL_START_INSTRUCTION:
+            return get(&ac.inst.instClass, sizeof(uint32_t)) && get(&ac.inst.simdElemCount, sizeof(uint32_t));
+        case ARIEL_PERFORM_READ:
+            return get(&ac.inst.addr, sizeof(uint64_t)) && get(&ac.inst.size, sizeof(uint32_t));
+        case ARIEL_PERFORM_WRITE:
+            return get(&ac.inst.addr, sizeof(uint64_t)) && get(&ac.inst.size, sizeof(uint32_t)) &&
+                get(&ac.inst.payload[0], payloadLength(ac.inst.size));
+        case ARIEL_FLUSHLINE_INSTRUCTION:
+            return get(&ac.flushline.vaddr, sizeof(uint64_t));
+        case ARIEL_ISSUE_TLM_MAP:
+            return get(&ac.mlm_map.vaddr, sizeof(uint64_t)) && get(&ac.mlm_map.alloc_len, sizeof(uint64_t)) &&
+                get(&ac.mlm_map.alloc_level, sizeof(uint32_t)) && get(&ac.instPtr, sizeof(uint64_t));
+        case ARIEL_ISSUE_TLM_MMAP:
+            return get(&ac.mlm_mmap.fileID, sizeof(uint32_t)) && get(&ac.mlm_mmap.vaddr, sizeof(uint64_t)) &&
+                get(&ac.mlm_mmap.alloc_len, sizeof(uint64_t)) && get(&ac.mlm_mmap.alloc_level, sizeof(uint32_t)) &&
+                get(&ac.instPtr, sizeof(uint64_t));
+        case ARIEL_ISSUE_TLM_FREE:
+            return get(&ac.mlm_free.vaddr, sizeof(uint64_t));
+        case ARIEL_SWITCH_POOL:
+            return get(&ac.switchPool.pool, sizeof(uint32_t));
+        case ARIEL_END_INSTRUCTION:
+        case ARIEL_NOOP:
+        case ARIEL_FENCE_INSTRUCTION:
+        case ARIEL_PERFORM_EXIT:
+        case ARIEL_OUTPUT_STATS:
+            return true;
+        default:
+            return get(&ac, sizeof(ArielCommand)) && ac.command == (ArielShmemCmd_t) cmd;
+        }
+    }
+
+private:
+    static size_t payloadLength(const uint32_t size) {
+        return size < ARIEL_MAX_PAYLOAD_SIZE ? size : ARIEL_MAX_PAYLOAD_SIZE;
+    }
+
+    bool put(const void* data, const size_t length) {
+#ifdef HAVE_LIBZ
+        return gzwrite(gzFileHandle, data, (unsigned) length) == (int) length;
+#else
+        return fwrite(data, 1, length, file) == length;
+#endif
+    }
+
+    bool get(void* data, const size_t length) {
+#ifdef HAVE_LIBZ
+        return gzread(gzFileHandle, data, (unsigned) length) == (int) length;
+#else
+        return fread(data, 1, length, file) == length;
+#endif
+    }
+
+    FILE* file;
+#ifdef HAVE_LIBZ
+    gzFile gzFileHandle;
+#endif
+};
+
+}
+}
+
+#endif
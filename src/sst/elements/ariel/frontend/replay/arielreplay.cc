@@ -0,0 +1,147 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+/*
+ * arielreplay attaches to an Ariel tunnel in place of the Pin tool and
+ * writes the command streams recorded with ariel's recordprefix option
+ * back into it, one thread per core, as fast as the simulator drains them.
+ * It is launched by the frontend.replay subcomponent.
+ */
+
+#include <sst_config.h>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <thread>
+#include <vector>
+
+#include "ariel_shmem.h"
+#include "arielrecord.h"
+
+using namespace SST::ArielComponent;
+
+struct ReplayStream {
+    std::string path;
+    uint64_t    commands;
+    bool        failed;
+};
+
+static void replayCore(ArielTunnel* tunnel, const uint32_t core, ReplayStream* stream)
+{
+    ArielCommandFile file;
+    ArielCommand ac;
+
+    stream->commands = 0;
+    stream->failed = !file.openRead(stream->path);
+
+    if (stream->failed) {
+        return;
+    }
+
+    while (file.read(ac)) {
+        // The exit is sent once every core has been replayed, otherwise
+        // core 0 could stop the simulation while the others are still busy
+        if (ARIEL_PERFORM_EXIT == ac.command) {
+            continue;
+        }
+
+        tunnel->writeMessage(core, ac);
+        stream->commands++;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 4) {
+        fprintf(stderr, "Usage: %s <tunnel file> <record prefix> <core count>\n", argv[0]);
+        return -1;
+    }
+
+    const char* tunnel_file = argv[1];
+    const std::string prefix(argv[2]);
+    const uint32_t core_count = (uint32_t) strtoul(argv[3], NULL, 10);
+
+    int fd = open(tunnel_file, O_RDWR);
+    if (fd < 0) {
+        fprintf(stderr, "ARIEL-REPLAY: Unable to open tunnel file %s: %s\n", tunnel_file, strerror(errno));
+        return -1;
+    }
+
+    struct stat tunnel_stat;
+    if (0 != fstat(fd, &tunnel_stat)) {
+        fprintf(stderr, "ARIEL-REPLAY: Unable to stat tunnel file %s: %s\n", tunnel_file, strerror(errno));
+        return -1;
+    }
+
+    void* region = mmap(NULL, tunnel_stat.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (MAP_FAILED == region) {
+        fprintf(stderr, "ARIEL-REPLAY: Unable to map tunnel file %s: %s\n", tunnel_file, strerror(errno));
+        return -1;
+    }
+
+    ArielTunnel* tunnel = new ArielTunnel(region);
+    tunnel->initialize(region);
+
+    if (core_count > tunnel->getNumBuffers()) {
+        fprintf(stderr, "ARIEL-REPLAY: Record has %" PRIu32 " cores but the tunnel only has %" PRIu32 "\n",
+            core_count, (uint32_t) tunnel->getNumBuffers());
+        return -1;
+    }
+
+    std::vector<ReplayStream> streams(core_count);
+    std::vector<std::thread> threads;
+
+    for (uint32_t i = 0; i < core_count; i++) {
+        streams[i].path = ArielCommandFile::getFileName(prefix, i);
+        threads.push_back(std::thread(replayCore, tunnel, i, &streams[i]));
+    }
+
+    uint64_t total = 0;
+
+    for (uint32_t i = 0; i < core_count; i++) {
+        threads[i].join();
+
+        if (streams[i].failed) {
+            fprintf(stderr, "ARIEL-REPLAY: Unable to read a command record from %s, core %" PRIu32 " is idle\n",
+                streams[i].path.c_str(), i);
+        }
+
+        total += streams[i].commands;
+    }
+
+    fprintf(stderr, "ARIEL-REPLAY: Replayed %" PRIu64 " commands on %" PRIu32 " cores, shutting down.\n",
+        total, core_count);
+
+    ArielCommand ac;
+    memset(&ac, 0, sizeof(ac));
+    ac.command = ARIEL_PERFORM_EXIT;
+    ac.instPtr = (uint64_t) 0;
+    tunnel->writeMessage(0, ac);
+
+    delete tunnel;
+    munmap(region, tunnel_stat.st_size);
+
+    return 0;
+}
@@ -0,0 +1,163 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+
+#include "replayfrontend.h"
+#include "arielrecord.h"
+
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#define ARIEL_INNER_STRINGIZE(input) #input
+#define ARIEL_STRINGIZE(input) ARIEL_INNER_STRINGIZE(input)
+
+using namespace SST::ArielComponent;
+
+ArielReplayFrontend::ArielReplayFrontend(ComponentId_t id, Params& params, uint32_t cores, uint32_t maxCoreQueueLen, uint32_t defMemPool) :
+            ArielFrontend(id, params, cores, maxCoreQueueLen, defMemPool) {
+
+    int verbosity = params.find<int>("verbose", 0);
+    output = new SST::Output("ArielReplayFrontend[@f:@l:@p] ", verbosity, 0, SST::Output::STDOUT);
+
+    core_count = cores;
+    child_pid = 0;
+
+    recordPrefix = params.find<std::string>("recordprefix", "");
+    if("" == recordPrefix) {
+        output->fatal(CALL_INFO, -1, "The recordprefix parameter naming the recorded command files was not specified\n");
+    }
+
+    replayTool = params.find<std::string>("replaytool", std::string(ARIEL_STRINGIZE(ARIEL_TOOL_DIR)) + "/arielreplay");
+
+    for(uint32_t i = 0; i < core_count; i++) {
+        const std::string path = ArielCommandFile::getFileName(recordPrefix, i);
+
+        if(0 != access(path.c_str(), R_OK)) {
+            output->verbose(CALL_INFO, 1, 0, "No record for core %" PRIu32 " (%s), core will stay idle\n", i, path.c_str());
+        }
+    }
+
+    tunnelmgr = new SST::Core::Interprocess::MMAPParent<ArielTunnel>(id, core_count, maxCoreQueueLen);
+
+    regionName = tunnelmgr->getRegionName();
+    tunnel = tunnelmgr->getTunnel();
+    output->verbose(CALL_INFO, 1, 0, "Base pipe name: %s\n", regionName.c_str());
+}
+
+void ArielReplayFrontend::init(unsigned int phase)
+{
+    if ( phase == 0 ) {
+        output->verbose(CALL_INFO, 1, 0, "Launching %s...\n", replayTool.c_str());
+        child_pid = forkReplayChild();
+
+        // Nothing was launched when only initializing the simulation
+        if (child_pid != 0) {
+            tunnel->waitForChild();
+            output->verbose(CALL_INFO, 1, 0, "Child has attached!\n");
+        }
+    }
+}
+
+void ArielReplayFrontend::finish() {
+    // The simulation may stop before the whole record was replayed
+    if (child_pid != 0) {
+        kill(child_pid, SIGKILL);
+    }
+}
+
+ArielTunnel* ArielReplayFrontend::getTunnel() {
+    return tunnel;
+}
+
+int ArielReplayFrontend::forkReplayChild() {
+    // If user only wants to init the simulation then we do NOT fork the binary
+    if(isSimulationRunModeInit())
+        return 0;
+
+    char core_buffer[16];
+    snprintf(core_buffer, sizeof(core_buffer), "%" PRIu32, core_count);
+
+    char* args[5];
+    args[0] = const_cast<char*>(replayTool.c_str());
+    args[1] = const_cast<char*>(regionName.c_str());
+    args[2] = const_cast<char*>(recordPrefix.c_str());
+    args[3] = core_buffer;
+    args[4] = NULL;
+
+    output->verbose(CALL_INFO, 1, 0, "Executing: %s %s %s %s\n", args[0], args[1], args[2], args[3]);
+
+    pid_t the_child = fork();
+    if ( the_child < 0 ) {
+        perror("fork");
+        output->fatal(CALL_INFO, 1, "Fork failed to launch the replay process. errno = %d, errstr = %s\n", errno, strerror(errno));
+    }
+
+    if(the_child != 0) {
+        child_pid = the_child;
+
+        /* Wait a second, and check to see that the child actually started */
+        sleep(1);
+        int pstat;
+        pid_t check = waitpid(the_child, &pstat, WNOHANG);
+        if ( check > 0 ) {
+            if (WIFEXITED(pstat) == true) {
+                output->fatal(CALL_INFO, 1,
+                        "Launching replay child failed!  Child Exited with status %d\n",
+                        WEXITSTATUS(pstat));
+            } else if (WIFSIGNALED(pstat) == true) {
+                output->fatal(CALL_INFO, 1,
+                        "Launching replay child failed!  Child Terminated With Signal %d\n",
+                        WTERMSIG(pstat));
+            } else {
+                output->fatal(CALL_INFO, 1,
+                        "Launching replay child failed!  Unknown Problem; pstat = %d\n",
+                        pstat);
+            }
+        } else if ( check < 0 ) {
+            perror("waitpid");
+            output->fatal(CALL_INFO, 1,
+                    "Waitpid returned an error, errno = %d.  Did the child ever even start?\n", errno);
+        }
+
+        return (int) the_child;
+    }
+
+    execvp(args[0], args);
+    perror("execvp");
+    output->fatal(CALL_INFO, -1, "Error executing: %s\n", args[0]);
+
+    return 0;
+}
+
+ArielReplayFrontend::~ArielReplayFrontend() {
+    delete tunnelmgr;
+}
+
+void ArielReplayFrontend::emergencyShutdown() {
+    // If child_pid = 0, dont kill (this would kill all processes of the group)
+    if (child_pid != 0) {
+        kill(child_pid, SIGKILL);
+    }
+
+    delete tunnelmgr; // Clean up tmp file
+    tunnelmgr = NULL;
+}
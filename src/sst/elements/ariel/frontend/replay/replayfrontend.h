@@ -0,0 +1,78 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_ARIEL_REPLAY_FRONTEND
+#define _H_ARIEL_REPLAY_FRONTEND
+
+#include <sst/core/sst_config.h>
+#include <sst/core/component.h>
+#include <sst/core/params.h>
+#include <sst/core/interprocess/mmapparent.h>
+
+#include <stdint.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "arielfrontend.h"
+#include "ariel_shmem.h"
+
+namespace SST {
+namespace ArielComponent {
+
+/** Feeds command streams recorded with ariel's recordprefix parameter
+ * back into the tunnel, so a workload can be re-run without Pin.
+ */
+class ArielReplayFrontend : public ArielFrontend {
+    public:
+
+    /* SST ELI */
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(ArielReplayFrontend, "ariel", "frontend.replay", SST_ELI_ELEMENT_VERSION(1,0,0), "Ariel frontend that replays recorded per-core command streams", SST::ArielComponent::ArielFrontend)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"verbose", "Verbosity for debugging. Increased numbers for increased verbosity.", "0"},
+        {"recordprefix", "Prefix of the recorded command files, core N is read from <prefix>-N.arielrec", ""},
+        {"replaytool", "Path to the arielreplay program", "<libexecdir>/arielreplay"})
+
+        /* Ariel class */
+        ArielReplayFrontend(ComponentId_t id, Params& params, uint32_t cores, uint32_t qSize, uint32_t memPool);
+        ~ArielReplayFrontend();
+        virtual void emergencyShutdown();
+        virtual void init(unsigned int phase);
+        virtual void finish();
+        virtual ArielTunnel* getTunnel();
+
+    private:
+
+        int forkReplayChild();
+
+        SST::Output* output;
+
+        pid_t child_pid;
+
+        uint32_t core_count;
+        SST::Core::Interprocess::MMAPParent<ArielTunnel>* tunnelmgr;
+
+        ArielTunnel* tunnel;
+
+        std::string replayTool;
+        std::string recordPrefix;
+        std::string regionName;
+};
+
+}
+}
+
+#endif
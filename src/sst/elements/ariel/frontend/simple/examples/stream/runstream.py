@@ -13,6 +13,11 @@ else:
 if not os.path.exists(app):
     app = os.getenv( "OMP_EXE" )
 
+# Record the command stream each core reads to <prefix>-<core>.arielrec,
+# or replay a recorded stream instead of running the application under Pin
+record_prefix = os.getenv("ARIEL_RECORD_PREFIX")
+replay_prefix = os.getenv("ARIEL_REPLAY_PREFIX")
+
 ariel = sst.Component("a0", "ariel.ariel")
 ariel.addParams({
         "verbose" : "0",
@@ -25,6 +30,13 @@ ariel.addParams({
         "launchparam0" : "-ifeellucky",
         })
 
+if record_prefix:
+    ariel.addParam("recordprefix", record_prefix)
+
+if replay_prefix:
+    frontend = ariel.setSubComponent("frontend", "ariel.frontend.replay")
+    frontend.addParam("recordprefix", replay_prefix)
+
 memmgr = ariel.setSubComponent("memmgr", "ariel.MemoryManagerSimple")
 
 
@@ -77,6 +77,10 @@ class testcase_Ariel(SSTTestCase):
     @unittest.skipIf(not pin_loaded, "Ariel: Requires PIN, but Env Var 'INTEL_PIN_DIRECTORY' is not found or path does not exist.")
     def test_Ariel_test_snb_mlm(self):
         self.ariel_Template("ariel_snb_mlm", app="stream_mlm")
+
+    @unittest.skipIf(not pin_loaded, "Ariel: Requires PIN, but Env Var 'INTEL_PIN_DIRECTORY' is not found or path does not exist.")
+    def test_Ariel_record_replay(self):
+        self.ariel_record_replay_Template("runstream")
 #####
 
     def ariel_Template(self, testcase, app="", testtimeout=480):
@@ -160,6 +164,71 @@ class testcase_Ariel(SSTTestCase):
         if line_count_diff > 15:
             self.assertFalse(line_count_diff > 15, "Line count between output file {0} does not match Reference File {1}; They contain {2} different lines".format(outfile, reffile, line_count_diff))
 
+    # Runs testcase under Pin with recordprefix set, then again with
+    # frontend.replay reading the recorded streams.  The replayed run has
+    # to produce the same request, instruction and cache statistics.
+    def ariel_record_replay_Template(self, testcase, testtimeout=480):
+        # Get the path to the test files
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        tmpdir = self.get_test_output_tmp_dir()
+
+        # Set the paths to the various directories
+        ArielElementDir = os.path.abspath("{0}/../".format(test_path))
+        ArielElementStreamDir = "{0}/frontend/simple/examples/stream".format(ArielElementDir)
+        os.environ["ARIEL_TEST_STREAM_APP"] = "{0}/stream".format(ArielElementStreamDir)
+
+        # Set the various file paths
+        testDataFileName=("test_Ariel_{0}_record_replay".format(testcase))
+        sdlfile = "{0}/{1}.py".format(ArielElementStreamDir, testcase)
+        recordprefix = "{0}/{1}".format(tmpdir, testDataFileName)
+        recordfile = "{0}-0.arielrec".format(recordprefix)
+        stats = ["a0.read_requests.0", "a0.write_requests.0", "a0.instruction_count.0",
+                 "l1cache.CacheHits", "l1cache.CacheMisses"]
+
+        results = {}
+        for run in ["record", "replay"]:
+            outfile = "{0}/{1}_{2}.out".format(outdir, testDataFileName, run)
+            errfile = "{0}/{1}_{2}.err".format(outdir, testDataFileName, run)
+            mpioutfiles = "{0}/{1}_{2}.testfile".format(outdir, testDataFileName, run)
+
+            os.environ.pop("ARIEL_RECORD_PREFIX", None)
+            os.environ.pop("ARIEL_REPLAY_PREFIX", None)
+            if run == "record":
+                os.environ["ARIEL_RECORD_PREFIX"] = recordprefix
+            else:
+                os.environ["ARIEL_REPLAY_PREFIX"] = recordprefix
+
+            log_debug("{0} run: out file = {1}".format(run, outfile))
+
+            self.run_sst(sdlfile, outfile, errfile, set_cwd=ArielElementStreamDir,
+                         mpi_out_files=mpioutfiles, timeout_sec=testtimeout)
+
+            testing_remove_component_warning_from_file(outfile)
+
+            # Look for the word "FATAL" in the output file
+            cmd = 'grep "FATAL" {0} '.format(outfile)
+            grep_result = os.system(cmd) != 0
+            self.assertTrue(grep_result, "Output file {0} contains the word 'FATAL'...".format(outfile))
+
+            if run == "record":
+                self.assertTrue(os.path.isfile(recordfile), "Record file {0} was not written".format(recordfile))
+
+            results[run] = {}
+            with open(outfile) as f:
+                for line in f:
+                    fields = line.split(" : ", 1)
+                    if fields[0].strip() in stats:
+                        results[run][fields[0].strip()] = line.strip()
+
+        os.environ.pop("ARIEL_RECORD_PREFIX", None)
+        os.environ.pop("ARIEL_REPLAY_PREFIX", None)
+
+        for stat in stats:
+            self.assertTrue(stat in results["record"], "Recorded run has no {0} statistic".format(stat))
+            self.assertEqual(results["record"][stat], results["replay"].get(stat),
+                             "Replayed {0} does not match the recorded run".format(stat))
+
 #######################
 
     def _setup_ariel_test_files(self):
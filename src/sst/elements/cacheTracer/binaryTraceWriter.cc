@@ -0,0 +1,107 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include <chrono>
+
+#include "binaryTraceWriter.h"
+
+using namespace SST::CACHETRACER;
+
+BinaryTraceWriter::BinaryTraceWriter(const std::string& path, bool compress, size_t records) :
+    capacity(1), head(0), tail(0), done(false), file(NULL)
+{
+    while (capacity < records) { capacity <<= 1; }
+    ring.resize(capacity * RecordLength);
+
+#ifdef HAVE_LIBZ
+    gzTrace = NULL;
+    if (compress) {
+        gzTrace = gzopen(path.c_str(), "wb");
+    } else {
+        file = fopen(path.c_str(), "wb");
+    }
+#else
+    file = fopen(path.c_str(), "wb");
+#endif
+
+    if (isOpen()) {
+        writer = std::thread(&BinaryTraceWriter::run, this);
+    }
+}
+
+BinaryTraceWriter::~BinaryTraceWriter() {
+    close();
+}
+
+bool BinaryTraceWriter::isOpen() const {
+#ifdef HAVE_LIBZ
+    if (NULL != gzTrace) { return true; }
+#endif
+    return NULL != file;
+}
+
+void BinaryTraceWriter::close() {
+    if (writer.joinable()) {
+        done.store(true, std::memory_order_release);
+        writer.join();
+    }
+
+    if (NULL != file) {
+        fclose(file);
+        file = NULL;
+    }
+#ifdef HAVE_LIBZ
+    if (NULL != gzTrace) {
+        gzclose(gzTrace);
+        gzTrace = NULL;
+    }
+#endif
+}
+
+void BinaryTraceWriter::flush(const char* data, size_t records) {
+#ifdef HAVE_LIBZ
+    if (NULL != gzTrace) {
+        gzwrite(gzTrace, data, (unsigned int) (records * RecordLength));
+        return;
+    }
+#endif
+    fwrite(data, RecordLength, records, file);
+}
+
+void BinaryTraceWriter::run() {
+    while (true) {
+        // read done before tail so nothing published before close() is missed
+        const bool finishing = done.load(std::memory_order_acquire);
+        const uint64_t start = head.load(std::memory_order_relaxed);
+        const uint64_t end = tail.load(std::memory_order_acquire);
+
+        if (start == end) {
+            if (finishing) { break; }
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            continue;
+        }
+
+        // write up to the end of the ring in one go, the rest on the next pass
+        const uint64_t first = start & (capacity - 1);
+        uint64_t count = end - start;
+        if (first + count > capacity) {
+            count = capacity - first;
+        }
+
+        flush(&ring[first * RecordLength], count);
+        head.store(start + count, std::memory_order_release);
+    }
+}
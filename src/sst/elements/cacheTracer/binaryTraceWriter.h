@@ -0,0 +1,98 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _CACHETRACER_BINARYTRACEWRITER_H
+#define _CACHETRACER_BINARYTRACEWRITER_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+namespace SST{
+namespace CACHETRACER {
+
+/*
+  Writes trace records in the format read by prospero.ProsperoBinaryTraceReader
+  (and prospero.ProsperoCompressedBinaryTraceReader when compressed): a packed
+  21 byte record of cycle (uint64_t), 'R' or 'W' (char), address (uint64_t)
+  and size (uint32_t) in host byte order.
+
+  The simulation thread only copies the record into a single producer/single
+  consumer ring, a background thread drains the ring to the file in large
+  blocks. The producer only waits if the ring is full.
+*/
+class BinaryTraceWriter {
+public:
+    static const size_t RecordLength = sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t) + sizeof(uint32_t);
+
+    // capacity is rounded up to a power of two records
+    BinaryTraceWriter(const std::string& path, bool compress, size_t capacity);
+    ~BinaryTraceWriter();
+
+    bool isOpen() const;
+
+    void write(uint64_t cycle, char type, uint64_t addr, uint32_t size) {
+        const uint64_t pos = tail.load(std::memory_order_relaxed);
+        while (pos - head.load(std::memory_order_acquire) == capacity) {
+            std::this_thread::yield();
+        }
+
+        char* rec = &ring[(pos & (capacity - 1)) * RecordLength];
+        memcpy(rec, &cycle, sizeof(uint64_t));
+        rec[sizeof(uint64_t)] = type;
+        memcpy(rec + sizeof(uint64_t) + sizeof(char), &addr, sizeof(uint64_t));
+        memcpy(rec + sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t), &size, sizeof(uint32_t));
+
+        tail.store(pos + 1, std::memory_order_release);
+    }
+
+    // drain the ring, stop the writer thread and close the file
+    void close();
+
+    uint64_t getRecordCount() const { return tail.load(std::memory_order_relaxed); }
+
+private:
+    void run();
+    void flush(const char* data, size_t records);
+
+    std::vector<char> ring;
+    size_t capacity;
+    std::atomic<uint64_t> head;
+    std::atomic<uint64_t> tail;
+    std::atomic<bool> done;
+
+    FILE* file;
+#ifdef HAVE_LIBZ
+    gzFile gzTrace;
+#endif
+    std::thread writer;
+
+    BinaryTraceWriter(const BinaryTraceWriter&);     // do not implement
+    void operator=(const BinaryTraceWriter&);        // do not implement
+};
+
+} // namespace CACHETRACER
+} // namespace SST
+
+#endif //_CACHETRACER_BINARYTRACEWRITER_H
@@ -52,9 +52,27 @@ cacheTracer::cacheTracer( ComponentId_t id, Params& params ): Component( id ) {
     out->debug(CALL_INFO, 1, 0, "Clock registered\n");
 
     string tracePrefix = params.find<std::string>("tracePrefix", "");
+    string traceFormat = params.find<std::string>("traceFormat", "text");
+    binaryTrace = NULL;
     if("" == tracePrefix){
         out->debug(CALL_INFO, 1, 0, "Tracing Not Enabled.\n");
         writeTrace = false;
+    } else if("binary" == traceFormat || "compressed" == traceFormat) {
+        out->debug(CALL_INFO, 1, 0, "Binary tracing is Enabled, prefix is set to %s\n", tracePrefix.c_str());
+#ifndef HAVE_LIBZ
+        if("compressed" == traceFormat) {
+            out->fatal(CALL_INFO, -1, "cacheTracer: traceFormat compressed requires libz support\n");
+        }
+#endif
+        size_t bufferRecords = params.find<size_t>("traceBufferRecords", 65536);
+        out->output("Writing %s trace to file: %s\n", traceFormat.c_str(), tracePrefix.c_str());
+        binaryTrace = new BinaryTraceWriter(tracePrefix, "compressed" == traceFormat, bufferRecords);
+        if(!binaryTrace->isOpen()) {
+            out->fatal(CALL_INFO, -1, "cacheTracer: unable to open trace file %s\n", tracePrefix.c_str());
+        }
+        writeTrace = false;
+    } else if("text" != traceFormat) {
+        out->fatal(CALL_INFO, -1, "cacheTracer: unknown traceFormat %s\n", traceFormat.c_str());
     } else {
         out->debug(CALL_INFO, 1, 0, "Tracing is Enabled, prefix is set to %s\n", tracePrefix.c_str());
         char* traceFilePath = (char*) malloc( sizeof(char) * (tracePrefix.size()+ 20) );
@@ -98,7 +116,9 @@ cacheTracer::cacheTracer( ComponentId_t id, Params& params ): Component( id ) {
 } // constructor
 
 // destructor
-cacheTracer::~cacheTracer() {}
+cacheTracer::~cacheTracer() {
+    delete binaryTrace;
+}
 
 void cacheTracer::init(unsigned int phase) {
     // Since cacheTracer can sit between memH components, it needs to forward init events
@@ -140,14 +160,24 @@ bool cacheTracer::clock(Cycle_t current){
         InFlightReqQueue[me->getID()] = nanoseconds;
 
         if(writeDebug_8 & writeTrace){
-             fprintf(traceFile,"NB: Addr: 0x%" PRIu64, addr);
-             fprintf(traceFile, " timestamp: %" PRIu64, timestamp);
-             fprintf(traceFile, " Cmd: %u", me->getCmd());
-             fprintf(traceFile, " ID: %" PRIu64 "-%d", me->getID().first, me->getID().second);
-             fprintf(traceFile, " ResponseID: %" PRIu64 "-%d", me->getResponseToID().first, me->getResponseToID().second);
-             //fprintf(traceFile, " @%" PRIu64, picoseconds);
-             fprintf(traceFile, " @%" PRIu64 " ns", nanoseconds);
-             fprintf(traceFile, "\n");
+             fprintf(traceFile, "NB: Addr: 0x%" PRIu64 " timestamp: %" PRIu64 " Cmd: %u ID: %" PRIu64 "-%d ResponseID: %" PRIu64 "-%d @%" PRIu64 " ns\n",
+                 addr, timestamp, me->getCmd(), me->getID().first, me->getID().second,
+                 me->getResponseToID().first, me->getResponseToID().second, nanoseconds);
+        }
+
+        if(binaryTrace){
+            switch(me->getCmd()){
+                case Command::GetS:
+                case Command::GetSX:
+                    binaryTrace->write(timestamp, 'R', addr, me->getSize());
+                    break;
+                case Command::GetX:
+                case Command::Write:
+                    binaryTrace->write(timestamp, 'W', addr, me->getSize());
+                    break;
+                default:
+                    break;
+            }
         }
 
         // Send the request to south-bus
@@ -183,14 +213,9 @@ bool cacheTracer::clock(Cycle_t current){
         }
 
         if(writeDebug_8 & writeTrace){
-             fprintf(traceFile,"SB: Addr: 0x%" PRIu64, me->getAddr());
-             fprintf(traceFile, " timestamp: %" PRIu64, timestamp);
-             fprintf(traceFile, " Cmd: %u", me->getCmd());
-             fprintf(traceFile, " ID: %" PRIu64 "-%d", me->getID().first, me->getID().second);
-             fprintf(traceFile, " ResponseID: %" PRIu64 "-%d", me->getResponseToID().first, me->getResponseToID().second);
-             //fprintf(traceFile, " @%" PRIu64, picoseconds);
-             fprintf(traceFile, " @%" PRIu64 " ns", nanoseconds);
-             fprintf(traceFile, "\n");
+             fprintf(traceFile, "SB: Addr: 0x%" PRIu64 " timestamp: %" PRIu64 " Cmd: %u ID: %" PRIu64 "-%d ResponseID: %" PRIu64 "-%d @%" PRIu64 " ns\n",
+                 me->getAddr(), timestamp, me->getCmd(), me->getID().first, me->getID().second,
+                 me->getResponseToID().first, me->getResponseToID().second, nanoseconds);
         }
 
        // Send the request to north-bus
@@ -212,6 +237,10 @@ void cacheTracer::finish(){
     if(writeTrace){
        fclose(traceFile);
     }
+    if(binaryTrace){
+       out->debug(CALL_INFO, 1, 0, "Wrote %" PRIu64 " binary trace records\n", binaryTrace->getRecordCount());
+       binaryTrace->close();
+    }
 } // finish()
 
 
@@ -26,6 +26,7 @@
 #include <sst/core/link.h>
 #include <sst/core/timeConverter.h>
 #include <sst/elements/memHierarchy/memEvent.h>
+#include "binaryTraceWriter.h"
 #include <assert.h>
 #include <errno.h>
 #include <execinfo.h>
@@ -61,6 +62,8 @@ public:
 	{ "clock", "Frequency, same as system clock frequency", "1 GHz" },
     	{ "statsPrefix", "writes stats to statsPrefix file", "" },
     	{ "tracePrefix", "writes trace to tracePrefix tracing is enable", "" },
+    	{ "traceFormat", "Format of the trace: text (written when debug >= 8), binary or compressed. binary and compressed write the requests seen on the northBus in Prospero's binary trace format", "text" },
+    	{ "traceBufferRecords", "Number of records buffered between the simulation and the binary trace writer thread", "65536" },
     	{ "debug", "Print debug statements with increasing verbosity [0-10]", "0" },
     	{ "statistics", "0-No-stats, 1-print-stats", "0" },
     	{ "pageSize", "Page Size (bytes), used for selecting number of bins for address histogram ", "4096" },
@@ -81,6 +84,7 @@ private:
 
     Output* out;
     FILE* traceFile;
+    BinaryTraceWriter* binaryTrace;
     FILE* statsFile;
 
     // Links
@@ -0,0 +1,10 @@
+dnl -*- Autoconf -*-
+
+AC_DEFUN([SST_cacheTracer_CONFIG], [
+  cacheTracer_happy="yes"
+
+  # libz is optional, used for compressed binary traces
+  SST_CHECK_LIBZ()
+
+  AS_IF([test "$cacheTracer_happy" = "yes"], [$1], [$2])
+])
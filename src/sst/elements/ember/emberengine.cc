@@ -85,6 +85,9 @@ EmberEngine::EmberEngine(SST::ComponentId_t id, SST::Params& params) :
 		motifParams[i] = params.get_scoped_params( "motif" + tmp.str() );
 	}
 
+    m_statEventsAllocated = registerStatistic<uint64_t>( "events_allocated" );
+    m_statEventsRecycled = registerStatistic<uint64_t>( "events_recycled" );
+
     registerAsPrimaryComponent();
 
     // Init the first Motif
@@ -64,6 +64,11 @@ public:
 		distribParams.*
 	*/
 
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "events_allocated", "Motif events that needed a fresh heap allocation", "events", 1 },
+        { "events_recycled", "Motif events reusing the memory of a completed event", "events", 1 },
+    )
+
     SST_ELI_DOCUMENT_PORTS(
         {"detailed%(num_vNics)d", "Port connected to the detailed model", {}},
         {"nic", "Port connected to the nic", {}},
@@ -103,7 +108,13 @@ public:
 
 private:
 	bool refillQueue() {
-		return m_generator->generate( evQueue );
+		EmberEventPool::Counts before = EmberEventPool::counts();
+		bool done = m_generator->generate( evQueue );
+		const EmberEventPool::Counts& after = EmberEventPool::counts();
+
+		m_statEventsAllocated->addData( after.allocated - before.allocated );
+		m_statEventsRecycled->addData( after.recycled - before.recycled );
+		return done;
 	}
 
     std::string getComputeModelName() {
@@ -148,6 +159,9 @@ private:
 	SST::TimeConverter* nanoTimeConverter;
 	EmberMotifLog*      m_motifLogger;
 
+	Statistic<uint64_t>* m_statEventsAllocated;
+	Statistic<uint64_t>* m_statEventsRecycled;
+
 	std::vector<SST::Params> motifParams;
 	Thornhill::DetailedCompute* m_detailedCompute;
 	Thornhill::MemoryHeapLink*  m_memHeapLink;
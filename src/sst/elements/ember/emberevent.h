@@ -43,6 +43,71 @@ typedef Hermes::Callback Callback;
 
 typedef Statistic<uint32_t> EmberEventTimeStatistic;
 
+// Motifs allocate and the engine frees a very large number of short lived
+// events. Freed events are kept on per-thread free lists, one per size class,
+// and handed back out for the next event of that size. Each engine only runs
+// on one thread so in practice this is a free list per engine.
+class EmberEventPool {
+  public:
+    static const size_t Granule = 16;
+    static const size_t MaxPooledSize = 512;
+
+    struct Counts {
+        uint64_t allocated;
+        uint64_t recycled;
+    };
+
+    static void* alloc( size_t size ) {
+        Pool& pool = local();
+        if ( size > MaxPooledSize ) {
+            ++pool.counts.allocated;
+            return ::operator new( size );
+        }
+        FreeBlock*& head = pool.free[ sizeClass( size ) ];
+        if ( head ) {
+            FreeBlock* block = head;
+            head = block->next;
+            ++pool.counts.recycled;
+            return block;
+        }
+        ++pool.counts.allocated;
+        return ::operator new( roundUp( size ) );
+    }
+
+    static void free( void* ptr, size_t size ) {
+        if ( size > MaxPooledSize ) {
+            ::operator delete( ptr );
+            return;
+        }
+        FreeBlock*& head = local().free[ sizeClass( size ) ];
+        FreeBlock* block = static_cast<FreeBlock*>( ptr );
+        block->next = head;
+        head = block;
+    }
+
+    // running totals for the calling thread
+    static const Counts& counts() { return local().counts; }
+
+  private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    // trivially destructible so events freed during teardown are safe
+    struct Pool {
+        FreeBlock*  free[ MaxPooledSize / Granule ];
+        Counts      counts;
+    };
+
+    static size_t roundUp( size_t size ) { return ( size + Granule - 1 ) & ~( Granule - 1 ); }
+    static size_t sizeClass( size_t size ) { return roundUp( size ) / Granule - 1; }
+
+    static Pool& local() {
+        static thread_local Pool pool;
+        return pool;
+    }
+};
+
 class EmberEvent : public SST::Event {
 
 public:
@@ -61,6 +126,9 @@ public:
         m_state(Issue), m_output(NULL), m_evStat(NULL), m_completeDelayNS(0), m_retvalPtr(NULL) {}
 	~EmberEvent() {}
 
+    static void* operator new( size_t size ) { return EmberEventPool::alloc( size ); }
+    static void operator delete( void* ptr, size_t size ) { EmberEventPool::free( ptr, size ); }
+
 	virtual std::string getName() { return "?????"; };
 
     State state() { return m_state; }
@@ -102,6 +102,7 @@ class EmberJob(Job):
             sst.addGlobalParams("params_%s"%self._instance_name, self._apis);
 
         nic, slot_name = self.nic.build(nodeID,self._numCores // self._nicsPerNode)
+        followRouter(nic)
 
         #print( nodeID, "nic", self._getGroupParams("nic") )
         #print( nodeID, "ember", self._getGroupParams("ember") )
@@ -126,6 +127,7 @@ class EmberJob(Job):
         loopBackName = "loopBack" + my_id_name
         if nodeID % self._nicsPerNode == 0:
             loopBack = sst.Component(loopBackName, "firefly.loopBack")
+            followRouter(loopBack)
             #loopBack.addParam( "numCores", self._numCores )
             #loopBack.addParam( "nicsPerNode", self._nicsPerNode )
             loopBack.addGlobalParamSet("loopback_params_%s"%self._instance_name);
@@ -137,6 +139,7 @@ class EmberJob(Job):
         for x in range(self._numCores // self._nicsPerNode):
             # Instance the EmberEngine
             ep = sst.Component("nic" + str(nodeID) + "core" + str(x) + "_EmberEP", "ember.EmberEngine")
+            followRouter(ep)
             self._applyStatisticsSettings(ep)
 
             ep.addGlobalParamSet("params_%s"%self._instance_name )
@@ -0,0 +1,232 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef COMPONENTS_FIREFLY_CTRL_MSG_MATCH_QUEUE_H
+#define COMPONENTS_FIREFLY_CTRL_MSG_MATCH_QUEUE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace SST {
+namespace Firefly {
+namespace CtrlMsg {
+
+// (communicator, source, tag) triple used to bin posted receives and
+// unexpected messages. A wildcard source or tag is stored as AnySrc/AnyTag.
+struct MatchKey {
+    MatchKey() {}
+    MatchKey( uint32_t _group, uint32_t _rank, uint64_t _tag ) :
+        group(_group), rank(_rank), tag(_tag) {}
+
+    bool operator==( const MatchKey& rhs ) const {
+        return group == rhs.group && rank == rhs.rank && tag == rhs.tag;
+    }
+
+    uint32_t group;
+    uint32_t rank;
+    uint64_t tag;
+};
+
+struct MatchKeyHash {
+    size_t operator()( const MatchKey& key ) const {
+        uint64_t h = key.tag * 0x9e3779b97f4a7c15ULL;
+        h ^= ( (uint64_t) key.group << 32 | key.rank ) + 0x7f4a7c159e3779b9ULL + ( h << 6 ) + ( h >> 2 );
+        return h;
+    }
+};
+
+// Counts live entries by arrival sequence number so the position a linear
+// search of the queue would have stopped at can be found in O(log n).
+class MatchOrder {
+  public:
+    MatchOrder() : m_next(0) {}
+
+    bool full() { return m_next == m_tree.size(); }
+
+    // restart numbering with room for at least n entries
+    void reset( size_t n ) {
+        size_t size = m_tree.size() ? m_tree.size() : 64;
+        while ( size < 2 * n ) size *= 2;
+        m_tree.assign( size, 0 );
+        m_next = 0;
+    }
+
+    uint64_t insert() {
+        add( m_next, 1 );
+        return m_next++;
+    }
+
+    void remove( uint64_t seq ) { add( seq, -1 ); }
+
+    // number of live entries with a sequence number less than seq
+    int before( uint64_t seq ) {
+        int sum = 0;
+        for ( ; seq > 0; seq &= seq - 1 ) {
+            sum += m_tree[seq - 1];
+        }
+        return sum;
+    }
+
+  private:
+    void add( uint64_t seq, int delta ) {
+        for ( ++seq; seq <= m_tree.size(); seq += seq & -seq ) {
+            m_tree[seq - 1] += delta;
+        }
+    }
+
+    std::vector<int>    m_tree;
+    uint64_t            m_next;
+};
+
+// Queue of T* binned by MatchKey. Each entry is filed under up to four keys and
+// a search probes up to four bins, so wildcards can live on either side: posted
+// receives file under one (possibly wildcard) key and a message probes the exact
+// and wildcard bins, unexpected messages file under the exact and wildcard keys
+// and a receive probes one. The first entry in arrival order that satisfies the
+// full match predicate wins, as it would with a linear walk of the queue.
+template< class T >
+class MatchQueue {
+
+    static const int MaxKeys = 4;
+
+    struct Entry;
+    typedef std::list<Entry*> Bin;
+    typedef std::unordered_map<MatchKey, Bin, MatchKeyHash> BinMap;
+
+    struct Entry {
+        T*                  item;
+        uint64_t            seq;
+        int                 numKeys;
+        MatchKey            key[MaxKeys];
+        Bin*                bin[MaxKeys]; // map rehashing moves iterators but not elements
+        typename Bin::iterator    pos[MaxKeys];
+        typename std::list<Entry*>::iterator order;
+    };
+
+  public:
+    ~MatchQueue() {
+        typename std::list<Entry*>::iterator iter = m_order.begin();
+        for ( ; iter != m_order.end(); ++iter ) {
+            delete *iter;
+        }
+    }
+
+    size_t size() { return m_order.size(); }
+    bool empty() { return m_order.empty(); }
+
+    void push_back( T* item, const MatchKey* keys, int numKeys ) {
+        if ( m_seq.full() ) {
+            renumber();
+        }
+
+        Entry* entry = new Entry;
+        entry->item = item;
+        entry->seq = m_seq.insert();
+        entry->numKeys = 0;
+        entry->order = m_order.insert( m_order.end(), entry );
+
+        for ( int i = 0; i < numKeys; i++ ) {
+            bool dup = false;
+            for ( int j = 0; j < entry->numKeys; j++ ) {
+                if ( entry->key[j] == keys[i] ) dup = true;
+            }
+            if ( dup ) continue;
+
+            Bin* bin = &m_bins[ keys[i] ];
+            entry->key[entry->numKeys] = keys[i];
+            entry->bin[entry->numKeys] = bin;
+            entry->pos[entry->numKeys] = bin->insert( bin->end(), entry );
+            ++entry->numKeys;
+        }
+    }
+
+    // Remove and return the oldest entry in the probed bins that satisfies match().
+    // count is set to the number of entries a linear walk of the queue would have
+    // visited: the position of the match, or the queue size if there is none.
+    template< class Pred >
+    T* search( const MatchKey* keys, int numKeys, Pred match, int& count ) {
+        Entry* found = NULL;
+
+        for ( int i = 0; i < numKeys; i++ ) {
+            typename BinMap::iterator bin = m_bins.find( keys[i] );
+            if ( bin == m_bins.end() ) continue;
+
+            typename Bin::iterator iter = bin->second.begin();
+            for ( ; iter != bin->second.end(); ++iter ) {
+                if ( found && (*iter)->seq > found->seq ) break;
+                if ( match( (*iter)->item ) ) {
+                    found = *iter;
+                    break;
+                }
+            }
+        }
+
+        if ( NULL == found ) {
+            count += m_order.size();
+            return NULL;
+        }
+
+        count += m_seq.before( found->seq ) + 1;
+
+        T* item = found->item;
+        unlink( found );
+        return item;
+    }
+
+    bool remove( T* item ) {
+        typename std::list<Entry*>::iterator iter = m_order.begin();
+        for ( ; iter != m_order.end(); ++iter ) {
+            if ( (*iter)->item == item ) {
+                unlink( *iter );
+                return true;
+            }
+        }
+        return false;
+    }
+
+  private:
+    void unlink( Entry* entry ) {
+        for ( int i = 0; i < entry->numKeys; i++ ) {
+            entry->bin[i]->erase( entry->pos[i] );
+            if ( entry->bin[i]->empty() ) {
+                m_bins.erase( entry->key[i] );
+            }
+        }
+        m_seq.remove( entry->seq );
+        m_order.erase( entry->order );
+        delete entry;
+    }
+
+    void renumber() {
+        m_seq.reset( m_order.size() );
+        typename std::list<Entry*>::iterator iter = m_order.begin();
+        for ( ; iter != m_order.end(); ++iter ) {
+            (*iter)->seq = m_seq.insert();
+        }
+    }
+
+    BinMap              m_bins;
+    std::list<Entry*>   m_order;
+    MatchOrder          m_seq;
+};
+
+}
+}
+}
+
+#endif
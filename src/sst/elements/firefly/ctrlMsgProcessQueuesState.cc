@@ -343,7 +343,7 @@ void ProcessQueuesState::processRecv_1( _CommReq* req )
         processShortList_0( &m_funcStack );
     } else {
         dbg().debug(CALL_INFO,2,DBG_MSK_PQS_APP_SIDE,"post receive\n");
-        m_pstdRcvQ.push_back( req );
+        postRecv( req );
         processRecv_2( NULL, req );
     }
 }
@@ -358,7 +358,7 @@ void ProcessQueuesState::processRecv_2( Stack* stack, _CommReq* req )
 
     if ( ! m_pstdRcvPreQ.empty() ) {
         dbg().debug(CALL_INFO,2,DBG_MSK_PQS_APP_SIDE,"no match against unexpected queue move to pstRecvQ\n");
-        m_pstdRcvQ.push_back( m_pstdRcvPreQ.front() );
+        postRecv( m_pstdRcvPreQ.front() );
         m_pstdRcvPreQ.clear();
     }
 
@@ -408,15 +408,10 @@ void ProcessQueuesState::processMakeProgress( Stack* stack )
 
 void ProcessQueuesState::enterCancel( MP::MessageRequest req, uint64_t exitDelay ) {
 
-    std::deque< _CommReq* >:: iterator iter = m_pstdRcvQ.begin();
-    for ( ; iter != m_pstdRcvQ.end(); ++iter ) {
-
-		if ( *iter == req ) {
-    		dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"found req=%p\n",*iter);
-			delete( *iter );
-        	m_pstdRcvQ.erase(iter);
-			break;
-		}
+    _CommReq* commReq = static_cast<_CommReq*>(req);
+    if ( m_pstdRcvQ.remove( commReq ) ) {
+        dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"found req=%p\n",commReq);
+        delete commReq;
     }
     enterMakeProgress(m_exitDelay);
 }
@@ -604,7 +599,7 @@ void ProcessQueuesState::processShortList_0( Stack* stack )
     ProcessShortListCtx* ctx;
     if ( m_intStack.empty() ) {
         dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"use unexpectedMsgQ %zu\n",m_unexpectedMsgQ.size());
-        ctx = new ProcessShortListCtx( &m_unexpectedMsgQ );
+        ctx = new ProcessShortListCtx( );
     } else {
         dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"use recvdMsgQ pos=%d\n",m_recvdMsgQpos);
         ctx = new ProcessShortListCtx( &m_recvdMsgQ[m_recvdMsgQpos] );
@@ -625,11 +620,18 @@ void ProcessQueuesState::processShortList_1( Stack* stack )
     ProcessShortListCtx* ctx =
                         static_cast<ProcessShortListCtx*>( stack->back() );
 
+    // count is the number of entries a linear walk would have checked,
+    // a single walk of that length models the same match latency
     int count = 0;
     if ( m_intStack.empty() ) {
-        ctx->req = searchPostedRecv( m_pstdRcvPreQ, ctx->hdr(), count );
+        ctx->req = NULL;
+        ctx->setMsg( searchUnexpectedMsg( m_pstdRcvPreQ.front(), count ) );
+        if ( ctx->msg() ) {
+            ctx->req = m_pstdRcvPreQ.front();
+            m_pstdRcvPreQ.clear();
+        }
     } else {
-        ctx->req = searchPostedRecv( m_pstdRcvQ, ctx->hdr(), count );
+        ctx->req = searchPostedRecv( ctx->hdr(), count );
     }
 
     m_mem->walk(
@@ -652,9 +654,9 @@ void ProcessQueuesState::processShortList_2( Stack* stack )
         );
     } else {
         if ( m_intStack.empty() ) {
-            ctx->incPos();
+            ctx->setDone();
         } else {
-            m_unexpectedMsgQ.push_back( ctx->msg() );
+            pushUnexpectedMsg( ctx->msg() );
             ctx->unlinkMsg();
         }
         processShortList_5( stack );
@@ -985,28 +987,43 @@ void ProcessQueuesState::loopHandler( int srcCore, std::vector<IoVec>& vec, void
     runInterruptCtx();
 }
 
-_CommReq* ProcessQueuesState::searchPostedRecv( std::deque< _CommReq* >& pstd, MatchHdr& hdr, int& count )
+_CommReq* ProcessQueuesState::searchPostedRecv( MatchHdr& hdr, int& count )
 {
-    _CommReq* req = NULL;
-    dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"posted size %lu\n",pstd.size());
+    dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"posted size %lu\n",m_pstdRcvQ.size());
 
-    std::deque< _CommReq* >:: iterator iter = pstd.begin();
-    for ( ; iter != pstd.end(); ++iter ) {
+    MatchKey keys[4] = {
+        MatchKey( hdr.group, hdr.rank, hdr.tag ),
+        MatchKey( hdr.group, hdr.rank, AnyTag ),
+        MatchKey( hdr.group, MP::AnySrc, hdr.tag ),
+        MatchKey( hdr.group, MP::AnySrc, AnyTag )
+    };
 
-        ++count;
-        if ( ! checkMatchHdr( hdr, (*iter)->hdr(), (*iter)->ignore() ) ) {
-            continue;
-        }
+    _CommReq* req = m_pstdRcvQ.search( keys, 4,
+        [&]( _CommReq* posted ) {
+            return checkMatchHdr( hdr, posted->hdr(), posted->ignore() );
+        }, count );
 
-        req = *iter;
-        pstd.erase(iter);
-        break;
-    }
     dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"req=%p\n",req);
 
     return req;
 }
 
+ProcessQueuesState::Msg* ProcessQueuesState::searchUnexpectedMsg( _CommReq* req, int& count )
+{
+    dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"unexpected size %lu\n",m_unexpectedMsgQ.size());
+
+    MatchKey key = postedKey( req );
+
+    Msg* msg = m_unexpectedMsgQ.search( &key, 1,
+        [&]( Msg* unexpected ) {
+            return checkMatchHdr( unexpected->hdr(), req->hdr(), req->ignore() );
+        }, count );
+
+    dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"msg=%p\n",msg);
+
+    return msg;
+}
+
 bool ProcessQueuesState::checkMatchHdr( MatchHdr& hdr, MatchHdr& wantHdr,
                                     uint64_t ignore )
 {
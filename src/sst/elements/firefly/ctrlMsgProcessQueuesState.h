@@ -28,6 +28,7 @@
 
 #include "ctrlMsgCommReq.h"
 #include "ctrlMsgWaitReq.h"
+#include "ctrlMsgMatchQueue.h"
 
 #define DBG_MSK_PQS_APP_SIDE 1 << 0
 #define DBG_MSK_PQS_INT 1 << 1
@@ -281,29 +282,41 @@ class ProcessQueuesState : public SubComponent
     class ProcessShortListCtx : public FuncCtxBase {
       public:
 
+        // walk a list of received messages
         ProcessShortListCtx( std::deque<Msg*>* msgQ ) :
-			m_msgQ(msgQ), m_iter( msgQ->begin() ), m_done(false) {}
+			m_msgQ(msgQ), m_iter( msgQ->begin() ), m_msg(NULL), m_done(false) {}
 
-        MatchHdr&   hdr() { return (*m_iter)->hdr(); }
-        std::vector<IoVec>& ioVec() { return (*m_iter)->ioVec(); }
+        // match a single message pulled from the unexpected queue
+        ProcessShortListCtx( ) : m_msgQ(NULL), m_msg(NULL), m_done(false) {}
 
-        Msg* msg() { return *m_iter; }
+        MatchHdr&   hdr() { return msg()->hdr(); }
+        std::vector<IoVec>& ioVec() { return msg()->ioVec(); }
+
+        Msg* msg() { return m_msgQ ? *m_iter : m_msg; }
+        void setMsg( Msg* msg ) { m_msg = msg; }
 
         _CommReq*    req;
 
         void removeMsg() {
-            delete *m_iter;
+            delete msg();
             unlinkMsg();
         }
 
-        void unlinkMsg() { m_iter = m_msgQ->erase(m_iter); }
+        void unlinkMsg() {
+            if ( m_msgQ ) {
+                m_iter = m_msgQ->erase(m_iter);
+            } else {
+                m_msg = NULL;
+            }
+        }
         void setDone( ) { m_done = true; }
-        bool isDone() { return m_done || m_iter == m_msgQ->end();  }
+        bool isDone() { return m_done || ( m_msgQ ? m_iter == m_msgQ->end() : NULL == m_msg ); }
         void incPos() { ++m_iter; }
       private:
         bool m_done;
         std::deque<Msg*>*                       m_msgQ;
         typename std::deque<Msg*>::iterator 	m_iter;
+        Msg*                                    m_msg;
     };
 
     class WaitCtx : public FuncCtxBase {
@@ -379,7 +392,32 @@ class ProcessQueuesState : public SubComponent
 
 
     bool        checkMatchHdr( MatchHdr& hdr, MatchHdr& wantHdr, uint64_t ignore );
-    _CommReq*	searchPostedRecv( std::deque< _CommReq* >& pstd, MatchHdr& hdr, int& delay );
+    _CommReq*	searchPostedRecv( MatchHdr& hdr, int& delay );
+    Msg*        searchUnexpectedMsg( _CommReq* req, int& delay );
+
+    // posted receives with a wildcard source or tag are binned under AnySrc/AnyTag
+    MatchKey    postedKey( _CommReq* req ) {
+        MatchHdr& hdr = req->hdr();
+        return MatchKey( hdr.group, hdr.rank,
+                    ( AnyTag == hdr.tag || req->ignore() ) ? AnyTag : hdr.tag );
+    }
+
+    void postRecv( _CommReq* req ) {
+        MatchKey key = postedKey( req );
+        m_pstdRcvQ.push_back( req, &key, 1 );
+    }
+
+    // unexpected messages are binned under every key a receive could post with
+    void pushUnexpectedMsg( Msg* msg ) {
+        MatchHdr& hdr = msg->hdr();
+        MatchKey keys[4] = {
+            MatchKey( hdr.group, hdr.rank, hdr.tag ),
+            MatchKey( hdr.group, hdr.rank, AnyTag ),
+            MatchKey( hdr.group, MP::AnySrc, hdr.tag ),
+            MatchKey( hdr.group, MP::AnySrc, AnyTag )
+        };
+        m_unexpectedMsgQ.push_back( msg, keys, 4 );
+    }
 
     void exit( int delay = 0 ) {
         dbg().debug(CALL_INFO,2,DBG_MSK_PQS_APP_SIDE,"exit ProcessQueuesState\n");
@@ -480,11 +518,11 @@ class ProcessQueuesState : public SubComponent
     int     m_numRecvLooped;
     bool    m_missedInt;
 
-    std::deque< _CommReq* >         m_pstdRcvQ;
+    MatchQueue< _CommReq >          m_pstdRcvQ;
     std::deque< _CommReq* >         m_pstdRcvPreQ;
     std::vector<std::deque< Msg* >> m_recvdMsgQ;
 	int m_recvdMsgQpos;
-    std::deque< Msg* >              m_unexpectedMsgQ;
+    MatchQueue< Msg >               m_unexpectedMsgQ;
 
     std::deque< _CommReq* >         m_longGetFiniQ;
     std::deque< GetInfo* >          m_longAckQ;
@@ -0,0 +1,85 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef COMPONENTS_FIREFLY_INLINECALLBACK_H
+#define COMPONENTS_FIREFLY_INLINECALLBACK_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// A void() callable stored in a fixed size buffer. Objects that hold one
+// are pooled so setting a callback does not allocate, unlike std::function
+// which only keeps 16 bytes in place. Callables that do not fit go to the
+// heap.
+class InlineCallback {
+
+  public:
+    static const size_t Size = 64;
+
+    InlineCallback() : m_obj(NULL), m_invoke(NULL), m_destroy(NULL) {}
+    ~InlineCallback() { clear(); }
+
+    template < class F >
+    void set( F&& func ) {
+        typedef typename std::decay<F>::type T;
+        clear();
+        construct<T>( std::forward<F>(func),
+            std::integral_constant< bool, sizeof(T) <= Size && alignof(T) <= alignof(std::max_align_t) >() );
+        m_invoke = &invoke<T>;
+    }
+
+    void operator()() { m_invoke( m_obj ); }
+
+    void clear() {
+        if ( m_obj ) {
+            m_destroy( m_obj );
+            m_obj = NULL;
+        }
+    }
+
+  private:
+    InlineCallback( const InlineCallback& );
+    InlineCallback& operator=( const InlineCallback& );
+
+    template < class T, class F >
+    void construct( F&& func, std::true_type ) {
+        m_obj = new (m_buf) T( std::forward<F>(func) );
+        m_destroy = &destroyInPlace<T>;
+    }
+
+    template < class T, class F >
+    void construct( F&& func, std::false_type ) {
+        m_obj = new T( std::forward<F>(func) );
+        m_destroy = &destroyOnHeap<T>;
+    }
+
+    template < class T >
+    static void invoke( void* obj ) { (*static_cast<T*>(obj))(); }
+
+    template < class T >
+    static void destroyInPlace( void* obj ) { static_cast<T*>(obj)->~T(); }
+
+    template < class T >
+    static void destroyOnHeap( void* obj ) { delete static_cast<T*>(obj); }
+
+    alignas(std::max_align_t) char m_buf[Size];
+    void* m_obj;
+    void (*m_invoke)( void* );
+    void (*m_destroy)( void* );
+};
+
+#endif
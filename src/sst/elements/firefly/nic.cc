@@ -169,6 +169,9 @@ Nic::Nic(ComponentId_t id, Params &params) :
     m_selfLink = configureSelfLink("Nic::selfLink", "1 ns",
         new Event::Handler<Nic>(this,&Nic::handleSelfEvent));
     assert( m_selfLink );
+    m_selfLinkTC = getTimeConverter( "1 ns" );
+
+    m_batchCallbacks = params.find<bool>( "batchCallbacks", false );
 
     m_dbg.verbose(CALL_INFO,2,1,"IdToNet()=%d\n", IdToNet( m_myNodeId ) );
 
@@ -385,7 +388,14 @@ void Nic::handleVnicEvent( Event* ev, int id )
     switch ( event->base_type ) {
 
       case NicCmdBaseEvent::Msg:
-		m_selfLink->send( getDelay_ns( ), new SelfEvent( ev, id ) );
+		{
+			closeCallbackBatch( getDelay_ns( ) );
+			SelfEvent* selfEvent = m_selfEventHeap.alloc();
+			selfEvent->type = SelfEvent::Event;
+			selfEvent->event = ev;
+			selfEvent->linkNum = id;
+			m_selfLink->send( getDelay_ns( ), selfEvent );
+		}
         break;
 
       case NicCmdBaseEvent::Shmem:
@@ -430,12 +440,29 @@ void Nic::handleSelfEvent( Event *e )
 	switch ( event->type ) {
 	case SelfEvent::Callback:
         event->callback();
+        event->callback.clear();
 		break;
 	case SelfEvent::Event:
 		handleVnicEvent2( event->event, event->linkNum );
 		break;
+	case SelfEvent::Batch:
+		{
+			std::map< SimTime_t, SelfEvent* >::iterator iter = m_callbackBatches.find( event->due );
+			if ( iter != m_callbackBatches.end() && iter->second == event ) {
+				m_callbackBatches.erase( iter );
+			}
+			// a callback can schedule more work but not into this batch, it is closed
+			for ( size_t i = 0; i < event->callbacks.size(); i++ ) {
+				SelfEvent* entry = event->callbacks[i];
+				entry->callback();
+				entry->callback.clear();
+				m_selfEventHeap.free( entry );
+			}
+			event->callbacks.clear();
+		}
+		break;
 	}
-    delete e;
+    m_selfEventHeap.free( event );
 }
 
 void Nic::handleVnicEvent2( Event* ev, int id )
@@ -20,6 +20,8 @@
 #include <math.h>
 #include <sstream>
 #include <queue>
+#include <map>
+#include <algorithm>
 #include <sst/core/module.h>
 #include <sst/core/component.h>
 #include <sst/core/output.h>
@@ -32,6 +34,8 @@
 //#include "memoryModel/trivialMemoryModel.h"
 #include "memoryModel/simpleMemoryModel.h"
 #include "memoryModel/detailedInterface.h"
+#include "thingHeap.h"
+#include "inlineCallback.h"
 
 #define CALL_INFO_LAMBDA     __LINE__, __FILE__
 
@@ -123,6 +127,7 @@ public:
         { "dmaContentionMult", "set the DMA contention mult", "100"},
 
         { "useDetailed", "Use detailed compute model", "false"},
+        { "batchCallbacks", "Deliver all NIC callbacks due at the same time with one self event. Callbacks can then run ahead of events from other links due at that time", "false"},
     )
 
 	/* PARAMS
@@ -258,19 +263,18 @@ private:
     class SelfEvent : public SST::Event {
     public:
 
-		enum { Callback, Event } type;
-        typedef std::function<void()> Callback_t;
+		enum { Callback, Event, Batch } type;
 
-        SelfEvent( Callback_t callback ) :
-            type(Callback), callback( callback) {}
-        SelfEvent( SST::Event* ev,  int linkNum  ) :
-            type(Event), event( ev), linkNum(linkNum) {}
+        SelfEvent() : type(Callback), event(NULL), linkNum(0), due(0) {}
 
-        void*              entry;
-        Callback_t         callback;
+        InlineCallback     callback;
 		SST::Event*        event;
 		int				   linkNum;
 
+        // Batch, Callback entries due at core time "due" in the order they were scheduled
+        std::vector<SelfEvent*> callbacks;
+        SimTime_t          due;
+
         NotSerializable(SelfEvent)
     };
 
@@ -370,8 +374,18 @@ public:
     void dmaRead( int unit, int pid, std::vector<MemOp>* vec, Callback callback );
     void dmaWrite( int unit, int pid, std::vector<MemOp>* vec, Callback callback );
 
-    void schedCallback( Callback callback, uint64_t delay = 0 ) {
-        schedEvent( new SelfEvent( callback ), delay);
+    // the callable is stored in a pooled self event, pass a std::bind or
+    // lambda directly rather than wrapping it in a Callback first
+    template < class F >
+    void schedCallback( F&& callback, uint64_t delay = 0 ) {
+        SelfEvent* event = m_selfEventHeap.alloc();
+        event->type = SelfEvent::Callback;
+        event->callback.set( std::forward<F>( callback ) );
+        if ( m_batchCallbacks ) {
+            batchCallback( event, delay );
+        } else {
+            schedEvent( event, delay );
+        }
     }
 
     VirtNic* getVirtNic( int id ) {
@@ -424,6 +438,32 @@ public:
         m_selfLink->send( delay, event );
     }
 
+    // Callbacks due at the same time share one self event. A batch is closed
+    // when anything else is sent on the self link for its time so delivery
+    // order on the link does not change. Batches are keyed by delivery time
+    // in core cycles, the current time need not be a whole number of ns.
+    SimTime_t selfLinkDueTime( SimTime_t delay ) {
+        return getCurrentSimCycle() + m_selfLinkTC->convertToCoreTime( delay );
+    }
+
+    void batchCallback( SelfEvent* entry, SimTime_t delay ) {
+        SimTime_t due = selfLinkDueTime( delay );
+        SelfEvent*& batch = m_callbackBatches[due];
+        if ( NULL == batch ) {
+            batch = m_selfEventHeap.alloc();
+            batch->type = SelfEvent::Batch;
+            batch->due = due;
+            schedEvent( batch, delay );
+        }
+        batch->callbacks.push_back( entry );
+    }
+
+    void closeCallbackBatch( SimTime_t delay ) {
+        if ( ! m_callbackBatches.empty() ) {
+            m_callbackBatches.erase( selfLinkDueTime( delay ) );
+        }
+    }
+
     void notifySendDmaDone( int vNicNum, void* key ) {
         m_vNicV[vNicNum]->notifySendDmaDone(  key );
     }
@@ -493,6 +533,10 @@ struct X {
     int                     m_myNodeId;
     int                     m_num_vNics;
     SST::Link*              m_selfLink;
+    TimeConverter*          m_selfLinkTC;
+    ThingHeap<SelfEvent>    m_selfEventHeap;
+    bool                    m_batchCallbacks;
+    std::map< SimTime_t, SelfEvent* > m_callbackBatches;
 
     SST::Interfaces::SimpleNetwork*     m_linkControl;
     SST::Interfaces::SimpleNetwork::Handler<Nic>* m_recvNotifyFunctor;
@@ -542,7 +586,7 @@ struct X {
         if( m_memoryModel ) {
         	m_memoryModel->schedHostCallback( core, ops, callback );
         } else {
-			schedCallback(callback);
+			schedCallback( std::move( callback ) );
 			delete ops;
 		}
     }
@@ -566,7 +610,7 @@ struct X {
         	for ( unsigned i = 0;  i <  ops->size(); i++ ) {
             	assert( (*ops)[i].callback == NULL );
         	}
-			schedCallback(callback);
+			schedCallback( std::move( callback ) );
 			delete ops;
 		}
 	}
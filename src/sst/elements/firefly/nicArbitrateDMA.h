@@ -44,7 +44,7 @@ class ArbitrateDMA {
         m_dbg.debug(CALL_INFO,1,NIC_DBG_DMA_ARBITRATE,"bytes=%d\n",bytes);
         uint64_t delay = foo( m_xx[Write], m_xx[Read], bytes  );
         if ( delay ) {
-            m_nic.schedCallback( callback, delay );
+            m_nic.schedCallback( std::move( callback ), delay );
         } else {
             callback();
         }
@@ -54,7 +54,7 @@ class ArbitrateDMA {
         m_dbg.debug(CALL_INFO,1,NIC_DBG_DMA_ARBITRATE,"bytes=%d\n",bytes);
         uint64_t delay = foo( m_xx[Read], m_xx[Write], bytes  );
         if ( delay ) {
-            m_nic.schedCallback( callback, delay );
+            m_nic.schedCallback( std::move( callback ), delay );
         } else {
             callback();
         }
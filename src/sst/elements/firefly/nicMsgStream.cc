@@ -47,5 +47,5 @@ Nic::RecvMachine::MsgStream::MsgStream( Output& output, Ctx* ctx,
         ev->clearHdr();
         callback = std::bind( &Nic::RecvMachine::MsgStream::processFirstPkt, this, ev );
     }
-    m_ctx->nic().schedCallback( callback,  m_ctx->getRxMatchDelay() );
+    m_ctx->nic().schedCallback( std::move( callback ),  m_ctx->getRxMatchDelay() );
 }
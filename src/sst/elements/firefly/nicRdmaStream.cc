@@ -69,5 +69,5 @@ void Nic::RecvMachine::RdmaStream::processPktHdr( FireflyNetworkEvent* ev ) {
       default:
         assert(0);
     }
-    m_ctx->nic().schedCallback( callback, delay );
+    m_ctx->nic().schedCallback( std::move( callback ), delay );
 }
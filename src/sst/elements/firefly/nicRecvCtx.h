@@ -81,7 +81,7 @@
             }
 
             void schedCallback( Callback callback, uint64_t delay = 0 ) {
-                m_rm.nic().schedCallback( callback, delay );
+                m_rm.nic().schedCallback( std::move( callback ), delay );
             }
 
             void runSend( int num, SendEntryBase* entry ) {
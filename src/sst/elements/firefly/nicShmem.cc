@@ -267,7 +267,7 @@ void Nic::Shmem::regMem( NicShmemRegMemCmdEvent* event, int id )
     m_dbg.verbosePrefix( prefix(),CALL_INFO,1,NIC_DBG_SHMEM,"core=%d simVAddr=%" PRIx64 " backing=%p len=%lu\n",
             id, event->addr.getSimVAddr(), event->addr.getBacking(), event->len );
 
-    m_regMem[id].push_back( RegionEntry( event->addr, event->realAddr, event->len) );
+    addRegion( id, RegionEntry( event->addr, event->realAddr, event->len) );
 
     m_nic.getVirtNic(id)->notifyShmem( getNic2HostDelay_ns(), event->callback );
 
@@ -460,10 +460,10 @@ void Nic::Shmem::hostWait( NicShmemOpCmdEvent* event, int id )
         );
 
     if ( ! op->checkOp( m_dbg, id ) ) {
-        m_pendingOps[id].push_back( op);
+        m_pendingOps[id].insert( std::make_pair( addr, std::make_pair( m_waitSeq++, op ) ) );
     } else {
         m_dbg.verbosePrefix( prefix(),CALL_INFO,1,NIC_DBG_SHMEM,"core=%d wait satisfied\n",id);
-		m_nic.schedCallback( op->callback() );
+		m_nic.schedCallback( std::move( op->callback() ) );
         delete op;
     }
 }
@@ -742,21 +742,28 @@ void Nic::Shmem::checkWaitOps( int core, Hermes::Vaddr addr, size_t length )
 {
     m_dbg.verbosePrefix( prefix(),CALL_INFO,3,NIC_DBG_SHMEM,"core=%d addr=%" PRIx64" len=%lu\n", core, addr, length );
 
-    std::list<Op*>::iterator iter = m_pendingOps[core].begin();
+    // only ops watching an address inside the range can be affected
+    std::multimap< Hermes::Vaddr, PendingOp >::iterator iter = m_pendingOps[core].lower_bound( addr );
 
-    while ( iter != m_pendingOps[core].end() ) {
+    while ( iter != m_pendingOps[core].end() && iter->first < addr + length ) {
 
         m_dbg.verbosePrefix( prefix(),CALL_INFO,3,NIC_DBG_SHMEM,"check op\n" );
-        Op* op = *iter;
+        Op* op = iter->second.second;
         if ( op->inRange( addr, length ) && op->checkOp( m_dbg, core ) ) {
-
-        	m_dbg.verbosePrefix( prefix(),CALL_INFO,1,NIC_DBG_SHMEM,"op valid, notify\n");
-			m_nic.schedCallback( op->callback(), m_nic2HostDelay_ns );
-            delete op;
+            m_readyOps.push_back( iter->second );
             iter = m_pendingOps[core].erase(iter);
         } else {
             ++iter;
         }
     }
-}
 
+    std::sort( m_readyOps.begin(), m_readyOps.end() );
+
+    for ( size_t i = 0; i < m_readyOps.size(); i++ ) {
+        Op* op = m_readyOps[i].second;
+        m_dbg.verbosePrefix( prefix(),CALL_INFO,1,NIC_DBG_SHMEM,"op valid, notify\n");
+        m_nic.schedCallback( std::move( op->callback() ), m_nic2HostDelay_ns );
+        delete op;
+    }
+    m_readyOps.clear();
+}
@@ -97,7 +97,10 @@ class Shmem {
 
 		m_activePuts.resize( numVnics );
 		m_regMem.resize( numVnics );
+		m_regIndex.resize( numVnics );
+		m_regOverlap.resize( numVnics, false );
 		m_pendingOps.resize( numVnics );
+		m_waitSeq = 0;
 		m_pendingPuts.resize( numVnics );
 		m_pendingGets.resize( numVnics );
 		m_nicCmdLatency =    params.find<int>( "nicCmdLatency", 10 );
@@ -149,6 +152,17 @@ class Shmem {
 	}
 
     std::pair<Hermes::MemAddr, size_t> findRegion( int core, uint64_t addr ) {
+		if ( ! m_regOverlap[core] ) {
+			std::map< uint64_t, size_t >::iterator iter = m_regIndex[core].upper_bound( addr );
+			if ( iter != m_regIndex[core].begin() ) {
+				RegionEntry& entry = m_regMem[core][ (--iter)->second ];
+				if ( addr < entry.addr.getSimVAddr() + entry.length ) {
+					return std::make_pair( entry.realAddr, entry.length );
+				}
+			}
+		}
+
+		// regions overlap (the first one registered wins) or the address is unknown
         for ( int i = 0; i < m_regMem[core].size(); i++ ) {
             if ( addr >= m_regMem[core][i].addr.getSimVAddr() &&
                 addr < m_regMem[core][i].addr.getSimVAddr() + m_regMem[core][i].length ) {
@@ -166,12 +180,38 @@ class Shmem {
 	    m_dbg.verbosePrefix( prefix(),CALL_INFO,1,NIC_DBG_SHMEM,"core=%d simVAddr=%" PRIx64 " backing=%p len=%lu\n",
             id, addr.getSimVAddr(), addr.getBacking(), length );
 
-    	m_regMem[id].push_back( RegionEntry( addr, simAddr, length)  );
+		addRegion( id, RegionEntry( addr, simAddr, length ) );
 	}
 
     void checkWaitOps( int core, Hermes::Vaddr addr, size_t length );
 
 private:
+	void addRegion( int core, const RegionEntry& region ) {
+		uint64_t start = region.addr.getSimVAddr();
+
+		m_regMem[core].push_back( region );
+
+		// an empty region can never be found
+		if ( 0 == region.length ) {
+			return;
+		}
+
+		std::map< uint64_t, size_t >& index = m_regIndex[core];
+		std::map< uint64_t, size_t >::iterator next = index.lower_bound( start );
+
+		if ( next != index.end() && next->first < start + region.length ) {
+			m_regOverlap[core] = true;
+		}
+		if ( next != index.begin() ) {
+			std::map< uint64_t, size_t >::iterator prev = std::prev( next );
+			if ( prev->first + m_regMem[core][prev->second].length > start ) {
+				m_regOverlap[core] = true;
+			}
+		}
+
+		index.insert( next, std::make_pair( start, m_regMem[core].size() - 1 ) );
+	}
+
 	SimTime_t getNic2HostDelay_ns() { return m_nic2HostDelay_ns; }
 	SimTime_t getHost2NicDelay_ns() { return m_host2NicDelay_ns; }
     void init( NicShmemInitCmdEvent*, int id );
@@ -211,9 +251,18 @@ private:
 	std::vector< std::pair< Hermes::Vaddr, Hermes::Value > > m_pendingGets;
     Nic& m_nic;
     Output& m_dbg;
-    std::vector< std::list<Op*> > m_pendingOps;
+    // waiting ops keyed by the address they watch, the sequence number
+    // keeps notifications in the order the waits were posted
+    typedef std::pair< uint64_t, Op* > PendingOp;
+    std::vector< std::multimap< Hermes::Vaddr, PendingOp > > m_pendingOps;
+    std::vector< PendingOp > m_readyOps;
+    uint64_t m_waitSeq;
 
     std::vector<std::vector< RegionEntry > > m_regMem;
+    // start address of each region to its slot in m_regMem, only used
+    // while the core's regions do not overlap
+    std::vector< std::map< uint64_t, size_t > > m_regIndex;
+    std::vector< bool > m_regOverlap;
 	SimTime_t m_nic2HostDelay_ns;
 	SimTime_t m_host2NicDelay_ns;
 
@@ -0,0 +1,728 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+#include <sst_config.h>
+#include "noc_mesh_monolithic.h"
+
+#include <sst/core/params.h>
+#include <sst/core/output.h>
+#include <sst/core/unitAlgebra.h>
+
+#include <algorithm>
+#include <string>
+
+#include "nocEvents.h"
+
+using namespace SST::Kingsley;
+using namespace SST::Interfaces;
+using namespace std;
+
+
+noc_mesh_monolithic::~noc_mesh_monolithic()
+{
+}
+
+noc_mesh_monolithic::noc_mesh_monolithic(ComponentId_t cid, Params& params) :
+    Component(cid),
+    init_state(0),
+    total_endpoints(0),
+    wheel_pending(0),
+    total_queued(0),
+    lru_units_per_router(0),
+    output(getSimulationOutput())
+{
+    bool found = false;
+
+    // Get the shape of the mesh
+    routers_x = params.find<int>("x_size",0);
+    routers_y = params.find<int>("y_size",0);
+    if ( routers_x <= 0 || routers_y <= 0 ) {
+        output.fatal(CALL_INFO, -1, "noc_mesh_monolithic requires x_size and y_size to be specified and greater than 0\n");
+    }
+
+    // Add the halo of edge endpoints
+    x_size = routers_x + 2;
+    y_size = routers_y + 2;
+
+    // Get the options for the routers
+    local_ports = params.find<int>("local_ports",1);
+    ports_per_router = local_port_start + local_ports;
+
+    use_dense_map = params.find<bool>("use_dense_map",false);
+
+    port_priority_equal = params.find<bool>("port_priority_equal",false);
+
+    route_y_first = params.find<bool>("route_y_first",false);
+
+    // Parse all the timing parameters
+
+    // Flit size
+    UnitAlgebra flit_size_ua = params.find<UnitAlgebra>("flit_size",found);
+    if ( !found ) {
+        output.fatal(CALL_INFO, -1, "noc_mesh_monolithic requires flit_size to be specified\n");
+    }
+    if ( flit_size_ua.hasUnits("B") ) {
+        // Need to convert to bits per second
+        flit_size_ua *= UnitAlgebra("8b/B");
+    }
+    flit_size = flit_size_ua.getRoundedValue();
+
+    UnitAlgebra input_buf_size_ua = params.find<UnitAlgebra>("input_buf_size",flit_size_ua * 2);
+    if ( input_buf_size_ua.hasUnits("B") ) {
+        // Need to convert to bits per second
+        input_buf_size_ua *= UnitAlgebra("8b/B");
+    }
+    input_buf_size = input_buf_size_ua.getRoundedValue();
+
+
+    UnitAlgebra link_bw_ua = params.find<UnitAlgebra>("link_bw",found);
+    if ( !found ) {
+        output.fatal(CALL_INFO, -1, "noc_mesh_monolithic requires link_bw to be specified\n");
+    }
+    if ( link_bw_ua.hasUnits("B/s") ) {
+        // Need to convert to bits per second
+        link_bw_ua *= UnitAlgebra("8b/B");
+    }
+
+    UnitAlgebra clock_freq = link_bw_ua / flit_size_ua;
+
+    UnitAlgebra link_latency_ua = params.find<UnitAlgebra>("link_latency",found);
+    if ( !found ) {
+        output.fatal(CALL_INFO, -1, "noc_mesh_monolithic requires link_latency to be specified\n");
+    }
+    if ( !link_latency_ua.hasUnits("s") ) {
+        output.fatal(CALL_INFO, -1, "noc_mesh_monolithic: link_latency must be specified in units of s\n");
+    }
+
+    // Register the clock
+    my_clock_handler = new Clock::Handler<noc_mesh_monolithic>(this,&noc_mesh_monolithic::clock_handler);
+    clock_tc = registerClock( clock_freq, my_clock_handler);
+    clock_is_off = false;
+
+    // An event sent on a link at a clock edge arrives latency later and
+    // is first seen by the receiving router at the next edge after it
+    // arrives (clocks run before events delivered at the same time).
+    SimTime_t latency = getTimeConverter(link_latency_ua)->getFactor();
+    hop_cycles = latency / clock_tc->getFactor() + 1;
+
+    Cycle_t wheel_size = 1;
+    while ( wheel_size <= (Cycle_t)hop_cycles ) wheel_size <<= 1;
+    wheel.resize(wheel_size);
+    wheel_mask = wheel_size - 1;
+
+    // Configure the ports that connect to endpoints and add all the
+    // statistics
+    int num_routers = routers_x * routers_y;
+    int num_ports = num_routers * ports_per_router;
+
+    ports.assign(num_ports, NULL);
+    port_queues.resize(num_ports);
+    port_busy_until.assign(num_ports, 0);
+    port_credits.assign(num_ports, 0);
+    port_endpoint.assign(num_ports, false);
+    router_queued.assign(num_routers, 0);
+
+    send_bit_count.resize(num_ports);
+    output_port_stalls.resize(num_ports);
+    xbar_stalls.resize(num_ports);
+
+    static const char* dir_names[] = { "north", "south", "east", "west" };
+
+    for ( int r = 0; r < num_routers; ++r ) {
+        int x = r % routers_x;
+        int y = r / routers_x;
+        int base = r * ports_per_router;
+        std::string prefix = "rtr_" + std::to_string(x) + "_" + std::to_string(y) + "_";
+
+        // Directional ports only have a link on the edge of the mesh
+        for ( int i = 0; i < local_port_start; ++i ) {
+            if ( neighbor(r, i) == -1 ) {
+                int pos = ( i == north_port || i == south_port ) ? x : y;
+                ports[base + i] =
+                    configureLink(std::string(dir_names[i]) + std::to_string(pos),
+                                  new Event::Handler<noc_mesh_monolithic,int>(this,&noc_mesh_monolithic::handle_input,base + i));
+            }
+        }
+
+        for ( int i = 0; i < local_ports; ++i ) {
+            ports[base + local_port_start + i] =
+                configureLink("local" + std::to_string(r * local_ports + i),
+                              new Event::Handler<noc_mesh_monolithic,int>(this,&noc_mesh_monolithic::handle_input,base + local_port_start + i));
+        }
+
+        // stats
+        for ( int i = 0; i < ports_per_router; ++i ) {
+            std::string name = prefix + ( i < local_port_start ? std::string(dir_names[i]) : "local" + std::to_string(i - local_port_start) );
+            send_bit_count[base + i] = registerStatistic<uint64_t>("send_bit_count",name);
+            output_port_stalls[base + i] = registerStatistic<uint64_t>("output_port_stalls",name);
+            xbar_stalls[base + i] = registerStatistic<uint64_t>("xbar_stalls",name);
+        }
+    }
+}
+
+int
+noc_mesh_monolithic::neighbor(int router, int port) const
+{
+    int x = router % routers_x;
+    int y = router / routers_x;
+    switch ( port ) {
+    case north_port:
+        return y == routers_y - 1 ? -1 : router + routers_x;
+    case south_port:
+        return y == 0 ? -1 : router - routers_x;
+    case east_port:
+        return x == routers_x - 1 ? -1 : router + 1;
+    case west_port:
+        return x == 0 ? -1 : router - 1;
+    default:
+        return -1;
+    }
+}
+
+int
+noc_mesh_monolithic::endpoint_id(int router, int port) const
+{
+    // Same ids noc_mesh hands out.  Endpoints on the edge ports sit in
+    // the halo around the mesh.
+    int x = router_x(router);
+    int y = router_y(router);
+    switch ( port ) {
+    case north_port:
+        return (((y + 1) * x_size) + x) * local_ports;
+    case south_port:
+        return (((y - 1) * x_size) + x) * local_ports;
+    case east_port:
+        return ((y * x_size) + x + 1) * local_ports;
+    case west_port:
+        return ((y * x_size) + x - 1) * local_ports;
+    default:
+        return (((y * x_size) + x) * local_ports) + port - local_port_start;
+    }
+}
+
+int
+noc_mesh_monolithic::endpoint_port(int id) const
+{
+    int dest_rtr_id = id / local_ports;
+    int x = dest_rtr_id % x_size;
+    int y = dest_rtr_id / x_size;
+    int port;
+
+    if ( x == 0 ) {
+        x = 1;
+        port = west_port;
+    }
+    else if ( x == x_size - 1) {
+        x = x_size - 2;
+        port = east_port;
+    }
+    else if ( y == 0 ) {
+        y = 1;
+        port = south_port;
+    }
+    else if ( y == y_size - 1 ) {
+        y = y_size - 2;
+        port = north_port;
+    }
+    else {
+        port = local_port_start + (id - (((y * x_size) + x ) * local_ports) );
+    }
+
+    if ( x < 1 || x > routers_x || y < 1 || y > routers_y ) return -1;
+    return (((y - 1) * routers_x) + x - 1) * ports_per_router + port;
+}
+
+void
+noc_mesh_monolithic::route(int router, mesh_packet& packet)
+{
+    int my_x = router_x(router);
+    int my_y = router_y(router);
+
+    if ( route_y_first ) {
+        // Compute next port
+        if ( packet.dest_y > my_y ) {
+            packet.next_port = north_port;
+        }
+        else if ( packet.dest_y < my_y ) {
+            packet.next_port = south_port;
+        }
+        else {
+            if ( packet.dest_x > my_x ) {
+                packet.next_port = east_port;
+            }
+            else if ( packet.dest_x < my_x) {
+                packet.next_port = west_port;
+            }
+            else {
+                packet.next_port = packet.egress_port;
+            }
+        }
+    }
+
+    else {
+        // Compute next port
+        if ( packet.dest_x > my_x ) {
+            packet.next_port = east_port;
+        }
+        else if ( packet.dest_x < my_x) {
+            packet.next_port = west_port;
+        }
+        else {
+            if ( packet.dest_y > my_y ) {
+                packet.next_port = north_port;
+            }
+            else if ( packet.dest_y < my_y) {
+                packet.next_port = south_port;
+            }
+            else {
+                packet.next_port = packet.egress_port;
+            }
+        }
+    }
+}
+
+noc_mesh_monolithic::mesh_packet
+noc_mesh_monolithic::wrap_incoming_packet(NocPacket* packet)
+{
+    mesh_packet ret;
+    ret.encap_ev = packet;
+    ret.next_port = -1;
+
+    // Compute the destination router
+    int dest = packet->request->dest;
+
+    // Check to see if we have dense addressing
+    if ( use_dense_map ) {
+        dest = dense_map[dest];
+    }
+
+    int dest_rtr_id = dest / local_ports;
+    int x = dest_rtr_id % x_size;
+    int y = dest_rtr_id / x_size;
+
+    // Compute the egress port.  If this is in the halo, then it will
+    // be either north, south, east or west.  If it is not in the halo,
+    // it will be one of the local_ports.
+    if ( x == 0 ) {
+        x = 1;
+        ret.egress_port = west_port;
+    }
+    else if ( x == x_size - 1) {
+        x = x_size - 2;
+        ret.egress_port = east_port;
+    }
+    else if ( y == 0 ) {
+        y = 1;
+        ret.egress_port = south_port;
+    }
+    else if ( y == y_size - 1 ) {
+        y = y_size - 2;
+        ret.egress_port = north_port;
+    }
+    else {
+        ret.egress_port = local_port_start + (dest - (((y * x_size) + x ) * local_ports) );
+    }
+
+    ret.dest_x = x;
+    ret.dest_y = y;
+    return ret;
+}
+
+void
+noc_mesh_monolithic::push_packet(int port, const mesh_packet& packet)
+{
+    port_queues[port].push(packet);
+    router_queued[port / ports_per_router]++;
+    total_queued++;
+}
+
+void
+noc_mesh_monolithic::handle_input(Event* ev, int port)
+{
+    // Check type of event
+    BaseNocEvent* base_ev = static_cast<BaseNocEvent*>(ev);
+    switch ( base_ev->getType() ) {
+    case BaseNocEvent::CREDIT:
+    {
+        credit_event* credit_ret = static_cast<credit_event*>(ev);
+        port_credits[port] += credit_ret->credits;
+        delete ev;
+        break;
+    }
+    case BaseNocEvent::PACKET:
+    {
+        mesh_packet packet = wrap_incoming_packet(static_cast<NocPacket*>(ev));
+        route(port / ports_per_router, packet);
+
+        // Need to put the event into the proper queue
+        push_packet(port, packet);
+        if (clock_is_off)
+            clock_wakeup();
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void
+noc_mesh_monolithic::clock_wakeup()
+{
+    // Port occupancy is kept as the cycle the port frees up, so there
+    // is nothing to catch up on
+    reregisterClock(clock_tc, my_clock_handler);
+    clock_is_off = false;
+}
+
+bool
+noc_mesh_monolithic::clock_handler(Cycle_t cycle)
+{
+    // Deliver the packets and credits that crossed a link between
+    // routers and are visible this cycle
+    mesh_cycle& now = wheel[cycle & wheel_mask];
+    for ( auto& cr : now.credits ) {
+        port_credits[cr.port] += cr.credits;
+    }
+    for ( auto& arr : now.arrivals ) {
+        route(arr.port / ports_per_router, arr.packet);
+        push_packet(arr.port, arr.packet);
+    }
+    wheel_pending -= now.credits.size() + now.arrivals.size();
+    now.credits.clear();
+    now.arrivals.clear();
+
+    Cycle_t hop = cycle + hop_cycles;
+    int num_routers = routers_x * routers_y;
+
+    // A router with nothing queued would have its clock turned off (and
+    // an lru_unit with no requests comes out of a cycle unchanged), so
+    // only routers with queued packets need to be looked at
+    for ( int r = 0; r < num_routers; ++r ) {
+        if ( router_queued[r] == 0 ) continue;
+
+        int base = r * ports_per_router;
+
+        // Prioirty goes in order of the lru_units list.  First entry has
+        // highest priority, second has second highest, etc
+        for ( int u = 0; u < lru_units_per_router; ++u ) {
+            lru_unit<int>& lru = lru_units[r * lru_units_per_router + u];
+            for ( unsigned int i = 0; i < lru.size(); i++ ) {
+                int lru_port = lru.top();
+                port_queue_t& queue = port_queues[base + lru_port];
+                if ( queue.empty() ) {
+                    lru.satisfied(false);
+                    continue;
+                }
+
+                mesh_packet& packet = queue.front();
+
+                // Get the next port
+                int port = packet.next_port;
+                int out = base + port;
+
+                // Check to see if the port is busy
+                if ( port_busy_until[out] > cycle ) {
+                    xbar_stalls[out]->addData(1);
+                    lru.satisfied(false);
+                    continue;
+                }
+
+                // Check to see if there are enough credits to send on
+                // that port
+                int flits = packet.encap_ev->getSizeInFlits();
+                if ( port_credits[out] < flits ) {
+                    output_port_stalls[out]->addData(1);
+                    lru.satisfied(false);
+                    continue;
+                }
+
+                mesh_packet sent = packet;
+                queue.pop();
+                router_queued[r]--;
+                total_queued--;
+
+                port_credits[out] -= flits;
+                port_busy_until[out] = cycle + flits;
+                send_bit_count[out]->addData(sent.encap_ev->request->size_in_bits);
+
+                if ( sent.encap_ev->request->getTraceType() == SimpleNetwork::Request::FULL ) {
+                    output.output("TRACE(%d): %" PRIu64 " ns: Sent an event to router from router: (%d,%d)"
+                                  " (%s) on VC %d from src %" PRIu64 " to dest %" PRIu64 ".\n",
+                                  sent.encap_ev->request->getTraceID(),
+                                  getCurrentSimTimeNano(),
+                                  router_x(r), router_y(r),
+                                  getName().c_str(),
+                                  sent.encap_ev->vn,
+                                  sent.encap_ev->request->src,
+                                  sent.encap_ev->request->dest);
+                }
+
+                int next = neighbor(r, port);
+                if ( next == -1 ) {
+                    ports[out]->send(sent.encap_ev);
+                }
+                else {
+                    // The input port on the other side is the opposite
+                    // direction (north <-> south, east <-> west)
+                    wheel[hop & wheel_mask].arrivals.push_back({next * ports_per_router + (port ^ 1), sent});
+                    wheel_pending++;
+                }
+
+                // Need to send credits back to the last hop
+                int prev = neighbor(r, lru_port);
+                if ( prev == -1 ) {
+                    ports[base + lru_port]->send(new credit_event(0, flits));
+                }
+                else {
+                    wheel[hop & wheel_mask].credits.push_back({prev * ports_per_router + (lru_port ^ 1), flits});
+                    wheel_pending++;
+                }
+                lru.satisfied(true);
+            }
+        }
+    }
+
+    clock_is_off = ( total_queued == 0 && wheel_pending == 0 );
+
+    // Stay on clock list
+    return clock_is_off;
+}
+
+void
+noc_mesh_monolithic::setup()
+{
+    // Set up the lru units for each router the same way noc_mesh does:
+    // endpoint ports first and, unless all ports have equal priority,
+    // in a separate higher priority unit
+    int num_routers = routers_x * routers_y;
+    lru_units_per_router = port_priority_equal ? 1 : 2;
+    lru_units.resize(num_routers * lru_units_per_router);
+
+    for ( int r = 0; r < num_routers; ++r ) {
+        int base = r * ports_per_router;
+        lru_unit<int>* units = &lru_units[r * lru_units_per_router];
+
+        // First do the endpoints
+        for ( int i = local_port_start; i < ports_per_router; ++i ) {
+            if ( ports[base + i] != NULL ) {
+                units[0].insert(i);
+            }
+        }
+
+        if ( !port_priority_equal ) {
+            units[0].finalize();
+        }
+
+        // Now the mesh ports
+        lru_unit<int>& last = units[lru_units_per_router - 1];
+        for ( int i = 0; i < local_port_start; ++i ) {
+            if ( neighbor(r, i) != -1 || ports[base + i] != NULL ) {
+                last.insert(i);
+            }
+        }
+        last.finalize();
+    }
+}
+
+void
+noc_mesh_monolithic::finish()
+{
+}
+
+void
+noc_mesh_monolithic::init(unsigned int phase)
+{
+    // Init states:
+    // 0 - wait for endpoint messages
+    //
+    // 1 - recv messages from endpoints.  Since the whole mesh is
+    // known, all the endpoint ids can be computed right away.  Pass
+    // flit_size and the ids to the endpoints.
+    //
+    // 2 - Send all credit events
+    //
+    // 3 - Collect credits and route untimed data
+    int num_ports = ports.size();
+
+    switch ( init_state ) {
+    case 0:
+        // Phase 0 is only for endpoints to send a message
+        init_state = 1;
+        break;
+    case 1:
+    {
+        // Everything connected to the mesh has to be an endpoint
+        for ( int i = 0; i < num_ports; ++i ) {
+            if ( ports[i] == NULL ) continue;
+            NocInitEvent* nie = static_cast<NocInitEvent*>(ports[i]->recvUntimedData());
+            if ( nie == NULL || nie->command != NocInitEvent::REPORT_ENDPOINT ) {
+                output.fatal(CALL_INFO, -1, "noc_mesh_monolithic: ports can only be connected to endpoints\n");
+            }
+            port_endpoint[i] = true;
+            delete nie;
+        }
+
+        // Assign ids.  The dense ids are handed out in router order,
+        // and in order of sparse id within a router.
+        int num_routers = routers_x * routers_y;
+        for ( int r = 0; r < num_routers; ++r ) {
+            int base = r * ports_per_router;
+            std::vector<std::pair<int,int>> ep_ids;
+            for ( int i = 0; i < ports_per_router; ++i ) {
+                if ( port_endpoint[base + i] ) {
+                    ep_ids.push_back(std::make_pair(endpoint_id(r, i), base + i));
+                }
+            }
+
+            if ( use_dense_map ) {
+                std::sort(ep_ids.begin(), ep_ids.end());
+                for ( auto& ep : ep_ids ) {
+                    dense_map.push_back(ep.first);
+                    ep.first = total_endpoints++;
+                }
+            }
+            else {
+                total_endpoints += ep_ids.size();
+            }
+
+            for ( auto& ep : ep_ids ) {
+                NocInitEvent* nie = new NocInitEvent();
+                nie->command = NocInitEvent::REPORT_FLIT_SIZE;
+                nie->ua_value = UnitAlgebra("1b") * flit_size;
+                ports[ep.second]->sendUntimedData(nie);
+
+                nie = new NocInitEvent();
+                nie->command = NocInitEvent::REPORT_ENDPOINT_ID;
+                nie->int_value = ep.first;
+                ports[ep.second]->sendUntimedData(nie);
+            }
+        }
+
+        init_state = 2;
+        break;
+    }
+    case 2:
+        // Credits for the endpoints and for the input buffers of the
+        // neighboring routers
+        for ( int i = 0; i < num_ports; ++i ) {
+            if ( port_endpoint[i] ) {
+                ports[i]->sendUntimedData(new credit_event(0,input_buf_size/flit_size));
+            }
+            else if ( neighbor(i / ports_per_router, i % ports_per_router) != -1 ) {
+                port_credits[i] = input_buf_size/flit_size;
+            }
+        }
+        init_state = 3;
+        break;
+    default:
+        for ( int i = 0; i < num_ports; ++i ) {
+            if ( port_endpoint[i] ) route_untimed(i);
+        }
+        break;
+    }
+}
+
+void
+noc_mesh_monolithic::complete(unsigned int phase)
+{
+    int num_ports = ports.size();
+    for ( int i = 0; i < num_ports; ++i ) {
+        if ( port_endpoint[i] ) route_untimed(i);
+    }
+}
+
+void
+noc_mesh_monolithic::route_untimed(int port)
+{
+    // Untimed data goes straight to the destination endpoint(s)
+    Event* ev;
+    while ( ( ev = ports[port]->recvUntimedData() ) != NULL ) {
+        BaseNocEvent* bev = static_cast<BaseNocEvent*>(ev);
+        if ( bev->getType() == BaseNocEvent::CREDIT ) {
+            port_credits[port] += static_cast<credit_event*>(ev)->credits;
+            delete ev;
+            continue;
+        }
+
+        NocPacket* packet = static_cast<NocPacket*>(ev);
+        int dest = packet->request->dest;
+
+        if ( dest == SimpleNetwork::INIT_BROADCAST_ADDR ) {
+            // Send to all the endpoints except the source
+            bool sent = false;
+            for ( int j = 0; j < (int)ports.size(); ++j ) {
+                if ( j == port || !port_endpoint[j] ) continue;
+                if ( !sent ) {
+                    ports[j]->sendUntimedData(packet);
+                    sent = true;
+                }
+                else {
+                    ports[j]->sendUntimedData(packet->clone());
+                }
+            }
+            if ( !sent ) delete packet;
+            continue;
+        }
+
+        if ( use_dense_map ) {
+            dest = dense_map[dest];
+        }
+        int target = endpoint_port(dest);
+        if ( target == -1 || !port_endpoint[target] ) {
+            output.fatal(CALL_INFO, -1, "noc_mesh_monolithic: untimed data sent to %d, which is not an endpoint on the mesh\n",
+                         packet->request->dest);
+        }
+        ports[target]->sendUntimedData(packet);
+    }
+}
+
+void
+noc_mesh_monolithic::printStatus(Output& out)
+{
+    static const char* dir_names[] = { "North", "South", "East", "West" };
+    int num_routers = routers_x * routers_y;
+
+    for ( int r = 0; r < num_routers; ++r ) {
+        int base = r * ports_per_router;
+        out.output("Start Router %s:  id = (%d, %d)\n", getName().c_str(), router_x(r), router_y(r));
+
+        for ( int i = 0; i < ports_per_router; ++i ) {
+            if ( i < local_port_start ) {
+                out.output("  %s port:\n", dir_names[i]);
+            }
+            else {
+                out.output("  local_port%d port:\n", i - local_port_start);
+            }
+            if ( ports[base + i] == NULL && neighbor(r, i) == -1 ) {
+                out.output("    UNUSED\n");
+                continue;
+            }
+            Cycle_t now = getCurrentSimTime(clock_tc);
+            out.output("    Port busy = %" PRIu64 "\n", port_busy_until[base + i] > now ? port_busy_until[base + i] - now : 0);
+            out.output("    Port credits = %d\n",port_credits[base + i]);
+            out.output("    Input queue total packets = %lu, head packet info:\n",port_queues[base + i].size());
+            if ( port_queues[base + i].empty() ) {
+                out.output("      <empty>\n");
+            }
+            else {
+                const mesh_packet& packet = port_queues[base + i].front();
+                out.output("      src = %lld, dest = %lld, next_port = %d, flits = %d\n",
+                           packet.encap_ev->request->src, packet.encap_ev->request->dest,
+                           packet.next_port, packet.encap_ev->getSizeInFlits());
+            }
+        }
+
+        out.output("End Router %s: id = (%d, %d)\n\n", getName().c_str(), router_x(r), router_y(r));
+    }
+}
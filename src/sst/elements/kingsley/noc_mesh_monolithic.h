@@ -0,0 +1,224 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_KINGSLEY_NOC_MESH_MONOLITHIC_H
+#define COMPONENTS_KINGSLEY_NOC_MESH_MONOLITHIC_H
+
+#include <sst/core/clock.h>
+#include <sst/core/component.h>
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/output.h>
+#include <sst/core/timeConverter.h>
+
+#include <sst/core/statapi/stataccumulator.h>
+
+#include <queue>
+#include <vector>
+
+#include "sst/elements/kingsley/nocEvents.h"
+#include "sst/elements/kingsley/lru_unit.h"
+
+using namespace SST;
+
+namespace SST {
+namespace Kingsley {
+
+// Simulates a whole x_size by y_size mesh of noc_mesh routers inside a
+// single component.  Only the ports that would connect a noc_mesh to an
+// endpoint are links; packets and credits moving between routers are
+// kept in internal queues, so a hop costs no link events and routers
+// with nothing queued cost nothing per cycle.
+//
+// Routing, arbitration, credits and port occupancy follow noc_mesh
+// exactly, so the timing and statistics match a mesh of noc_mesh
+// routers whose router to router links all have a latency of
+// link_latency.
+class noc_mesh_monolithic : public Component {
+
+public:
+
+    SST_ELI_REGISTER_COMPONENT(
+        noc_mesh_monolithic,
+        "kingsley",
+        "noc_mesh_monolithic",
+        SST_ELI_ELEMENT_VERSION(0,1,0),
+        "Complete 2-D mesh NOC simulated in a single component",
+        COMPONENT_CATEGORY_NETWORK)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"x_size",             "Number of routers in the X dimension."},
+        {"y_size",             "Number of routers in the Y dimension."},
+        {"local_ports",        "Number of ports on each router that are dedicated to endpoints.","1"},
+        {"link_bw",            "Bandwidth of the links specified in either b/s or B/s (can include SI prefix)."},
+        {"link_latency",       "Latency of the links between routers inside the mesh (can include SI prefix)."},
+        {"flit_size",          "Flit size specified in either b or B (can include SI prefix)."},
+        {"input_buf_size",     "Size of input buffers in either b or B (can use SI prefix).  Default is 2*flit_size."},
+        {"port_priority_equal","Set to true to have all port have equal priority (usually endpoint ports have higher priority).","false"},
+        {"route_y_first",      "Set to true to rout Y-dimension first.","false"},
+        {"use_dense_map",      "Set to true to have a dense network id map instead of the sparse map normally used.","false"},
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+        {"local%(local_ports)d", "Ports which connect to endpoints.  Port local<n> is local port (n % local_ports) of router "
+                                 "n / local_ports, where router (x,y) is number y * x_size + x.", { } },
+        {"north%(x_size)d",      "Ports off the north edge of the mesh, one per column.", { } },
+        {"south%(x_size)d",      "Ports off the south edge of the mesh, one per column.", { } },
+        {"east%(y_size)d",       "Ports off the east edge of the mesh, one per row.", { } },
+        {"west%(y_size)d",       "Ports off the west edge of the mesh, one per row.", { } }
+    )
+
+    // Statistics are kept per router port with subids of the form
+    // rtr_<x>_<y>_<port> (e.g. rtr_0_3_north, rtr_2_2_local0)
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "send_bit_count",     "Count number of bits sent on link", "bits", 1},
+        { "output_port_stalls", "Time output port is stalled (in units of core timebase)", "time in stalls", 1},
+        { "xbar_stalls",        "Count number of cycles the xbar is stalled", "cycles", 1},
+    )
+
+    static const int north_port = 0;
+    static const int south_port = 1;
+    static const int east_port = 2;
+    static const int west_port = 3;
+    static const int local_port_start = 4;
+
+private:
+
+    // A packet inside the mesh.  Same routing information as
+    // noc_mesh_event, but never sent on a link.
+    struct mesh_packet {
+        NocPacket* encap_ev;
+        int dest_x;
+        int dest_y;
+        int egress_port;
+        int next_port;
+    };
+
+    // Packet or credits that reach a router port at a later cycle
+    struct mesh_arrival {
+        int port;
+        mesh_packet packet;
+    };
+
+    struct mesh_credit {
+        int port;
+        int credits;
+    };
+
+    struct mesh_cycle {
+        std::vector<mesh_arrival> arrivals;
+        std::vector<mesh_credit> credits;
+    };
+
+    typedef std::queue<mesh_packet> port_queue_t;
+
+    int init_state;
+    int total_endpoints;
+
+    int flit_size;
+    int input_buf_size;
+
+    // Number of routers in each dimension
+    int routers_x;
+    int routers_y;
+
+    // Size of the mesh including the virtual halo of endpoints, as
+    // used by noc_mesh to assign network ids
+    int x_size;
+    int y_size;
+
+    int local_ports;
+    int ports_per_router;
+    bool route_y_first;
+    bool use_dense_map;
+    bool port_priority_equal;
+
+    std::vector<int> dense_map;
+
+    Clock::Handler<noc_mesh_monolithic>* my_clock_handler;
+    TimeConverter* clock_tc;
+    bool clock_is_off;
+
+    // Number of cycles for a packet or credit to cross a link between
+    // two routers
+    int hop_cycles;
+
+    // Packets and credits in flight between routers, indexed by
+    // arrival cycle modulo the size of the wheel
+    std::vector<mesh_cycle> wheel;
+    Cycle_t wheel_mask;
+    size_t wheel_pending;
+
+    // Router port state, indexed by router * ports_per_router + port.
+    // Links are NULL for ports between routers and for unconnected
+    // edge ports.
+    std::vector<Link*> ports;
+    std::vector<port_queue_t> port_queues;
+    std::vector<Cycle_t> port_busy_until;
+    std::vector<int> port_credits;
+    std::vector<bool> port_endpoint;
+
+    // Packets queued in each router
+    std::vector<int> router_queued;
+    int total_queued;
+
+    // lru_units_per_router units for each router, in priority order
+    std::vector< lru_unit<int> > lru_units;
+    int lru_units_per_router;
+
+    Output& output;
+
+    std::vector<Statistic<uint64_t>*> send_bit_count;
+    std::vector<Statistic<uint64_t>*> output_port_stalls;
+    std::vector<Statistic<uint64_t>*> xbar_stalls;
+
+    int router_x(int router) const { return router % routers_x + 1; }
+    int router_y(int router) const { return router / routers_x + 1; }
+
+    // Router on the other side of port, or -1 if the port is on the
+    // edge of the mesh
+    int neighbor(int router, int port) const;
+
+    int endpoint_id(int router, int port) const;
+    int endpoint_port(int id) const;
+
+    mesh_packet wrap_incoming_packet(NocPacket* packet);
+    void route(int router, mesh_packet& packet);
+    void push_packet(int port, const mesh_packet& packet);
+
+    void handle_input(Event* ev, int port);
+    bool clock_handler(Cycle_t cycle);
+    void clock_wakeup();
+
+    void route_untimed(int port);
+
+public:
+    noc_mesh_monolithic(ComponentId_t cid, Params& params);
+    ~noc_mesh_monolithic();
+
+    void init(unsigned int phase);
+    void complete(unsigned int phase);
+    void setup();
+    void finish();
+
+    void printStatus(Output& out);
+
+};
+
+}
+}
+
+#endif // COMPONENTS_KINGSLEY_NOC_MESH_MONOLITHIC_H
@@ -0,0 +1,72 @@
+# Same network as noc_mesh_32_test.py, with the whole mesh simulated by a
+# single kingsley.noc_mesh_monolithic component
+import sst
+
+sst.setProgramOption("timebase", "1ps")
+
+x_size = 4
+y_size = 4
+
+num_endpoints = 1
+
+num_peers = (num_endpoints * (x_size * y_size)) + (2*x_size) + (2*y_size)
+num_messages = 10
+msg_size = "64B"
+link_bw = "32GB/s"
+flit_size = "32B"
+input_buf_size = "64B"
+
+mesh = sst.Component("mesh", "kingsley.noc_mesh_monolithic")
+mesh.addParams({
+    "x_size" : x_size,
+    "y_size" : y_size,
+    "local_ports" : "%d"%(num_endpoints),
+    "link_bw" : link_bw,
+    "link_latency" : "800ps",
+    "input_buf_size" : input_buf_size,
+    "flit_size" : flit_size,
+    "use_dense_map" : "true"
+})
+
+def addEndpoint(name, port):
+    ep = sst.Component(name, "merlin.test_nic")
+    ep.addParams({
+        "num_peers" : "%d"%(num_peers),
+        "link_bw" : "1GB/s",
+        "linkcontrol_type" : "kingsley.linkcontrol",
+        "message_size" : msg_size,
+        "num_messages" : "%d"%(num_messages)
+    })
+    sub = ep.setSubComponent("networkIF","kingsley.linkcontrol")
+    sub.addParam("link_bw","1GB/s")
+
+    link = sst.Link("link.mesh_%s"%(port))
+    mesh.addLink(link, port, "800ps")
+    sub.addLink(link, "rtr_port", "800ps")
+
+for y in range(y_size):
+    for x in range(x_size):
+        # Endpoints on the edge of the mesh
+        if y == y_size - 1:
+            addEndpoint("ep0_%d_%d"%(x,y+1), "north%d"%(x))
+        if y == 0:
+            addEndpoint("ep0_%d_X"%(x), "south%d"%(x))
+        if x == x_size - 1:
+            addEndpoint("ep0_%d_%d"%(x+1,y), "east%d"%(y))
+        if x == 0:
+            addEndpoint("ep0_X_%d"%(y), "west%d"%(y))
+
+        # Add endpoints
+        for z in range(num_endpoints):
+            addEndpoint("ep%d_%d_%d"%(z,x,y), "local%d"%((y * x_size + x) * num_endpoints + z))
+
+
+sst.setStatisticLoadLevel(9)
+
+sst.setStatisticOutput("sst.statOutputCSV");
+sst.setStatisticOutputOptions({
+    "filepath" : "stats.csv",
+    "separator" : ", "
+})
+
+sst.enableAllStatisticsForComponentType("kingsley.noc_mesh_monolithic", {"type":"sst.AccumulatorStatistic","rate":"0ns"})
@@ -46,6 +46,9 @@ class testcase_kingsley_Component(SSTTestCase):
     def test_kingsly_noc_mesh_32(self):
         self.kingsley_test_template("noc_mesh_32_test")
 
+    def test_kingsley_noc_mesh_monolithic_32(self):
+        self.kingsley_test_template("noc_mesh_monolithic_32_test")
+
 #####
 
     def kingsley_test_template(self, testcase):
@@ -95,6 +95,7 @@ void Cache::processPrefetchEvent(SST::Event * ev) {
 
 /* Clock handler */
 bool Cache::clockTick(Cycle_t time) {
+    SST::Merlin::HostProfile::Scope profile(hostProfile_);
     timestamp_++;
 
     // Drain any outgoing messages
@@ -185,6 +186,9 @@ bool Cache::clockTick(Cycle_t time) {
     std::copy( rBuf->begin(), rBuf->end(), std::back_inserter(retryBuffer_) );
     coherenceMgr_->clearRetryBuffer();
 
+    if (accepted == 0 && idle)
+        profile.setIdle();
+
     idle &= coherenceMgr_->checkIdle();
 
     // Disable lower-level cache clocks if they're idle
@@ -537,6 +541,7 @@ void Cache::finish() {
         listeners_[i]->printStats(*out_);
     linkDown_->finish();
     if (linkUp_ != linkDown_) linkUp_->finish();
+    hostProfile_.finish();
 }
 
 
@@ -35,6 +35,7 @@
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/cacheListener.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
+#include "sst/elements/merlin/hostProfile.h"
 
 namespace SST { namespace MemHierarchy {
 
@@ -90,6 +91,8 @@ public:
             {"force_noncacheable_reqs", "(bool) Used for verification purposes. All requests are considered to be 'noncacheable'. Options: 0[off], 1[on]", "false"},
             {"min_packet_size",         "(string) Number of bytes in a request/response not including payload (e.g., addr + cmd). Specify in B.", "8B"},
             {"banks",                   "(uint) Number of cache banks: One access per bank per cycle. Use '0' to simulate no bank limits (only limits on bandwidth then are max_requests_per_cycle and *_link_width", "0"},
+            {"host_profile",            "(bool) Measure host time spent in the clock handler. Results are reported as statistics and as a table at the end of simulation.", "false"},
+            {"host_profile_top_n",      "(uint) Number of handlers to list in the host profile table printed at finish.", "10"},
             /* Old parameters - deprecated or moved */
             {"network_address",             "DEPRECATED - Now auto-detected by link control."}, // Remove 9.0
             {"network_bw",                  "MOVED - Now a member of the MemNIC subcomponent.", "80GiB/s"}, // Remove 9.0
@@ -157,6 +160,10 @@ public:
             {"GetSX_uncache_recv",      "Noncacheable Event: GetSX received", "count", 4},
             {"GetSResp_uncache_recv",   "Noncacheable Event: GetSResp received", "count", 4},
             {"WriteResp_uncache_recv",  "Noncacheable Event: WriteResp received", "count", 4},
+            {"host_time_ns",            "Host time spent in the clock handler (requires host_profile)", "nanoseconds", 1},
+            {"host_calls",              "Clock handler calls (requires host_profile)", "count", 1},
+            {"host_busy_calls",         "Clock handler calls that handled an event or had events to send (requires host_profile)", "count", 1},
+            {"host_idle_calls",         "Clock handler calls that found nothing to do (requires host_profile)", "count", 1},
             {"default_stat",            "Default statistic used for unexpected events/cases/etc. Should be 0, if not, check for missing statistic registrations.", "none", 7})
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
@@ -310,6 +317,9 @@ private:
     Statistic<uint64_t>* statRetryEvents;
     Statistic<uint64_t>* statUncacheRecv[(int)Command::LAST_CMD];
     Statistic<uint64_t>* statCacheRecv[(int)Command::LAST_CMD];
+
+    // Host time profile of clockTick, off unless host_profile is set
+    SST::Merlin::HostProfile hostProfile_;
 };
 
 }}
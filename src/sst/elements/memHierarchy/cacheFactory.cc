@@ -85,6 +85,12 @@ Cache::Cache(ComponentId_t id, Params &params) : Component(id) {
     /* Register statistics */
     registerStatistics();
 
+    if (params.find<bool>("host_profile", false)) {
+        hostProfile_.enable(getName(), "Cache", params.find<int>("host_profile_top_n", 10),
+                registerStatistic<uint64_t>("host_time_ns"), registerStatistic<uint64_t>("host_calls"),
+                registerStatistic<uint64_t>("host_busy_calls"), registerStatistic<uint64_t>("host_idle_calls"));
+    }
+
 }
 
 
@@ -724,14 +724,10 @@ void CoherenceController::printStatus(Output& out) {
     out.output("  Begin MemHierarchy::CoherenceController %s\n", getName().c_str());
 
     out.output("    Events waiting in outgoingEventQueueDown: %zu\n", outgoingEventQueueDown_.size());
-    for (list<Response>::iterator it = outgoingEventQueueDown_.begin(); it!= outgoingEventQueueDown_.end(); it++) {
-        out.output("      Time: %" PRIu64 ", Event: %s\n", (*it).deliveryTime, (*it).event->getVerboseString().c_str());
-    }
+    outgoingEventQueueDown_.printStatus(out);
 
     out.output("    Events waiting in outgoingEventQueueUp: %zu\n", outgoingEventQueueUp_.size());
-    for (list<Response>::iterator it = outgoingEventQueueUp_.begin(); it!= outgoingEventQueueUp_.end(); it++) {
-        out.output("      Time: %" PRIu64 ", Event: %s\n", (*it).deliveryTime, (*it).event->getVerboseString().c_str());
-    }
+    outgoingEventQueueUp_.printStatus(out);
 
     out.output("  End MemHierarchy::CoherenceController\n");
 }
@@ -748,24 +744,103 @@ void CoherenceController::printStatus(Output& out) {
  * a block and then re-request it, the requests can get inverted.
  */
 void CoherenceController::addToOutgoingQueue(Response& resp) {
-    list<Response>::reverse_iterator rit;
-    for (rit = outgoingEventQueueDown_.rbegin(); rit!= outgoingEventQueueDown_.rend(); rit++) {
-        if (resp.deliveryTime >= (*rit).deliveryTime) break;
-        if (resp.event->getRoutingAddress() == (*rit).event->getRoutingAddress()) break;
-    }
-    outgoingEventQueueDown_.insert(rit.base(), resp);
+    outgoingEventQueueDown_.insert(resp);
 }
 
 /* Add a new event to the outgoing queue up (towards memory)
  * Again, to do not reorder events to the same address
  */
 void CoherenceController::addToOutgoingQueueUp(Response& resp) {
-    list<Response>::reverse_iterator rit;
-    for (rit = outgoingEventQueueUp_.rbegin(); rit != outgoingEventQueueUp_.rend(); rit++) {
-        if (resp.deliveryTime >= (*rit).deliveryTime) break;
-        if (resp.event->getRoutingAddress() == (*rit).event->getRoutingAddress()) break;
+    outgoingEventQueueUp_.insert(resp);
+}
+
+/* Insert after the last queued event that is either due no later than resp or to the same address.
+ * Every bucket's key is at least the delivery time of the events in it, so buckets keyed at or
+ * before resp's delivery time end with such an event and later buckets only need to be searched
+ * if they may hold one.
+ */
+void CoherenceController::OutgoingQueue::insert(Response& resp) {
+    Addr addr = resp.event->getRoutingAddress();
+    std::unordered_map<Addr, AddrInfo>::iterator addrIt = addrs_.find(addr);
+    bool addrQueued = addrIt != addrs_.end();
+
+    uint64_t key = resp.deliveryTime;
+    bool inserted = false;
+
+    for (std::map<uint64_t, Bucket>::reverse_iterator rit = buckets_.rbegin(); rit != buckets_.rend(); rit++) {
+        if (rit->first <= resp.deliveryTime) break;
+
+        Bucket& bucket = rit->second;
+        if (bucket.minDelivery > resp.deliveryTime && !(addrQueued && addrIt->second.bucket == rit->first))
+            continue;
+
+        size_t index = bucket.events.size();
+        while (index > bucket.head) {
+            Response& queued = bucket.events[index - 1];
+            if (resp.deliveryTime >= queued.deliveryTime) break;
+            if (addr == queued.event->getRoutingAddress()) break;
+            index--;
+        }
+
+        if (index > bucket.head) {
+            bucket.events.insert(bucket.events.begin() + index, resp);
+            bucket.minDelivery = std::min(bucket.minDelivery, resp.deliveryTime);
+            key = rit->first;
+            inserted = true;
+            break;
+        }
+    }
+
+    if (!inserted) {
+        std::pair<std::map<uint64_t, Bucket>::iterator, bool> entry = buckets_.emplace(key, Bucket());
+        Bucket& bucket = entry.first->second;
+        if (entry.second) {
+            if (!spare_.empty()) {
+                bucket.events.swap(spare_.back());
+                spare_.pop_back();
+            }
+            bucket.head = 0;
+            bucket.minDelivery = resp.deliveryTime;
+        }
+        bucket.events.push_back(resp);
+        bucket.minDelivery = std::min(bucket.minDelivery, resp.deliveryTime);
+    }
+
+    if (addrQueued) {
+        addrIt->second.count++;
+        addrIt->second.bucket = key;
+    } else {
+        addrs_.emplace(addr, AddrInfo{1, key});
+    }
+    size_++;
+}
+
+void CoherenceController::OutgoingQueue::pop_front() {
+    std::map<uint64_t, Bucket>::iterator it = buckets_.begin();
+    Bucket& bucket = it->second;
+
+    std::unordered_map<Addr, AddrInfo>::iterator addrIt = addrs_.find(bucket.events[bucket.head].event->getRoutingAddress());
+    if (--(addrIt->second.count) == 0)
+        addrs_.erase(addrIt);
+
+    bucket.head++;
+    size_--;
+
+    if (bucket.head == bucket.events.size()) {
+        bucket.events.clear();
+        spare_.push_back(std::vector<Response>());
+        spare_.back().swap(bucket.events);
+        buckets_.erase(it);
+    }
+}
+
+void CoherenceController::OutgoingQueue::printStatus(Output& out) {
+    for (std::map<uint64_t, Bucket>::iterator it = buckets_.begin(); it != buckets_.end(); it++) {
+        for (size_t i = it->second.head; i < it->second.events.size(); i++) {
+            Response& resp = it->second.events[i];
+            out.output("      Time: %" PRIu64 ", Event: %s\n", resp.deliveryTime, resp.event->getVerboseString().c_str());
+        }
     }
-    outgoingEventQueueUp_.insert(rit.base(), resp);
 }
 
 
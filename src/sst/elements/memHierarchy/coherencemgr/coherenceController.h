@@ -16,7 +16,11 @@
 #ifndef MEMHIERARCHY_COHERENCECONTROLLER_H
 #define MEMHIERARCHY_COHERENCECONTROLLER_H
 
+#include <algorithm>
 #include <array>
+#include <map>
+#include <unordered_map>
+#include <vector>
 
 #include <sst/core/sst_config.h>
 #include <sst/core/subcomponent.h>
@@ -284,6 +288,46 @@ protected:
         uint64_t size;          // Size of event (for bandwidth accounting)
     };
 
+    /* Outgoing event queue
+     * Events are kept in delivery time order without re-ordering events to the same address.
+     * They are bucketed by the earliest cycle they can be sent given the events ahead of them,
+     * so an insert only searches the few buckets later than its own delivery time instead of
+     * walking a list, and buckets reuse their storage.
+     */
+    class OutgoingQueue {
+    public:
+        OutgoingQueue() : size_(0) { }
+
+        bool empty() const { return size_ == 0; }
+        size_t size() const { return size_; }
+
+        Response& front() {
+            Bucket& bucket = buckets_.begin()->second;
+            return bucket.events[bucket.head];
+        }
+
+        void pop_front();
+        void insert(Response& resp);
+        void printStatus(Output& out);
+
+    private:
+        struct Bucket {
+            std::vector<Response> events;
+            size_t head;            // Events before head have been sent
+            uint64_t minDelivery;   // Lower bound on the delivery time of the events in this bucket
+        };
+
+        struct AddrInfo {
+            uint64_t count;         // Number of queued events to this address
+            uint64_t bucket;        // Bucket holding the last one
+        };
+
+        std::map<uint64_t, Bucket> buckets_;
+        std::unordered_map<Addr, AddrInfo> addrs_;
+        std::vector<std::vector<Response> > spare_;
+        size_t size_;
+    };
+
     /* Retry buffer - filled by coherence manangers and drained by parent */
     std::vector<MemEventBase*> retryBuffer_;
 
@@ -318,8 +362,8 @@ protected:
 
 private:
     /* Outgoing event queues - events are stalled here to account for access latencies */
-    list<Response> outgoingEventQueueDown_;
-    list<Response> outgoingEventQueueUp_;
+    OutgoingQueue outgoingEventQueueDown_;
+    OutgoingQueue outgoingEventQueueUp_;
 
     MemLinkBase * linkUp_;
     MemLinkBase * linkDown_;
@@ -102,6 +102,7 @@ void CoherentMemController::processInitEvent(MemEventInit* me) {
  * 'timestamp_' is used to delay events in the queue and does not need to be sync'd with 'cycle' when the clock is reenabled
  */
 bool CoherentMemController::clock(Cycle_t cycle) {
+    SST::Merlin::HostProfile::Scope profile(hostProfile_);
     timestamp_++;
 
     bool debug = false;
@@ -123,6 +124,7 @@ bool CoherentMemController::clock(Cycle_t cycle) {
     bool unclockBack = memBackendConvertor_->clock(cycle); /* OK to unclock backend? */
 
     if (unclockLink && unclockBack && msgQueue_.empty()) {
+        profile.setIdle();
         memBackendConvertor_->turnClockOff();
         clockOn_ = false;
         return true;
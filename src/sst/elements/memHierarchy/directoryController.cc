@@ -294,6 +294,12 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
     stat_dirEntryWrites             = registerStatistic<uint64_t>("eventSent_write_directory_entry");
     stat_MSHROccupancy              = registerStatistic<uint64_t>("MSHR_occupancy");
 
+    if (params.find<bool>("host_profile", false)) {
+        hostProfile.enable(getName(), "DirectoryController", params.find<int>("host_profile_top_n", 10),
+                registerStatistic<uint64_t>("host_time_ns"), registerStatistic<uint64_t>("host_calls"),
+                registerStatistic<uint64_t>("host_busy_calls"), registerStatistic<uint64_t>("host_idle_calls"));
+    }
+
     // Coherence part
 
     if (!memLink)
@@ -362,6 +368,7 @@ void DirectoryController::handlePacket(SST::Event *event){
  *  Called each cycle. Handle any waiting events in the queue.
  */
 bool DirectoryController::clock(SST::Cycle_t cycle){
+    SST::Merlin::HostProfile::Scope profile(hostProfile);
     timestamp = cycle;
     stat_MSHROccupancy->addData(mshr->getSize());
 
@@ -418,6 +425,9 @@ bool DirectoryController::clock(SST::Cycle_t cycle){
     idle &= (eventBuffer.empty() && retryBuffer.empty());
     idle &= (cpuMsgQueue.empty() && memMsgQueue.empty());
 
+    if (requestsThisCycle == 0 && idle)
+        profile.setIdle();
+
    if (idle && clockOn) {
         clockOn = false;
         lastActiveClockCycle = timestamp;
@@ -707,6 +717,7 @@ void DirectoryController::init(unsigned int phase) {
 
 void DirectoryController::finish(void){
     cpuLink->finish();
+    hostProfile.finish();
 }
 
 
@@ -37,6 +37,7 @@
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/mshr.h"
+#include "sst/elements/merlin/hostProfile.h"
 
 using namespace std;
 
@@ -68,6 +69,8 @@ public:
             {"interleave_size",         "Size of interleaved chunks. E.g., to interleave 8B chunks among 3 directories, set size=8B, step=24B", "0B"},
             {"interleave_step",         "Distance between interleaved chunks. E.g., to interleave 8B chunks among 3 directories, set size=8B, step=24B", "0B"},
             {"node",					"Node number in multinode environment"},
+            {"host_profile",            "Measure host time spent in the clock handler. Results are reported as statistics and as a table at the end of simulation.", "false"},
+            {"host_profile_top_n",      "Number of handlers to list in the host profile table printed at finish.", "10"},
             /* Old parameters - deprecated or moved */
             {"network_num_vc",          "DEPRECATED. Number of virtual channels (VCs) on the on-chip network. memHierarchy only uses one VC.", "1"}, // Remove SST 9.0
             {"network_address",         "DEPRECATD - Now auto-detected by link control", ""},   // Remove SST 9.0
@@ -139,6 +142,10 @@ public:
             {"eventSent_FlushLineInv",  "Event sent: FlushLineInv", "count", 2},
             {"eventSent_FlushLineResp", "Event sent: FlushLineResp", "count", 2},
             {"MSHR_occupancy",          "Number of events in MSHR each cycle",  "events",       1},
+            {"host_time_ns",            "Host time spent in the clock handler (requires host_profile)", "nanoseconds", 1},
+            {"host_calls",              "Clock handler calls (requires host_profile)", "count", 1},
+            {"host_busy_calls",         "Clock handler calls that handled an event or had events to send (requires host_profile)", "count", 1},
+            {"host_idle_calls",         "Clock handler calls that found nothing to do (requires host_profile)", "count", 1},
             {"default_stat",            "Default statistic. If not 0 then a statistic is missing", "", 1})
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
@@ -184,6 +191,8 @@ private:
 
     Statistic<uint64_t> * stat_MSHROccupancy;
 
+    SST::Merlin::HostProfile hostProfile;
+
     /* Queue of packets to work on */
     std::list<MemEvent*> eventBuffer;
     std::list<MemEvent*> retryBuffer;
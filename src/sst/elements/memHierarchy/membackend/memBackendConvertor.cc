@@ -49,6 +49,8 @@ MemBackendConvertor::MemBackendConvertor(ComponentId_t id, Params& params, MemBa
 
     m_clockBackend = m_backend->isClocked();
 
+    m_coalesce = params.find<bool>("coalesce_requests", false);
+
     stat_GetSReqReceived    = registerStatistic<uint64_t>("requests_received_GetS");
     stat_GetSXReqReceived   = registerStatistic<uint64_t>("requests_received_GetSX");
     stat_GetXReqReceived    = registerStatistic<uint64_t>("requests_received_GetX");
@@ -64,6 +66,8 @@ MemBackendConvertor::MemBackendConvertor(ComponentId_t id, Params& params, MemBa
     stat_cyclesWithIssue = registerStatistic<uint64_t>( "cycles_with_issue" );
     stat_cyclesAttemptIssueButRejected = registerStatistic<uint64_t>( "cycles_attempted_issue_but_rejected" );
     stat_totalCycles = registerStatistic<uint64_t>( "total_cycles" );;
+    stat_forwardedReqs = registerStatistic<uint64_t>( "requests_forwarded" );
+    stat_coalescedReqs = registerStatistic<uint64_t>( "requests_coalesced" );
 
     m_clockOn = true; /* Maybe parent should set this */
 }
@@ -87,6 +91,86 @@ void MemBackendConvertor::handleMemEvent(  MemEvent* ev ) {
     }
 }
 
+bool MemBackendConvertor::setupMemReq( MemEvent* ev ) {
+    LineIndex::iterator line = m_lineIndex.find(ev->getBaseAddr());
+
+    if ( Command::FlushLine == ev->getCmd() || Command::FlushLineInv == ev->getCmd() ) {
+        // Flush waits for every request to the line that has not finished issuing
+        if (line == m_lineIndex.end())
+            return false;
+
+        uint32_t dependsOn = 0;
+        for (std::list<MemReq*>::iterator it = line->second.begin(); it != line->second.end(); it++) {
+            if ((*it)->issueDone())
+                continue;
+            (*it)->addDependent(ev);
+            dependsOn++;
+        }
+
+        if (dependsOn == 0) return false;
+        m_waitingFlushes.insert(std::make_pair(ev, dependsOn));
+        return true;
+    }
+
+    // Satisfy the request from the most recent write to the line if possible
+    // Data is read/written by the parent when responses are sent, so completing
+    // dependents in arrival order after the write keeps data consistent
+    if (m_coalesce && line != m_lineIndex.end()) {
+        MemReq* last = line->second.back();
+        if (last->isWrite() && last->covers(ev)) {
+            Command cmd = ev->getCmd();
+            if (cmd == Command::GetS || cmd == Command::GetSX || cmd == Command::GetX) {
+                Debug(_L10_, "Forwarding read from pending write. %s\n", last->getString().c_str());
+                last->addDependent(ev);
+                stat_forwardedReqs->addData(1);
+                return true;
+            } else if ((cmd == Command::PutM || cmd == Command::Write) && last->processed() == 0) {
+                Debug(_L10_, "Coalescing write into pending write. %s\n", last->getString().c_str());
+                last->addDependent(ev);
+                stat_coalescedReqs->addData(1);
+                return true;
+            }
+        }
+    }
+
+    uint32_t id = genReqId();
+    MemReq* req = new MemReq( ev, id );
+    m_requestQueue.push_back( req );
+    m_pendingRequests[id] = req;
+
+    if (line == m_lineIndex.end())
+        line = m_lineIndex.insert(std::make_pair(ev->getBaseAddr(), std::list<MemReq*>())).first;
+    req->setLinePos(line->second.insert(line->second.end(), req));
+    return true;
+}
+
+void MemBackendConvertor::removeFromLineIndex( MemReq* req ) {
+    LineIndex::iterator line = m_lineIndex.find(req->baseAddr());
+    line->second.erase(req->getLinePos());
+    if (line->second.empty())
+        m_lineIndex.erase(line);
+}
+
+/*
+ * Respond to the flushes, forwarded reads and coalesced writes that were waiting on req
+ */
+void MemBackendConvertor::completeDependents( MemReq* req ) {
+    std::vector<MemEvent*>& dependents = req->getDependents();
+    for (std::vector<MemEvent*>::iterator it = dependents.begin(); it != dependents.end(); it++) {
+        MemEvent* dep = *it;
+        if (dep->getCmd() == Command::FlushLine || dep->getCmd() == Command::FlushLineInv) {
+            std::unordered_map<MemEvent*, uint32_t>::iterator flush = m_waitingFlushes.find(dep);
+            if (--(flush->second) == 0) {
+                sendResponse(dep->getID(), dep->getFlags());
+                m_waitingFlushes.erase(flush);
+            }
+        } else {
+            doResponseStat( dep->getCmd(), m_cycleCount - dep->getDeliveryTime() );
+            sendResponse(dep->getID(), dep->getFlags());
+        }
+    }
+}
+
 void MemBackendConvertor::handleCustomEvent( Interfaces::StandardMem::CustomData * info, Event::id_type evId, std::string rqstr) {
     uint32_t id = genReqId();
     CustomReq* req = new CustomReq( info, evId, rqstr, id );
@@ -196,25 +280,14 @@ void MemBackendConvertor::doResponse( ReqId reqId, uint32_t flags ) {
 
             doResponseStat( event->getCmd(), latency );
 
+            MemReq* mreq = static_cast<MemReq*>(req);
+            removeFromLineIndex(mreq); // Before the response since the parent deletes the event
+
             if (!flags) flags = event->getFlags();
-            SST::Event::id_type evID = event->getID();
-            sendResponse(event->getID(), flags); // Needs to occur before a flush is completed since flush is dependent
+            sendResponse(event->getID(), flags); // Needs to occur before dependents are completed since they depend on it
 
             // TODO clock responses
-            // Check for flushes that are waiting on this event to finish
-            if (m_dependentRequests.find(evID) != m_dependentRequests.end()) {
-                std::set<MemEvent*, memEventCmp> flushes = m_dependentRequests.find(evID)->second;
-
-                for (std::set<MemEvent*, memEventCmp>::iterator it = flushes.begin(); it != flushes.end(); it++) {
-                    (m_waitingFlushes.find(*it)->second).erase(evID);
-                    if ((m_waitingFlushes.find(*it)->second).empty()) {
-                        MemEvent * flush = *it;
-                        sendResponse(flush->getID(), flush->getFlags());
-                        m_waitingFlushes.erase(flush);
-                    }
-                }
-                m_dependentRequests.erase(evID);
-            }
+            completeDependents(mreq);
         }
         delete req;
     }
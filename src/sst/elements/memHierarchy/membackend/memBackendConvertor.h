@@ -21,6 +21,9 @@
 #include <sst/core/event.h>
 #include <sst/core/warnmacros.h>
 
+#include <list>
+#include <unordered_map>
+
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/customcmd/customCmdMemory.h"
 
@@ -40,7 +43,8 @@ class MemBackendConvertor : public SubComponent {
 /* ELI definitions for subclasses */
 #define MEMBACKENDCONVERTOR_ELI_PARAMS {"debug_level",     "(uint) Debugging level: 0 (no output) to 10 (all output). Output also requires that SST Core be compiled with '--enable-debug'", "0"},\
             {"debug_mask",      "(uint) Mask on debug_level", "0"},\
-            {"debug_location",  "(uint) 0: No debugging, 1: STDOUT, 2: STDERR, 3: FILE", "0"}
+            {"debug_location",  "(uint) 0: No debugging, 1: STDOUT, 2: STDERR, 3: FILE", "0"},\
+            {"coalesce_requests", "(bool) Forward reads from and coalesce writes into an earlier pending write to the same line instead of issuing them to the backend", "false"}
 
 #define MEMBACKENDCONVERTOR_ELI_STATS { "cycles_with_issue",                  "Total cycles with successful issue to back end",   "cycles",   1 },\
             { "cycles_attempted_issue_but_rejected","Total cycles where an attempt to issue to backend was rejected (indicates backend full)", "cycles", 1 },\
@@ -55,7 +59,9 @@ class MemBackendConvertor : public SubComponent {
             { "latency_GetSX",                      "Total latency of handled GetSX requests",          "cycles",   1 },\
             { "latency_GetX",                       "Total latency of handled GetX requests",           "cycles",   1 },\
             { "latency_Write",                      "Total latency of handled Write requests",           "cycles",   1 },\
-            { "latency_PutM",                       "Total latency of handled PutM requests",           "cycles",   1 }
+            { "latency_PutM",                       "Total latency of handled PutM requests",           "cycles",   1 },\
+            { "requests_forwarded",                 "Number of reads satisfied by a pending write to the same line (requires coalesce_requests)", "requests", 1 },\
+            { "requests_coalesced",                 "Number of writes merged into a pending write to the same line (requires coalesce_requests)", "requests", 1 }
 
     SST_ELI_REGISTER_SUBCOMPONENT_API(SST::MemHierarchy::MemBackendConvertor, MemBackend*, uint32_t)
 
@@ -128,6 +134,20 @@ class MemBackendConvertor : public SubComponent {
         uint32_t size()         { return m_event->getSize(); }
         const std::string getRqstr() override { return m_event->getRqstr(); }
 
+        /* Events (flushes, forwarded reads, coalesced writes) that complete when this request does, in arrival order */
+        void addDependent( MemEvent* ev ) { m_dependents.push_back(ev); }
+        std::vector<MemEvent*>& getDependents() { return m_dependents; }
+
+        /* Position of this request in the per-line index */
+        void setLinePos( std::list<MemReq*>::iterator pos ) { m_linePos = pos; }
+        std::list<MemReq*>::iterator getLinePos() { return m_linePos; }
+
+        /* Whether this request covers all bytes of ev */
+        bool covers( MemEvent* ev ) {
+            return m_event->getAddr() <= ev->getAddr() &&
+                (ev->getAddr() + ev->getSize()) <= (m_event->getAddr() + m_event->getSize());
+        }
+
         void increment( uint32_t bytes ) {
             m_offset += bytes;
             ++m_numReq;
@@ -151,6 +171,8 @@ class MemBackendConvertor : public SubComponent {
         MemEvent*   m_event;
         uint32_t    m_offset;
         uint32_t    m_numReq;
+        std::vector<MemEvent*> m_dependents;
+        std::list<MemReq*>::iterator m_linePos;
     };
 
   public:
@@ -202,38 +224,9 @@ class MemBackendConvertor : public SubComponent {
 
 
 
-    bool setupMemReq( MemEvent* ev ) {
-        if ( Command::FlushLine == ev->getCmd() || Command::FlushLineInv == ev->getCmd() ) {
-            // TODO optimize if this becomes a problem, it is slow
-            std::set<SST::Event::id_type> dependsOn;
-            for (std::deque<BaseReq*>::iterator it = m_requestQueue.begin(); it != m_requestQueue.end(); it++) {
-                if (!(*it)->isMemEv())
-                    continue;
-                MemReq * mr = static_cast<MemReq*>(*it);
-                if (mr->baseAddr() == ev->getBaseAddr()) {
-                    MemEvent * req = mr->getMemEvent();
-                    dependsOn.insert(req->getID());
-                    if (m_dependentRequests.find(req->getID()) == m_dependentRequests.end()) {
-                        std::set<MemEvent*, memEventCmp> flushSet;
-                        flushSet.insert(ev);
-                        m_dependentRequests.insert(std::make_pair(req->getID(), flushSet));
-                    } else {
-                        (m_dependentRequests.find(req->getID())->second).insert(ev);
-                    }
-                }
-            }
-
-            if (dependsOn.empty()) return false;
-            m_waitingFlushes.insert(std::make_pair(ev, dependsOn));
-            return true;
-        }
-
-        uint32_t id = genReqId();
-        MemReq* req = new MemReq( ev, id );
-        m_requestQueue.push_back( req );
-        m_pendingRequests[id] = req;
-        return true;
-    }
+    bool setupMemReq( MemEvent* ev );
+    void removeFromLineIndex( MemReq* req );
+    void completeDependents( MemReq* req );
 
     inline void doClockStat( ) {
         stat_totalCycles->addData(1);
@@ -303,8 +296,11 @@ class MemBackendConvertor : public SubComponent {
     PendingRequests         m_pendingRequests;
     uint32_t                m_frontendRequestWidth;
 
-    std::map<MemEvent*, std::set<SST::Event::id_type> > m_waitingFlushes; // Set of request IDs for each flush
-    std::map<SST::Event::id_type, std::set<MemEvent*, memEventCmp> > m_dependentRequests; // Reverse map, set of flushes for each request ID, for faster lookup
+    typedef std::unordered_map<Addr, std::list<MemReq*> > LineIndex;
+
+    LineIndex               m_lineIndex;        // Queued and in-flight requests for each line, in arrival order
+    std::unordered_map<MemEvent*, uint32_t> m_waitingFlushes; // Number of requests each flush is still waiting on
+    bool                    m_coalesce;         // Forward reads/coalesce writes against pending writes
 
     Statistic<uint64_t>* stat_GetSLatency;
     Statistic<uint64_t>* stat_GetSXLatency;
@@ -322,6 +318,8 @@ class MemBackendConvertor : public SubComponent {
     Statistic<uint64_t>* stat_cyclesAttemptIssueButRejected;
     Statistic<uint64_t>* stat_totalCycles;
     Statistic<uint64_t>* stat_outstandingReqs;
+    Statistic<uint64_t>* stat_forwardedReqs;
+    Statistic<uint64_t>* stat_coalescedReqs;
 
 };
 
@@ -107,6 +107,12 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
     clockTimeBase_ = registerClock(clockfreq, clockHandler_);
     clockOn_ = true;
 
+    if (params.find<bool>("host_profile", false)) {
+        hostProfile_.enable(getName(), "MemController", params.find<int>("host_profile_top_n", 10),
+                registerStatistic<uint64_t>("host_time_ns"), registerStatistic<uint64_t>("host_calls"),
+                registerStatistic<uint64_t>("host_busy_calls"), registerStatistic<uint64_t>("host_idle_calls"));
+    }
+
 
     string link_lat         = params.find<std::string>("direct_link_latency", "10 ns");
 
@@ -445,6 +451,7 @@ void MemController::handleEvent(SST::Event* event) {
 }
 
 bool MemController::clock(Cycle_t cycle) {
+    SST::Merlin::HostProfile::Scope profile(hostProfile_);
     bool unclockLink = true;
     if (clockLink_) {
         unclockLink = link_->clock();
@@ -453,6 +460,7 @@ bool MemController::clock(Cycle_t cycle) {
     bool unclockBack = memBackendConvertor_->clock( cycle );
 
     if (unclockLink && unclockBack) {
+        profile.setIdle();
         memBackendConvertor_->turnClockOff();
         clockOn_ = false;
         return true;
@@ -579,6 +587,7 @@ void MemController::finish(void) {
     cycle--;
     memBackendConvertor_->finish(cycle);
     link_->finish();
+    hostProfile_.finish();
 }
 
 void MemController::writeData(MemEvent* event) {
@@ -26,6 +26,7 @@
 #include "sst/elements/memHierarchy/memLinkBase.h"
 #include "sst/elements/memHierarchy/membackend/backing.h"
 #include "sst/elements/memHierarchy/customcmd/customCmdMemory.h"
+#include "sst/elements/merlin/hostProfile.h"
 
 namespace SST {
 namespace MemHierarchy {
@@ -57,10 +58,19 @@ public:
             {"addr_range_end",      "(uint) Highest address handled by this memory.", "uint64_t-1"},\
             {"interleave_size",     "(string) Size of interleaved chunks. E.g., to interleave 8B chunks among 3 memories, set size=8B, step=24B", "0B"},\
             {"interleave_step",     "(string) Distance between interleaved chunks. E.g., to interleave 8B chunks among 3 memories, set size=8B, step=24B", "0B"},\
-            {"customCmdMemHandler", "(string) Name of the custom command handler to load", ""}
+            {"customCmdMemHandler", "(string) Name of the custom command handler to load", ""},\
+            {"host_profile",        "(bool) Measure host time spent in the clock handler. Results are reported as statistics and as a table at the end of simulation.", "false"},\
+            {"host_profile_top_n",  "(uint) Number of handlers to list in the host profile table printed at finish.", "10"}
 
     SST_ELI_DOCUMENT_PARAMS( MEMCONTROLLER_ELI_PARAMS )
 
+#define MEMCONTROLLER_ELI_STATISTICS {"host_time_ns", "Host time spent in the clock handler (requires host_profile)", "nanoseconds", 1},\
+            {"host_calls",          "Clock handler calls (requires host_profile)", "count", 1},\
+            {"host_busy_calls",     "Clock handler calls that left work in the link or backend (requires host_profile)", "count", 1},\
+            {"host_idle_calls",     "Clock handler calls after which the controller could unclock (requires host_profile)", "count", 1}
+
+    SST_ELI_DOCUMENT_STATISTICS( MEMCONTROLLER_ELI_STATISTICS )
+
 #define MEMCONTROLLER_ELI_PORTS {"direct_link", "Direct connection to a cache/directory controller", {"memHierarchy.MemEventBase"} },\
             {"network",     "Network connection to a cache/directory controller; also request network for split networks", {"memHierarchy.MemRtrEvent"} },\
             {"network_ack", "For split networks, ack/response network connection to a cache/directory controller", {"memHierarchy.MemRtrEvent"} },\
@@ -154,6 +164,9 @@ protected:
 
     CustomCmdMemHandler * customCommandHandler_;
 
+    // Host time profile of clock(), off unless host_profile is set
+    SST::Merlin::HostProfile hostProfile_;
+
     /* Debug -triggered by output.fatal() and/or SIGUSR2 */
     virtual void printStatus(Output &out);
     virtual void emergencyShutdown();
@@ -416,7 +416,7 @@ void Scratchpad::processIncomingRemoteEvent(SST::Event * event) {
                 getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getVerboseString(dlevel).c_str());
 
     // Determine what kind of event spawned this and pass off to handler
-    std::map<SST::Event::id_type,SST::Event::id_type>::iterator it = responseIDMap_.find(ev->getResponseToID());
+    std::unordered_map<SST::Event::id_type,SST::Event::id_type,EventIDHash>::iterator it = responseIDMap_.find(ev->getResponseToID());
 
     if (it == responseIDMap_.end()) {
         dbg.fatal(CALL_INFO, -1, "(%s) Received data response from remote but no matching request in responseIDMap_, id is (%" PRIu64 ", %" PRIu32 "), timestamp is %" PRIu64 "\n",
@@ -444,8 +444,8 @@ bool Scratchpad::clock(Cycle_t cycle) {
 
     // issue ready events
     uint32_t responseThisCycle = (responsesPerCycle_ == 0) ? 1 : 0;
-    while (!procMsgQueue_.empty() && procMsgQueue_.begin()->first < timestamp_) {
-        MemEventBase * sendEv = procMsgQueue_.begin()->second;
+    while (!procMsgQueue_.empty() && procMsgQueue_.frontTime() < timestamp_) {
+        MemEventBase * sendEv = procMsgQueue_.front();
 
         if (is_debug_event(sendEv)) {
             debug = true;
@@ -454,13 +454,13 @@ bool Scratchpad::clock(Cycle_t cycle) {
         }
 
         linkUp_->send(sendEv);
-        procMsgQueue_.erase(procMsgQueue_.begin());
+        procMsgQueue_.pop_front();
         responseThisCycle++;
         if (responseThisCycle == responsesPerCycle_) break;
     }
 
-    while (!memMsgQueue_.empty() && memMsgQueue_.begin()->first < timestamp_) {
-        MemEvent * sendEv = memMsgQueue_.begin()->second;
+    while (!memMsgQueue_.empty() && memMsgQueue_.frontTime() < timestamp_) {
+        MemEvent * sendEv = memMsgQueue_.front();
         sendEv->setDst(linkDown_->getTargetDestination(sendEv->getBaseAddr()));
 
         if (is_debug_event(sendEv)) {
@@ -471,7 +471,7 @@ bool Scratchpad::clock(Cycle_t cycle) {
 
         linkDown_->send(sendEv);
 
-        memMsgQueue_.erase(memMsgQueue_.begin());
+        memMsgQueue_.pop_front();
     }
 
     linkDown_->clock();
@@ -697,7 +697,7 @@ void Scratchpad::handleScratchGet(MemEventBase * event) {
     stat_ScratchGetReceived->addData(1);
 
     MoveEvent * response = ev->makeResponse();
-    outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response)));
+    OutstandingEvent& outstanding = outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response))).first->second;
 
     // Issue remote read
     ev->setSrcBaseAddr((ev->getSrcAddr() - remoteAddrOffset_) & ~(remoteLineSize_ - 1));
@@ -713,7 +713,7 @@ void Scratchpad::handleScratchGet(MemEventBase * event) {
                 getCurrentSimCycle(), timestamp_, getName().c_str(), saddr, daddr, remoteRead->getID().first, remoteRead->getID().second, remoteRead->getBaseAddr());
     }
 
-    memMsgQueue_.insert(std::make_pair(timestamp_, remoteRead));
+    memMsgQueue_.push(timestamp_, remoteRead);
 
     // Insert into mshr and send inv if needed
     // start base addr -> end base addr
@@ -721,18 +721,19 @@ void Scratchpad::handleScratchGet(MemEventBase * event) {
     uint32_t lineCount = 1 + (ev->getDstAddr() + ev->getSize() - ev->getDstBaseAddr() - 1)/ scratchLineSize_;
     for (uint32_t i = 0; i < lineCount; i++) {
         Addr baseAddr = ev->getDstBaseAddr() + i*scratchLineSize_;
-        if (mshr_.find(baseAddr) == mshr_.end()) {
+        std::unordered_map<Addr,std::list<MSHREntry> >::iterator mshrIt = mshr_.find(baseAddr);
+        if (mshrIt == mshr_.end()) {
             bool needAck = startGet(baseAddr, ev);
-            mshr_.insert(std::make_pair(baseAddr, std::list<MSHREntry>(1, MSHREntry(ev->getID(), Command::Get, true, needAck))));
+            mshrIt = mshr_.insert(std::make_pair(baseAddr, std::list<MSHREntry>(1, MSHREntry(ev->getID(), Command::Get, true, needAck)))).first;
         } else {
-            mshr_.find(baseAddr)->second.push_back(MSHREntry(ev->getID(), Command::Get, true));
+            mshrIt->second.push_back(MSHREntry(ev->getID(), Command::Get, true));
         }
 
         if (is_debug_addr(baseAddr))
             dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:InsEv    0x%-16" PRIx64 " %s\n",
-                    getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->second.back().getString().c_str());
+                    getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshrIt->second.back().getString().c_str());
 
-        outstandingEventList_.find(ev->getID())->second.incrementCount();
+        outstanding.incrementCount();
     }
 }
 
@@ -763,7 +764,7 @@ void Scratchpad::handleScratchPut(MemEventBase * event) {
     remoteWrite->setFlag(MemEvent::F_NONCACHEABLE);
     remoteWrite->setFlag(MemEvent::F_NORESPONSE);
 
-    outstandingEventList_.insert(std::make_pair(ev->getID(), OutstandingEvent(ev, response, remoteWrite)));
+    OutstandingEvent& outstanding = outstandingEventList_.insert(std::make_pair(ev->getID(), OutstandingEvent(ev, response, remoteWrite))).first->second;
 
     Addr addr = ev->getSrcAddr();
     Addr baseAddr = ev->getSrcBaseAddr();
@@ -772,23 +773,24 @@ void Scratchpad::handleScratchPut(MemEventBase * event) {
         uint32_t size = (baseAddr + scratchLineSize_) - addr;
         if (size > bytesLeft) size = bytesLeft;
 
-        if (mshr_.find(baseAddr) == mshr_.end()) {
+        std::unordered_map<Addr,std::list<MSHREntry> >::iterator mshrIt = mshr_.find(baseAddr);
+        if (mshrIt == mshr_.end()) {
             bool needAck = startPut(baseAddr, ev);
-            mshr_.insert(std::make_pair(baseAddr, std::list<MSHREntry>(1, MSHREntry(ev->getID(), Command::Put, !needAck, needAck))));
+            mshrIt = mshr_.insert(std::make_pair(baseAddr, std::list<MSHREntry>(1, MSHREntry(ev->getID(), Command::Put, !needAck, needAck)))).first;
         } else {
-            mshr_.find(baseAddr)->second.push_back(MSHREntry(ev->getID(), Command::Put));
+            mshrIt->second.push_back(MSHREntry(ev->getID(), Command::Put));
         }
 
         if (is_debug_addr(baseAddr))
             dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:InsEv    0x%-16" PRIx64 " %s\n",
                     getCurrentSimCycle(), timestamp_, getName().c_str(),
-                    baseAddr, mshr_.find(baseAddr)->second.back().getString().c_str());
+                    baseAddr, mshrIt->second.back().getString().c_str());
 
         bytesLeft -= size;
         baseAddr += scratchLineSize_;
         addr = baseAddr;
 
-        outstandingEventList_.find(ev->getID())->second.incrementCount();
+        outstanding.incrementCount();
     }
 }
 
@@ -801,11 +803,13 @@ void Scratchpad::handleScratchPut(MemEventBase * event) {
  *  All others (regular read responses): call finishRequest()
  */
 void Scratchpad::handleScratchResponse(SST::Event::id_type responseID) {
-    SST::Event::id_type requestID = responseIDMap_.find(responseID)->second;
-    responseIDMap_.erase(responseID);
+    std::unordered_map<SST::Event::id_type,SST::Event::id_type,EventIDHash>::iterator idIt = responseIDMap_.find(responseID);
+    SST::Event::id_type requestID = idIt->second;
+    responseIDMap_.erase(idIt);
 
-    Addr baseAddr = responseIDAddrMap_.find(responseID)->second;
-    responseIDAddrMap_.erase(responseID);
+    std::unordered_map<SST::Event::id_type,Addr,EventIDHash>::iterator addrIt = responseIDAddrMap_.find(responseID);
+    Addr baseAddr = addrIt->second;
+    responseIDAddrMap_.erase(addrIt);
 
     if (is_debug_addr(baseAddr))
         dbg.debug(_L5_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Scratch:Recv  0x%-16" PRIx64 " <%" PRIu64 ", %" PRIu32 ">\n",
@@ -836,7 +840,8 @@ void Scratchpad::handleAckInv(MemEventBase * event) {
     /* Look up request in mshr */
     MSHREntry * entry = &(mshr_.find(baseAddr)->second.front());
     SST::Event::id_type requestID = entry->id;
-    MoveEvent * request = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->second.request);
+    OutstandingEvent& outstanding = outstandingEventList_.find(requestID)->second;
+    MoveEvent * request = static_cast<MoveEvent*>(outstanding.request);
 
     /* Update cache status */
     if (is_debug_addr(baseAddr))
@@ -881,12 +886,12 @@ void Scratchpad::handleAckInv(MemEventBase * event) {
         responseIDAddrMap_.insert(std::make_pair(read->getID(), baseAddr));
 
         std::vector<uint8_t> data = doScratchRead(read);
-        std::vector<uint8_t> payload = outstandingEventList_.find(requestID)->second.remoteWrite->getPayload();
+        std::vector<uint8_t> payload = outstanding.remoteWrite->getPayload();
         uint32_t offset = addr - request->getSrcAddr();
         for (uint32_t i = 0; i < size; i++) {
             payload[i+offset] = data[i];
         }
-        outstandingEventList_.find(requestID)->second.remoteWrite->setPayload(payload);
+        outstanding.remoteWrite->setPayload(payload);
     } else {
         dbg.fatal(CALL_INFO, -1, "%s, Error: unhandled case in handleAckInv. Time = %" PRIu64 ", Event = (%s).\n",
                 getName().c_str(), timestamp_, event->getVerboseString(dlevel).c_str());
@@ -911,7 +916,8 @@ void Scratchpad::handleFetchResp(MemEventBase * event) {
     /* Look up request in mshr */
     MSHREntry * entry = &(mshr_.find(baseAddr)->second.front());
     SST::Event::id_type requestID = entry->id;
-    MoveEvent * put = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->second.request);
+    OutstandingEvent& outstanding = outstandingEventList_.find(requestID)->second;
+    MoveEvent * put = static_cast<MoveEvent*>(outstanding.request);
 
     /* Update cache status */
     cacheStatus_.at(baseAddr/scratchLineSize_) = false;
@@ -933,12 +939,12 @@ void Scratchpad::handleFetchResp(MemEventBase * event) {
     uint32_t size = deriveSize(addr, baseAddr, put->getSrcAddr(), put->getSize());
 
     // Update write payload
-    std::vector<uint8_t> payload = outstandingEventList_.find(requestID)->second.remoteWrite->getPayload();
+    std::vector<uint8_t> payload = outstanding.remoteWrite->getPayload();
     uint32_t offset = addr - put->getSrcAddr();
     for (uint32_t i = 0; i < size; i++) {
         payload[i+offset] = response->getPayload()[i];
     }
-    outstandingEventList_.find(requestID)->second.remoteWrite->setPayload(payload);
+    outstanding.remoteWrite->setPayload(payload);
 
     // Clear this mshr entry
     updatePut(requestID);
@@ -978,7 +984,7 @@ void Scratchpad::handleNack(MemEventBase * event) {
         uint64_t backoff = (0x1 << retries);
         nackedEvent->incrementRetries();
 
-        procMsgQueue_.insert(std::make_pair(timestamp_ + backoff, nackedEvent));
+        procMsgQueue_.pushLater(timestamp_ + backoff, nackedEvent);
 
     } else {
         delete nackedEvent;
@@ -1004,7 +1010,7 @@ void Scratchpad::handleRemoteRead(MemEvent * event) {
     outstandingEventList_.insert(std::make_pair(event->getID(), OutstandingEvent(event, response)));
     responseIDMap_.insert(std::make_pair(request->getID(), event->getID()));
 
-    memMsgQueue_.insert(std::make_pair(timestamp_, request));
+    memMsgQueue_.push(timestamp_, request);
 }
 
 
@@ -1023,11 +1029,11 @@ void Scratchpad::handleRemoteWrite(MemEvent * event) {
     request->setFlag(MemEvent::F_NORESPONSE);
     request->setFlag(MemEvent::F_NONCACHEABLE);
 
-    memMsgQueue_.insert(std::make_pair(timestamp_, request));
+    memMsgQueue_.push(timestamp_, request);
 
     MemEvent * response = event->makeResponse();
 
-    procMsgQueue_.insert(std::make_pair(timestamp_, response));
+    procMsgQueue_.push(timestamp_, response);
 
     delete event;
 }
@@ -1058,31 +1064,34 @@ void Scratchpad::handleRemoteGetResponse(MemEvent * response, SST::Event::id_typ
         write->setInstructionPointer(request->getInstructionPointer());
         write->setFlag(MemEvent::F_NORESPONSE);
 
-        if (mshr_.find(baseAddr)->second.front().id == requestID) {
+        std::unordered_map<Addr,std::list<MSHREntry> >::iterator mshrIt = mshr_.find(baseAddr);
+        if (mshrIt == mshr_.end()) {
+            dbg.fatal(CALL_INFO, -1, "ERROR: remoteGetResponse but no matching entry in mshr for address 0x%" PRIx64 "\n", baseAddr);
+        }
+        std::list<MSHREntry>& entries = mshrIt->second;
+
+        if (entries.front().id == requestID) {
             doScratchWrite(write);
-            mshr_.find(baseAddr)->second.front().needData = false;
+            entries.front().needData = false;
 
             if (is_debug_addr(baseAddr))
                 dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Update   0x%-16" PRIx64 " %s\n",
-                        getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->second.front().getString().c_str());
+                        getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, entries.front().getString().c_str());
 
-            if (!mshr_.find(baseAddr)->second.front().needAck) {
+            if (!entries.front().needAck) {
                 updateGet(requestID);
                 updateMSHR(baseAddr);
             }
         } else {
             // Find it
-            if (mshr_.find(baseAddr) == mshr_.end()) {
-                dbg.fatal(CALL_INFO, -1, "ERROR: remoteGetResponse but no matching entry in mshr for address 0x%" PRIx64 "\n", baseAddr);
-            }
-            for (std::list<MSHREntry>::iterator it = mshr_.find(baseAddr)->second.begin(); it != mshr_.find(baseAddr)->second.end(); it++) {
+            for (std::list<MSHREntry>::iterator it = entries.begin(); it != entries.end(); it++) {
                 if (it->id == requestID) {
                     it->scratch = write;
                     it->needData = false;
 
                     if (is_debug_addr(baseAddr))
                         dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Update   0x%-16" PRIx64 " %s\n",
-                                getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->second.front().getString().c_str());
+                                getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, entries.front().getString().c_str());
                 }
             }
         }
@@ -1106,12 +1115,14 @@ void Scratchpad::handleRemoteReadResponse(MemEvent * response, SST::Event::id_ty
 
 // Update MSHR
 void Scratchpad::updateMSHR(Addr baseAddr) {
+    std::list<MSHREntry>& entries = mshr_.find(baseAddr)->second;
+
     // Remove top event
-    mshr_.find(baseAddr)->second.pop_front();
+    entries.pop_front();
 
     // Start next event
-    while (!mshr_.find(baseAddr)->second.empty()) {
-        MSHREntry * entry = &(mshr_.find(baseAddr)->second.front());
+    while (!entries.empty()) {
+        MSHREntry * entry = &(entries.front());
 
         if (entry->cmd == Command::GetS) {
             std::vector<uint8_t> readData = doScratchRead(entry->scratch);
@@ -1128,7 +1139,7 @@ void Scratchpad::updateMSHR(Addr baseAddr) {
         } else if (entry->cmd == Command::GetX || entry->cmd == Command::Write) {
             doScratchWrite(entry->scratch);
             finishRequest(entry->id);
-            mshr_.find(baseAddr)->second.pop_front();
+            entries.pop_front();
 
             if (is_debug_addr(baseAddr))
                 dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Remove   0x%-16" PRIx64 "\n",
@@ -1142,7 +1153,7 @@ void Scratchpad::updateMSHR(Addr baseAddr) {
             }
             if (!entry->needAck && !entry->needData) {
                 updateGet(entry->id);
-                mshr_.find(baseAddr)->second.pop_front();
+                entries.pop_front();
 
                 if (is_debug_addr(baseAddr))
                     dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Remove   0x%-16" PRIx64 "\n",
@@ -1169,7 +1180,7 @@ void Scratchpad::updateMSHR(Addr baseAddr) {
     }
 
     // Clear mshr entry if list is empty
-    if (mshr_.find(baseAddr)->second.empty()) {
+    if (entries.empty()) {
         mshr_.erase(baseAddr);
 
         if (is_debug_addr(baseAddr))
@@ -1205,7 +1216,7 @@ void Scratchpad::doScratchWrite(MemEvent * event) {
 }
 
 void Scratchpad::sendResponse(MemEventBase * event) {
-    procMsgQueue_.insert(std::make_pair(timestamp_, event));
+    procMsgQueue_.push(timestamp_, event);
 }
 
 
@@ -1222,7 +1233,7 @@ bool Scratchpad::startGet(Addr baseAddr, MoveEvent * get) {
         inv->setInstructionPointer(get->getInstructionPointer());
         dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Get            0x%-16" PRIx64 " 0x%-16" PRIx64 " Inv         (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
                 getCurrentSimCycle(), timestamp_, getName().c_str(), get->getSrcBaseAddr(), get->getDstBaseAddr(), inv->getID().first, inv->getID().second, inv->getBaseAddr());
-        procMsgQueue_.insert(std::make_pair(timestamp_, inv));
+        procMsgQueue_.push(timestamp_, inv);
         return true;
     }
     return false;
@@ -1242,7 +1253,7 @@ bool Scratchpad::startPut(Addr baseAddr, MoveEvent * put) {
         inv->setInstructionPointer(put->getInstructionPointer());
         dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Put            0x%-16" PRIx64 " 0x%-16" PRIx64 " Inv         (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
                 getCurrentSimCycle(), timestamp_, getName().c_str(), put->getSrcBaseAddr(), put->getDstBaseAddr(), inv->getID().first, inv->getID().second, inv->getBaseAddr());
-        procMsgQueue_.insert(std::make_pair(timestamp_, inv));
+        procMsgQueue_.push(timestamp_, inv);
         return true;
     } else {
         // Derive addr and size from baseAddr and the put request
@@ -1260,51 +1271,55 @@ bool Scratchpad::startPut(Addr baseAddr, MoveEvent * put) {
 
         std::vector<uint8_t> data = doScratchRead(read);
 
-        std::vector<uint8_t> payload = outstandingEventList_.find(put->getID())->second.remoteWrite->getPayload();
+        MemEvent * remoteWrite = outstandingEventList_.find(put->getID())->second.remoteWrite;
+        std::vector<uint8_t> payload = remoteWrite->getPayload();
         uint32_t offset = addr - put->getSrcAddr();
         for (uint32_t i = 0; i < size; i++) {
             payload[i+offset] = data[i];
         }
-        outstandingEventList_.find(put->getID())->second.remoteWrite->setPayload(payload);
+        remoteWrite->setPayload(payload);
         return false;
     }
 }
 
 void Scratchpad::updatePut(SST::Event::id_type putID) {
-    uint32_t count = outstandingEventList_.find(putID)->second.decrementCount();
+    std::unordered_map<SST::Event::id_type,OutstandingEvent,EventIDHash>::iterator it = outstandingEventList_.find(putID);
+    uint32_t count = it->second.decrementCount();
     if (count == 0) {
-        MoveEvent * put = static_cast<MoveEvent*>(outstandingEventList_.find(putID)->second.request);
+        MoveEvent * put = static_cast<MoveEvent*>(it->second.request);
         dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Put            0x%-16" PRIx64 " 0x%-16" PRIx64 " Scratch Done (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
                 getCurrentSimCycle(), timestamp_, getName().c_str(),
                 put->getSrcBaseAddr(),
                 put->getDstBaseAddr(),
-                outstandingEventList_.find(putID)->second.remoteWrite->getID().first,
-                outstandingEventList_.find(putID)->second.remoteWrite->getID().second,
-                outstandingEventList_.find(putID)->second.remoteWrite->getBaseAddr());
+                it->second.remoteWrite->getID().first,
+                it->second.remoteWrite->getID().second,
+                it->second.remoteWrite->getBaseAddr());
 //        dbg.debug(_L5_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Finish        0x%-16" PRIx64 " <%" PRIu64 ", %" PRIu32 ">\n",
 //                getCurrentSimCycle(), timestamp_, getName().c_str(), outstandingEventList_.find(putID)->second.remoteWrite->getBaseAddr(), baseAddr, responseID.first, responseID.second);
-        memMsgQueue_.insert(std::make_pair(timestamp_, outstandingEventList_.find(putID)->second.remoteWrite));
-        sendResponse(outstandingEventList_.find(putID)->second.response);
-        delete outstandingEventList_.find(putID)->second.request;
-        outstandingEventList_.erase(putID);
+        memMsgQueue_.push(timestamp_, it->second.remoteWrite);
+        sendResponse(it->second.response);
+        delete it->second.request;
+        outstandingEventList_.erase(it);
     }
 
 }
 
 void Scratchpad::updateGet(SST::Event::id_type getID) {
-    uint32_t count = outstandingEventList_.find(getID)->second.decrementCount();
+    std::unordered_map<SST::Event::id_type,OutstandingEvent,EventIDHash>::iterator it = outstandingEventList_.find(getID);
+    uint32_t count = it->second.decrementCount();
     if (count == 0) {
-        sendResponse(outstandingEventList_.find(getID)->second.response);
-        delete outstandingEventList_.find(getID)->second.request;
-        outstandingEventList_.erase(getID);
+        sendResponse(it->second.response);
+        delete it->second.request;
+        outstandingEventList_.erase(it);
     }
 }
 
 void Scratchpad::finishRequest(SST::Event::id_type requestID) {
-    if (outstandingEventList_.find(requestID)->second.response != nullptr)
-        sendResponse(outstandingEventList_.find(requestID)->second.response);
-    delete outstandingEventList_.find(requestID)->second.request;
-    outstandingEventList_.erase(requestID);
+    std::unordered_map<SST::Event::id_type,OutstandingEvent,EventIDHash>::iterator it = outstandingEventList_.find(requestID);
+    if (it->second.response != nullptr)
+        sendResponse(it->second.response);
+    delete it->second.request;
+    outstandingEventList_.erase(it);
 }
 
 uint32_t Scratchpad::deriveSize(Addr addr, Addr baseAddr, Addr requestAddr, uint32_t requestSize) {
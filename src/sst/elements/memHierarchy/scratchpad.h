@@ -23,7 +23,9 @@
 #include <sst/core/link.h>
 #include <sst/core/output.h>
 #include <map>
+#include <unordered_map>
 #include <list>
+#include <deque>
 
 #include "sst/elements/memHierarchy/membackend/backing.h"
 #include "sst/elements/memHierarchy/moveEvent.h"
@@ -226,15 +228,50 @@ private:
         }
     } eventDI;
 
-    std::map<SST::Event::id_type,SST::Event::id_type> responseIDMap_;   // Map a forwarded request ID to a original request ID
-    std::map<SST::Event::id_type,Addr> responseIDAddrMap_;              // Map an outstanding scratch request ID to the request's baseAddr
-    std::map<SST::Event::id_type,OutstandingEvent> outstandingEventList_; // List of all outstanding events
-    std::map<Addr,std::list<MSHREntry> > mshr_; // MSHR for scratch accesses
+    // Hash for event IDs - the first field is a per-rank counter so it spreads well on its own
+    struct EventIDHash {
+        size_t operator()(const SST::Event::id_type& id) const {
+            return std::hash<uint64_t>()(id.first ^ ((uint64_t)id.second << 48));
+        }
+    };
+
+    // None of these are iterated so hash tables are used, lookups are on every access
+    std::unordered_map<SST::Event::id_type,SST::Event::id_type,EventIDHash> responseIDMap_;   // Map a forwarded request ID to a original request ID
+    std::unordered_map<SST::Event::id_type,Addr,EventIDHash> responseIDAddrMap_;              // Map an outstanding scratch request ID to the request's baseAddr
+    std::unordered_map<SST::Event::id_type,OutstandingEvent,EventIDHash> outstandingEventList_; // List of all outstanding events
+    std::unordered_map<Addr,std::list<MSHREntry> > mshr_; // MSHR for scratch accesses
+
+    // Outgoing message queue - events leave in send timestamp order, and in the order they were queued within a timestamp
+    // Nearly every event is queued for the current timestamp so those go on a FIFO. Only NACK retries are
+    // queued for a later timestamp, they go in a multimap and go first on a tie since they were queued earlier.
+    template <typename T>
+    class MsgQueue {
+        public:
+            void push(uint64_t time, T* event) { current_.push_back(std::make_pair(time, event)); }
+            void pushLater(uint64_t time, T* event) { later_.insert(std::make_pair(time, event)); }
+
+            bool empty() const { return current_.empty() && later_.empty(); }
+            uint64_t frontTime() const { return frontIsLater() ? later_.begin()->first : current_.front().first; }
+            T* front() const { return frontIsLater() ? later_.begin()->second : current_.front().second; }
+
+            void pop_front() {
+                if (frontIsLater())
+                    later_.erase(later_.begin());
+                else
+                    current_.pop_front();
+            }
+
+        private:
+            bool frontIsLater() const {
+                return current_.empty() || (!later_.empty() && later_.begin()->first <= current_.front().first);
+            }
 
+            std::deque<std::pair<uint64_t, T*> > current_;
+            std::multimap<uint64_t, T*> later_;
+    };
 
-    // Outgoing message queues - map send timestamp to event
-    std::multimap<uint64_t, MemEventBase*> procMsgQueue_;
-    std::multimap<uint64_t, MemEvent*> memMsgQueue_;
+    MsgQueue<MemEventBase> procMsgQueue_;
+    MsgQueue<MemEvent> memMsgQueue_;
 
     // Throughput limits
     uint32_t responsesPerCycle_;
@@ -243,7 +280,6 @@ private:
     bool caching_;  // Whether or not caching is possible
     bool directory_; // Whether or not a directory is managing the caches - if so we cannot assume on a writeback that the data is not cached
     std::vector<bool> cacheStatus_; // One entry per scratchpad line, whether line may be cached
-    std::map<SST::Event::id_type, uint64_t> cacheCounters_; // Map of a Get or Put ID to the number of cache acks/data responses we are waiting for
 
     // Statistics
     Statistic<uint64_t>* stat_ScratchReadReceived;
@@ -0,0 +1,199 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_HOSTPROFILE_H
+#define COMPONENTS_MERLIN_HOSTPROFILE_H
+
+#include <sst/core/output.h>
+#include <sst/core/statapi/statbase.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace SST {
+namespace Merlin {
+
+/*
+ * Opt-in host-time profile for a clock or event handler.
+ *
+ * Components keep one HostProfile per instance and wrap the handler
+ * body in a HostProfile::Scope.  Until enable() is called the scope
+ * only tests a bool, so the default build pays nothing measurable.
+ * When enabled, the scope accumulates wall time on the host
+ * (steady_clock), the number of calls and whether each call did any
+ * work.  finish() pushes the totals into the statistics given to
+ * enable() and the last enabled profile to finish prints a table of
+ * the most expensive handlers in this process.
+ */
+class HostProfile {
+public:
+
+    HostProfile() :
+        enabled(false),
+        top_n(0),
+        host_ns(0),
+        calls(0),
+        busy(0),
+        idle(0),
+        stat_ns(NULL),
+        stat_calls(NULL),
+        stat_busy(NULL),
+        stat_idle(NULL)
+    {}
+
+    // Any of the statistics may be NULL
+    void enable(const std::string& profile_name, const std::string& profile_kind, int report_top_n,
+                Statistic<uint64_t>* ns_stat, Statistic<uint64_t>* calls_stat,
+                Statistic<uint64_t>* busy_stat, Statistic<uint64_t>* idle_stat)
+    {
+        if ( enabled ) return;
+        enabled = true;
+        name = profile_name;
+        kind = profile_kind;
+        top_n = report_top_n;
+        stat_ns = ns_stat;
+        stat_calls = calls_stat;
+        stat_busy = busy_stat;
+        stat_idle = idle_stat;
+
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.lock);
+        reg.profiles.push_back(this);
+        reg.top_n = std::max(reg.top_n, top_n);
+    }
+
+    bool isEnabled() const { return enabled; }
+
+    class Scope {
+    public:
+        explicit Scope(HostProfile& p) :
+            profile(p.enabled ? &p : NULL),
+            busy(true)
+        {
+            if ( profile ) start = std::chrono::steady_clock::now();
+        }
+
+        ~Scope() {
+            if ( !profile ) return;
+            std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+            profile->record(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(), busy);
+        }
+
+        // Mark this call as having found no work to do
+        void setIdle() { busy = false; }
+
+    private:
+        HostProfile* profile;
+        bool busy;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    void finish() {
+        if ( !enabled ) return;
+
+        if ( stat_ns ) stat_ns->addData(host_ns);
+        if ( stat_calls ) stat_calls->addData(calls);
+        if ( stat_busy ) stat_busy->addData(busy);
+        if ( stat_idle ) stat_idle->addData(idle);
+
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.lock);
+        reg.finished++;
+        if ( reg.finished < reg.profiles.size() ) return;
+
+        report(reg);
+        reg.profiles.clear();
+        reg.finished = 0;
+        reg.top_n = 0;
+    }
+
+private:
+
+    struct Registry {
+        Registry() : finished(0), top_n(0) {}
+        std::mutex lock;
+        std::vector<HostProfile*> profiles;
+        size_t finished;
+        int top_n;
+    };
+
+    static Registry& registry() {
+        static Registry reg;
+        return reg;
+    }
+
+    void record(uint64_t ns, bool was_busy) {
+        host_ns += ns;
+        calls++;
+        if ( was_busy ) busy++;
+        else idle++;
+    }
+
+    static bool compareHostTime(const HostProfile* a, const HostProfile* b) {
+        if ( a->host_ns != b->host_ns ) return a->host_ns > b->host_ns;
+        return a->name < b->name;
+    }
+
+    static void report(Registry& reg) {
+        std::vector<HostProfile*> sorted(reg.profiles);
+        std::sort(sorted.begin(), sorted.end(), compareHostTime);
+
+        uint64_t total_ns = 0;
+        for ( size_t i = 0; i < sorted.size(); i++ ) total_ns += sorted[i]->host_ns;
+
+        size_t count = sorted.size();
+        if ( reg.top_n > 0 && (size_t)reg.top_n < count ) count = reg.top_n;
+
+        Output out("", 0, 0, Output::STDOUT);
+        out.output("Host profile: top %zu of %zu handlers, %.3f ms total\n",
+                   count, sorted.size(), total_ns / 1e6);
+        out.output("  %-40s %-14s %12s %7s %12s %12s %12s %10s\n",
+                   "name", "kind", "host ms", "%", "calls", "busy", "idle", "ns/call");
+        for ( size_t i = 0; i < count; i++ ) {
+            const HostProfile* p = sorted[i];
+            out.output("  %-40s %-14s %12.3f %6.2f%% %12" PRIu64 " %12" PRIu64 " %12" PRIu64 " %10.1f\n",
+                       p->name.c_str(), p->kind.c_str(),
+                       p->host_ns / 1e6,
+                       total_ns ? 100.0 * p->host_ns / total_ns : 0.0,
+                       p->calls, p->busy, p->idle,
+                       p->calls ? (double)p->host_ns / p->calls : 0.0);
+        }
+    }
+
+    bool enabled;
+    std::string name;
+    std::string kind;
+    int top_n;
+
+    uint64_t host_ns;
+    uint64_t calls;
+    uint64_t busy;
+    uint64_t idle;
+
+    Statistic<uint64_t>* stat_ns;
+    Statistic<uint64_t>* stat_calls;
+    Statistic<uint64_t>* stat_busy;
+    Statistic<uint64_t>* stat_idle;
+};
+
+}
+}
+
+#endif // COMPONENTS_MERLIN_HOSTPROFILE_H
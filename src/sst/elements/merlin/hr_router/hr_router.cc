@@ -245,6 +245,11 @@ hr_router::hr_router(ComponentId_t cid, Params& params) :
     pc_params.insert("oql_track_port", params.find<std::string>("oql_track_port","false"));
     pc_params.insert("oql_track_remote", params.find<std::string>("oql_track_remote","false"));
 
+    bool host_profile_enabled = params.find<bool>("host_profile", false);
+    int host_profile_top_n = params.find<int>("host_profile_top_n", 10);
+    pc_params.insert("host_profile", host_profile_enabled ? "true" : "false");
+    pc_params.insert("host_profile_top_n", std::to_string(host_profile_top_n));
+
     for ( int i = 0; i < num_ports; i++ ) {
         in_port_busy[i] = 0;
         out_port_busy[i] = 0;
@@ -307,6 +312,14 @@ hr_router::hr_router(ComponentId_t cid, Params& params) :
         xbar_stalls[i] = registerStatistic<uint64_t>("xbar_stalls",port_name);
     }
 
+    if ( host_profile_enabled ) {
+        host_profile.enable(getName(), "hr_router", host_profile_top_n,
+                            registerStatistic<uint64_t>("host_time_ns"),
+                            registerStatistic<uint64_t>("host_calls"),
+                            registerStatistic<uint64_t>("host_busy_calls"),
+                            registerStatistic<uint64_t>("host_idle_calls"));
+    }
+
     init_vcs();
 }
 
@@ -375,10 +388,13 @@ hr_router::printStatus(Output& out)
 bool
 hr_router::clock_handler(Cycle_t cycle)
 {
+    HostProfile::Scope profile(host_profile);
+
     // If there are no events in the input queues, then we can remove
     // ourselves from the clock queue, as long as the arbitration unit
     // says it's okay.
     if ( get_vcs_with_data() == 0 ) {
+        profile.setIdle();
 #if VERIFY_DECLOCKING
         if ( clocking ) {
             if ( arb->isOkayToPauseClock() ) {
@@ -456,6 +472,7 @@ void hr_router::finish()
     for ( int i = 0; i < num_ports; i++ ) {
     	ports[i]->finish();
     }
+    host_profile.finish();
 
 }
 
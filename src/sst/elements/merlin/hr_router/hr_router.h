@@ -30,6 +30,7 @@
 #include <queue>
 
 #include "sst/elements/merlin/router.h"
+#include "sst/elements/merlin/hostProfile.h"
 
 using namespace SST;
 
@@ -68,7 +69,9 @@ public:
         {"num_vns",            "Number of VNs.","2"},
         {"vn_remap",           "Array that specifies the vn remapping for each node in the systsm."},
         {"vn_remap_shm",       "Name of shared memory region for vn remapping.  If empty, no remapping is done", ""},
-        {"debug",              "Turn on debugging for router. Set to 1 for on, 0 for off.", "0"}
+        {"debug",              "Turn on debugging for router. Set to 1 for on, 0 for off.", "0"},
+        {"host_profile",       "Measure host time spent in the router clock handler and port event handlers.  Results are reported as statistics and as a table at the end of simulation.", "false"},
+        {"host_profile_top_n", "Number of handlers to list in the host profile table printed at finish.", "10"}
     )
 
     SST_ELI_DOCUMENT_STATISTICS(
@@ -77,7 +80,11 @@ public:
         { "output_port_stalls", "Time output port is stalled (in units of core timebase)", "time in stalls", 1},
         { "xbar_stalls",        "Count number of cycles the xbar is stalled", "cycles", 1},
         { "idle_time",          "Amount of time spent idle for a given port", "units of core timebase", 1},
-        { "width_adj_count",    "Number of times that link width was increased or decreased", "width adjustment count", 1}
+        { "width_adj_count",    "Number of times that link width was increased or decreased", "width adjustment count", 1},
+        { "host_time_ns",       "Host time spent in the router clock handler, or in a port's event handlers (requires host_profile)", "nanoseconds", 1},
+        { "host_calls",         "Number of profiled handler calls (requires host_profile)", "calls", 1},
+        { "host_busy_calls",    "Number of profiled handler calls that moved data (requires host_profile)", "calls", 1},
+        { "host_idle_calls",    "Number of profiled handler calls that found nothing to do (requires host_profile)", "calls", 1}
     )
 
     SST_ELI_DOCUMENT_PORTS(
@@ -133,6 +140,8 @@ private:
     void init_vcs();
     Statistic<uint64_t>** xbar_stalls;
 
+    HostProfile host_profile;
+
     Output& output;
 
     Shared::SharedArray<int> shared_array;
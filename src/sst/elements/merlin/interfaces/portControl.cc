@@ -410,6 +410,15 @@ PortControl::PortControl(ComponentId_t cid, Params& params,  Router* rif, int rt
     idle_time = registerStatistic<uint64_t>("idle_time", port_name);
     width_adj_count = registerStatistic<uint64_t>("width_adj_count", port_name);
 
+    if ( params.find<bool>("host_profile", false) ) {
+        host_profile.enable(getName() + ":" + port_name, "PortControl",
+                            params.find<int>("host_profile_top_n", 10),
+                            registerStatistic<uint64_t>("host_time_ns", port_name),
+                            registerStatistic<uint64_t>("host_calls", port_name),
+                            registerStatistic<uint64_t>("host_busy_calls", port_name),
+                            registerStatistic<uint64_t>("host_idle_calls", port_name));
+    }
+
 	// set the SAI metrics to 0
 	stalled = 0;
 	active = 0;
@@ -570,6 +579,8 @@ PortControl::setup() {
 
 void
 PortControl::finish() {
+    host_profile.finish();
+
     if ( !connected ) return;
 
     // Any links that ended in an idle state need to add stats
@@ -904,6 +915,8 @@ PortControl::dumpQueueState(port_queue_t& q, Output& out) {
 void
 PortControl::handle_input_n2r(Event* ev)
 {
+    HostProfile::Scope profile(host_profile);
+
 	// Check to see if this is a credit or data packet
 	// credit_event* ce = dynamic_cast<credit_event*>(ev);
 	BaseRtrEvent* base_event = static_cast<BaseRtrEvent*>(ev);
@@ -993,6 +1006,8 @@ PortControl::handle_input_n2r(Event* ev)
 void
 PortControl::handle_input_r2r(Event* ev)
 {
+    HostProfile::Scope profile(host_profile);
+
 #if TRACK
     if ( rtr_id == TRACK_ID && port_number == TRACK_PORT ) {
         ev->print("  ", getSimulationOutput());
@@ -1077,6 +1092,8 @@ PortControl::handle_input_r2r(Event* ev)
 
 void
 PortControl::handle_output(Event* ev) {
+    HostProfile::Scope profile(host_profile);
+
 #if TRACK
     if ( rtr_id == TRACK_ID && port_number == TRACK_PORT ) {
         printStatus(getSimulationOutput(),0,0);
@@ -1176,6 +1193,7 @@ PortControl::handle_output(Event* ev) {
 	    // we either get something new in the output buffers or
 	    // receive credits back from the router.  However, we need
 	    // to know that we got to this state.
+        profile.setIdle();
         start_block = getCurrentSimCycle();
 	    waiting = true;
         // Begin counting the amount of time this port was idle
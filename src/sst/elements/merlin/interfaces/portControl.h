@@ -32,6 +32,7 @@
 #include <cstring>
 
 #include "sst/elements/merlin/router.h"
+#include "sst/elements/merlin/hostProfile.h"
 
 using namespace SST;
 
@@ -74,7 +75,9 @@ public:
         {"enable_congestion_management", "Turn on congestion management","false"},
         {"cm_outstanding_threshold", "Threshold for the amount of data outstanding to a host before congestion management can trigger","2*output_buf_size"},
         {"cm_pktsize_threshold", "Minimum size of a packet to be considered part of a stream with regards to congestion management","128B"},
-        {"cm_incast_threshold", "Numbr of hosts sending to an enpoint needed to trigger congestion management","6"}
+        {"cm_incast_threshold", "Numbr of hosts sending to an enpoint needed to trigger congestion management","6"},
+        {"host_profile",       "Measure host time spent in the port's event handlers (set by router)","false"},
+        {"host_profile_top_n", "Number of handlers to list in the host profile table printed at finish","10"}
     )
 
     // SST_ELI_DOCUMENT_STATISTICS(
@@ -218,6 +221,8 @@ private:
     Statistic<uint64_t>* idle_time;
     Statistic<uint64_t>* width_adj_count;
 
+    HostProfile host_profile;
+
 	// SAI Metrics (S+A+I=1) corresponds to
 	// sai_win_start to (sai_win_start + sai_win_length)
 	double stalled;
@@ -16,6 +16,7 @@
 #include <sst_config.h>
 
 #include "merlin.h"
+#include "pymodule.h"
 
 
 /*
@@ -107,6 +108,12 @@ public:
         primary_module->addSubModule("topology",pymerlin_topo_polarstar,"topology/pymerlin-topo-polarstar.py");
     }
 
+    void* load() override {
+        void* module = SSTElementPythonModule::load();
+        addMerlinNativeBuilders(module);
+        return module;
+    }
+
     SST_ELI_REGISTER_PYTHON_MODULE(
         SST::Merlin::MerlinPyModule,
         "merlin",
@@ -16,6 +16,7 @@
 # distribution.
 
 import sst
+import sys
 import random
 import copy
 import re
@@ -24,6 +25,20 @@ from collections import deque
 # Need import_module to load platform files
 from importlib import import_module
 
+# Rank and thread of the router that the endpoint currently being
+# built attaches to.  Only set while a topology with partition hints
+# enabled is calling endpoint build() functions.
+_endpoint_partition = None
+
+def followRouter(comp):
+    """Place comp on the same rank/thread as the router the endpoint
+    being built attaches to.  Endpoint build() functions call this on
+    each component they create.  Does nothing unless the topology has
+    partition hints enabled."""
+    if _endpoint_partition is not None:
+        comp.setRank(_endpoint_partition[0], _endpoint_partition[1])
+
+
 class PlatformDefinition:
 
     _platforms = dict()
@@ -599,9 +614,12 @@ class TemplateBase(_AttributeManager):
 class Topology(TemplateBase):
     def __init__(self):
         TemplateBase.__init__(self)
-        self._declareClassVariables(["network_name","endPointLinks","built","router","_prefix"])
+        self._declareClassVariables(["network_name","endPointLinks","built","router","_prefix","native_build","_partition"])
 
         self._prefix = ""
+        # Set to True to have topologies that support it build their
+        # routers and links in sst.merlin's native builder
+        self.native_build = False
         self._lockVariable("_prefix")
         self._setCallbackOnWrite("network_name",self._network_name_callback)
 
@@ -642,7 +660,82 @@ class Topology(TemplateBase):
     def findRouterById(self,rtr_id):
         return sst.findComponentByName(self.getRouterNameForId(rtr_id))
     def _instanceRouter(self,radix,rtr_id):
-        return self.router.instanceRouter(self.getRouterNameForId(rtr_id), radix, rtr_id)
+        rtr = self.router.instanceRouter(self.getRouterNameForId(rtr_id), radix, rtr_id)
+        if self._partition:
+            rtr.setRank(*self.getRouterPartition(rtr_id))
+        return rtr
+
+    # Partition hints.  When enabled, every router is given a
+    # rank/thread that keeps the topology's natural units (dragonfly
+    # groups, fat tree pods, torus slabs) together, and endpoints
+    # follow the router they attach to (see followRouter()).  The
+    # simulation must use the sst.self partitioner for the hints to
+    # take effect.
+    def setPartitionHints(self, ranks = None, threads = None, use_self_partitioner = True):
+        if ranks is None: ranks = sst.getMPIRankCount()
+        if threads is None: threads = sst.getThreadCount()
+        self._partition = (int(ranks), int(threads))
+        if use_self_partitioner:
+            sst.setProgramOption("partitioner", "sst.self")
+
+    # Returns (unit, index, unit_size, num_units): the router is at
+    # position unit + index/unit_size in a topology made of num_units
+    # units that should be kept together
+    def _getPartitionPosition(self,rtr_id):
+        print("ERROR: topology %s does not support partition hints"%self.getName())
+        sst.exit()
+
+    # Returns the id of the router node nid attaches to
+    def _getRouterForNode(self,nid):
+        print("ERROR: topology %s does not support partition hints"%self.getName())
+        sst.exit()
+
+    def getRouterPartition(self,rtr_id):
+        ranks, threads = self._partition
+        parts = ranks * threads
+        unit, index, unit_size, num_units = self._getPartitionPosition(rtr_id)
+        if num_units >= parts:
+            # Enough units to go around, keep each one whole
+            part = unit * parts // num_units
+        else:
+            part = (unit * unit_size + index) * parts // (num_units * unit_size)
+        return (part // threads, part % threads)
+
+    def getNodePartition(self,nid):
+        return self.getRouterPartition(self._getRouterForNode(nid))
+
+    def _partitionEndpoint(self,endpoint):
+        if not self._partition:
+            return endpoint
+        return _PartitionedEndpoint(self,endpoint)
+
+    def _nativeBuild(self, kind, endpoint):
+        # Returns True if the topology was built by the native builder
+        # The native builder does not place routers, so partition
+        # hints always use the python build
+        if not self.native_build or self._partition:
+            return False
+        builder = getattr(sys.modules.get("sst.merlin"), "_buildTopology", None)
+        if builder is None:
+            return False
+        builder(kind, self, endpoint)
+        return True
+
+
+# Wraps an endpoint so components it creates can follow their router
+class _PartitionedEndpoint(object):
+    def __init__(self,topology,endpoint):
+        self._topology = topology
+        self._endpoint = endpoint
+
+    def build(self, nID, extraKeys):
+        global _endpoint_partition
+        _endpoint_partition = self._topology.getNodePartition(nID)
+        try:
+            return self._endpoint.build(nID, extraKeys)
+        finally:
+            _endpoint_partition = None
+
 
 class NetworkInterface(TemplateBase):
     def __init__(self):
@@ -760,6 +853,7 @@ class EmptyJob(Job):
 
     def build(self, nID, extraKeys):
         nic = sst.Component("empty_node_%d"%nID, "merlin.simple_patterns.empty")
+        followRouter(nic)
         id = self._nid_map[nID]
 
         #  Add the linkcontrol
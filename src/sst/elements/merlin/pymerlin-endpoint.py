@@ -30,6 +30,7 @@ class TestJob(Job):
 
     def build(self, nID, extraKeys):
         nic = sst.Component("testNic_%d"%nID, "merlin.test_nic")
+        followRouter(nic)
         self._applyStatisticsSettings(nic)
         nic.addParams(self._getGroupParams("main"))
         nic.addParams(extraKeys)
@@ -56,6 +57,7 @@ class OfferedLoadJob(Job):
 
     def build(self, nID, extraKeys):
         nic = sst.Component("offered_load_%d"%nID, "merlin.offered_load")
+        followRouter(nic)
         self._applyStatisticsSettings(nic)
         nic.addParams(self._getGroupParams("main"))
         nic.addParams(extraKeys)
@@ -83,6 +85,7 @@ class IncastJob(Job):
 
     def build(self, nID, extraKeys):
         nic = sst.Component("incast_%d"%nID, "merlin.simple_patterns.incast")
+        followRouter(nic)
         self._applyStatisticsSettings(nic)
         nic.addParams(self._getGroupParams("main"))
         nic.addParams(extraKeys)
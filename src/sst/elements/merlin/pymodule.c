@@ -27,6 +27,8 @@ void* genMerlinPyModule(void)
     // Must return a PyObject
 
     PyObject *code = Py_CompileString(pymerlin, "pymerlin", Py_file_input);
-    return PyImport_ExecCodeModule("sst.merlin", code);
+    PyObject *module = PyImport_ExecCodeModule("sst.merlin", code);
+    addMerlinNativeBuilders(module);
+    return module;
 }
 
@@ -25,6 +25,9 @@ extern "C" {
 
 void* genMerlinPyModule(void);
 
+// Adds the native topology builders (_buildTopology) to the sst.merlin module
+void addMerlinNativeBuilders(void* module);
+
 #ifdef __cplusplus
 }
 #endif
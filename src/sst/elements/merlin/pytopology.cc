@@ -0,0 +1,598 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include <Python.h>
+
+#include "pymodule.h"
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+  Native versions of the build() loops in the pymerlin topology
+  modules.  The python topology object still does all of its setup
+  (shape callbacks, global params, link maps, polarfly graph
+  generation) and then hands itself to sst.merlin._buildTopology(),
+  which instances routers, builds endpoints and wires links in exactly
+  the order the python build() does.  Routers and endpoints are still
+  created through the python objects, so platform defined routers and
+  any endpoint work the same way, only the per link/per port loop
+  overhead of the interpreter goes away.
+*/
+
+namespace {
+
+// Owned python reference
+class PyRef {
+public:
+    explicit PyRef(PyObject* o = NULL) : obj(o) {}
+    ~PyRef() { Py_XDECREF(obj); }
+
+    PyObject* get() const { return obj; }
+    void reset(PyObject* o) { Py_XDECREF(obj); obj = o; }
+    bool operator!() const { return obj == NULL; }
+
+private:
+    PyRef(const PyRef&);
+    PyRef& operator=(const PyRef&);
+
+    PyObject* obj;
+};
+
+class TopologyBuilder {
+public:
+    TopologyBuilder(PyObject* topo, PyObject* endpoint) :
+        topo(topo),
+        endpoint(endpoint)
+    {}
+
+    ~TopologyBuilder() {
+        for ( size_t i = 0; i < owned_links.size(); i++ ) {
+            Py_DECREF(owned_links[i]);
+        }
+    }
+
+    bool init() {
+        PyRef sst(PyImport_ImportModule("sst"));
+        if ( !sst ) return false;
+        link_class.reset(PyObject_GetAttrString(sst.get(), "Link"));
+        if ( !link_class ) return false;
+
+        PyRef router(PyObject_GetAttrString(topo, "router"));
+        if ( !router ) return false;
+        slot_name.reset(PyObject_CallMethod(router.get(), "getTopologySlotName", NULL));
+        if ( !slot_name ) return false;
+
+        link_latency.reset(PyObject_GetAttrString(topo, "link_latency"));
+        if ( !link_latency ) return false;
+        host_link_latency.reset(PyObject_GetAttrString(topo, "host_link_latency"));
+        if ( !host_link_latency ) return false;
+        return true;
+    }
+
+    bool buildDragonfly();
+    bool buildFattree();
+    bool buildPolarfly();
+
+private:
+
+    bool getLong(const char* attr, long& value) {
+        PyRef obj(PyObject_GetAttrString(topo, attr));
+        if ( !obj ) return false;
+        value = PyLong_AsLong(obj.get());
+        return !(value == -1 && PyErr_Occurred());
+    }
+
+    bool getLongList(const char* attr, std::vector<long>& values) {
+        PyRef obj(PyObject_GetAttrString(topo, attr));
+        if ( !obj ) return false;
+        return toLongList(obj.get(), attr, values);
+    }
+
+    bool toLongList(PyObject* obj, const char* what, std::vector<long>& values) {
+        PyRef seq(PySequence_Fast(obj, what));
+        if ( !seq ) return false;
+        Py_ssize_t size = PySequence_Fast_GET_SIZE(seq.get());
+        values.resize(size);
+        for ( Py_ssize_t i = 0; i < size; i++ ) {
+            values[i] = PyLong_AsLong(PySequence_Fast_GET_ITEM(seq.get(), i));
+            if ( values[i] == -1 && PyErr_Occurred() ) return false;
+        }
+        return true;
+    }
+
+    bool getTruth(const char* attr, bool& value) {
+        PyRef obj(PyObject_GetAttrString(topo, attr));
+        if ( !obj ) return false;
+        int truth = PyObject_IsTrue(obj.get());
+        if ( truth < 0 ) return false;
+        value = truth;
+        return true;
+    }
+
+    bool getString(const char* attr, std::string& value) {
+        PyRef obj(PyObject_GetAttrString(topo, attr));
+        if ( !obj ) return false;
+        return toString(obj.get(), value);
+    }
+
+    static bool toString(PyObject* obj, std::string& value) {
+        PyRef str(PyObject_Str(obj));
+        if ( !str ) return false;
+        const char* utf8 = PyUnicode_AsUTF8(str.get());
+        if ( !utf8 ) return false;
+        value = utf8;
+        return true;
+    }
+
+    static std::string portName(long port) {
+        return "port" + std::to_string(port);
+    }
+
+    // Returns a borrowed reference, the builder keeps every link alive
+    // until the build is done
+    PyObject* newLink(const std::string& name) {
+        PyObject* link = PyObject_CallFunction(link_class.get(), "s", name.c_str());
+        if ( link ) owned_links.push_back(link);
+        return link;
+    }
+
+    // Same as the getLink() helpers in the python builds: one link
+    // object per name, created on first use
+    PyObject* getLink(const std::string& name) {
+        std::unordered_map<std::string, PyObject*>::iterator it = named_links.find(name);
+        if ( it != named_links.end() ) return it->second;
+        PyObject* link = newLink(name);
+        if ( link ) named_links[name] = link;
+        return link;
+    }
+
+    bool addLink(PyObject* comp, PyObject* link, const std::string& port, PyObject* latency) {
+        PyRef ret(PyObject_CallMethod(comp, "addLink", "OsO", link, port.c_str(), latency));
+        return !!ret.get();
+    }
+
+    bool call(PyObject* obj, const char* method, PyObject* arg) {
+        PyRef ret(PyObject_CallMethod(obj, method, "O", arg));
+        return !!ret.get();
+    }
+
+    PyObject* instanceRouter(long radix, long rtr_id) {
+        return PyObject_CallMethod(topo, "_instanceRouter", "ll", radix, rtr_id);
+    }
+
+    // Loads the topology subcomponent and applies the topology's
+    // statistics settings to it
+    PyObject* setTopology(PyObject* rtr, const char* type, bool pass_slot_num) {
+        PyObject* sub;
+        if ( pass_slot_num ) sub = PyObject_CallMethod(rtr, "setSubComponent", "Osi", slot_name.get(), type, 0);
+        else sub = PyObject_CallMethod(rtr, "setSubComponent", "Os", slot_name.get(), type);
+        if ( !sub ) return NULL;
+        if ( !call(topo, "_applyStatisticsSettings", sub) ) {
+            Py_DECREF(sub);
+            return NULL;
+        }
+        return sub;
+    }
+
+    // Calls endpoint.build(id, {}).  ep is left NULL when the endpoint
+    // returned a false component
+    bool buildEndpoint(long id, PyRef& ep, PyRef& port_name) {
+        PyRef keys(PyDict_New());
+        if ( !keys ) return false;
+        PyRef ret(PyObject_CallMethod(endpoint, "build", "lO", id, keys.get()));
+        if ( !ret ) return false;
+
+        PyObject* comp;
+        PyObject* port;
+        if ( !PyArg_ParseTuple(ret.get(), "OO", &comp, &port) ) return false;
+        int truth = PyObject_IsTrue(comp);
+        if ( truth < 0 ) return false;
+        if ( truth ) {
+            Py_INCREF(comp);
+            ep.reset(comp);
+            Py_INCREF(port);
+            port_name.reset(port);
+        }
+        return true;
+    }
+
+    bool fattreeLevel(long level, long group, const std::vector<PyObject*>& links);
+
+    PyObject* topo;
+    PyObject* endpoint;
+
+    PyRef link_class;
+    PyRef slot_name;
+    PyRef link_latency;
+    PyRef host_link_latency;
+    PyRef main_params;
+
+    std::vector<PyObject*> owned_links;
+    std::unordered_map<std::string, PyObject*> named_links;
+
+    // Fattree shape
+    std::vector<long> ups;
+    std::vector<long> downs;
+    std::vector<long> routers_per_level;
+    std::vector<long> groups_per_level;
+    std::vector<long> start_ids;
+    bool bundle_endpoints;
+};
+
+
+bool
+TopologyBuilder::buildDragonfly()
+{
+    long hosts_per_router, routers_per_group, num_groups, intragroup_links, intergroup_links;
+    if ( !getLong("hosts_per_router", hosts_per_router) ) return false;
+    if ( !getLong("routers_per_group", routers_per_group) ) return false;
+    if ( !getLong("num_groups", num_groups) ) return false;
+    if ( !getLong("intragroup_links", intragroup_links) ) return false;
+    if ( !getLong("intergroup_links", intergroup_links) ) return false;
+
+    std::string prefix, instance_name, global_routes;
+    if ( !getString("_prefix", prefix) ) return false;
+    if ( !getString("_instance_name", instance_name) ) return false;
+    if ( !getString("global_routes", global_routes) ) return false;
+
+    PyRef global_link_map_obj(PyObject_GetAttrString(topo, "global_link_map"));
+    if ( !global_link_map_obj ) return false;
+    std::vector<long> global_link_map;
+    if ( !toLongList(global_link_map_obj.get(), "global_link_map", global_link_map) ) return false;
+
+    const long total_intergroup_links = (num_groups - 1) * intergroup_links;
+    const long igpr = (total_intergroup_links + routers_per_group - 1) / routers_per_group;
+    const long num_ports = ((routers_per_group - 1) * intragroup_links) + hosts_per_router + igpr;
+    const long ng = num_groups - 1;
+
+    if ( (long)global_link_map.size() < igpr * routers_per_group ) {
+        PyErr_SetString(PyExc_IndexError, "global_link_map is smaller than intergroup ports per router * routers_per_group");
+        return false;
+    }
+
+    const std::string global_params = "params_" + instance_name;
+
+    long router_num = 0;
+    long nic_num = 0;
+    for ( long g = 0; g < num_groups; g++ ) {
+        for ( long r = 0; r < routers_per_group; r++ ) {
+            PyRef rtr(instanceRouter(num_ports, router_num));
+            if ( !rtr ) return false;
+
+            PyRef sub(setTopology(rtr.get(), "merlin.dragonfly", true));
+            if ( !sub ) return false;
+            PyRef ret(PyObject_CallMethod(sub.get(), "addGlobalParamSet", "s", global_params.c_str()));
+            if ( !ret ) return false;
+            ret.reset(PyObject_CallMethod(sub.get(), "addParam", "sl", "intergroup_per_router", igpr));
+            if ( !ret ) return false;
+            if ( router_num == 0 ) {
+                ret.reset(PyObject_CallMethod(sub.get(), "addParam", "sO", "global_link_map", global_link_map_obj.get()));
+                if ( !ret ) return false;
+            }
+
+            long port = 0;
+            for ( long p = 0; p < hosts_per_router; p++ ) {
+                PyRef nic, nic_port;
+                if ( !buildEndpoint(nic_num, nic, nic_port) ) return false;
+                if ( !!nic ) {
+                    PyObject* link = newLink("link_g" + std::to_string(g) + "r" + std::to_string(r) + "h" + std::to_string(p));
+                    if ( !link ) return false;
+                    ret.reset(PyObject_CallMethod(link, "connect", "(OOO)(OsO)",
+                                                  nic.get(), nic_port.get(), host_link_latency.get(),
+                                                  rtr.get(), portName(port).c_str(), host_link_latency.get()));
+                    if ( !ret ) return false;
+                }
+                nic_num++;
+                port++;
+            }
+
+            for ( long p = 0; p < routers_per_group; p++ ) {
+                if ( p == r ) continue;
+                const long src = std::min(p, r);
+                const long dst = std::max(p, r);
+                for ( long s = 0; s < intragroup_links; s++ ) {
+                    PyObject* link = getLink("link_g" + std::to_string(g) + "r" + std::to_string(src) +
+                                             "r" + std::to_string(dst) + "s" + std::to_string(s));
+                    if ( !link ) return false;
+                    if ( !addLink(rtr.get(), link, portName(port), link_latency.get()) ) return false;
+                    port++;
+                }
+            }
+
+            for ( long p = 0; p < igpr; p++ ) {
+                const long raw_dest = global_link_map[r * igpr + p];
+                if ( raw_dest != -1 ) {
+                    const long link_num = raw_dest / ng;
+                    long dest_grp = raw_dest - link_num * ng;
+                    if ( global_routes == "absolute" ) {
+                        if ( dest_grp >= g ) dest_grp++;
+                    }
+                    else if ( global_routes == "relative" ) {
+                        dest_grp = (dest_grp + g + 1) % (ng + 1);
+                    }
+                    const long src = std::min(dest_grp, g);
+                    const long dest = std::max(dest_grp, g);
+                    PyObject* link = getLink(prefix + "global_link_g" + std::to_string(src) + "g" + std::to_string(dest) +
+                                             "r" + std::to_string(link_num));
+                    if ( !link ) return false;
+                    if ( !addLink(rtr.get(), link, portName(port), link_latency.get()) ) return false;
+                }
+                port++;
+            }
+
+            router_num++;
+        }
+    }
+    return true;
+}
+
+
+bool
+TopologyBuilder::fattreeLevel(long level, long group, const std::vector<PyObject*>& links)
+{
+    const long id = start_ids[level] + group * (routers_per_level[level] / groups_per_level[level]);
+
+    if ( level == 0 ) {
+        std::vector<PyObject*> host_links;
+        for ( long i = 0; i < downs[0]; i++ ) {
+            const long node_id = id * downs[0] + i;
+            PyRef ep, ep_port;
+            if ( !buildEndpoint(node_id, ep, ep_port) ) return false;
+            if ( !ep ) continue;
+
+            PyObject* hlink = newLink("hostlink_" + std::to_string(node_id));
+            if ( !hlink ) return false;
+            if ( bundle_endpoints ) {
+                PyRef ret(PyObject_CallMethod(hlink, "setNoCut", NULL));
+                if ( !ret ) return false;
+            }
+            PyRef ret(PyObject_CallMethod(ep.get(), "addLink", "OOO", hlink, ep_port.get(), host_link_latency.get()));
+            if ( !ret ) return false;
+            host_links.push_back(hlink);
+        }
+
+        PyRef rtr(instanceRouter(ups[0] + downs[0], id));
+        if ( !rtr ) return false;
+        PyRef sub(setTopology(rtr.get(), "merlin.fattree", false));
+        if ( !sub ) return false;
+        if ( !call(sub.get(), "addParams", main_params.get()) ) return false;
+
+        for ( size_t l = 0; l < host_links.size(); l++ ) {
+            if ( !addLink(rtr.get(), host_links[l], portName(l), link_latency.get()) ) return false;
+        }
+        for ( size_t l = 0; l < links.size(); l++ ) {
+            if ( !addLink(rtr.get(), links[l], portName(l + downs[0]), link_latency.get()) ) return false;
+        }
+        return true;
+    }
+
+    const long rtrs_in_group = routers_per_level[level] / groups_per_level[level];
+
+    // Down links for the routers in this group
+    std::vector<std::vector<PyObject*> > rtr_links(rtrs_in_group);
+    for ( long i = 0; i < rtrs_in_group; i++ ) {
+        for ( long j = 0; j < downs[level]; j++ ) {
+            PyObject* link = newLink("link_l" + std::to_string(level) + "_g" + std::to_string(group) +
+                                     "_r" + std::to_string(i) + "_p" + std::to_string(j));
+            if ( !link ) return false;
+            rtr_links[i].push_back(link);
+        }
+    }
+
+    for ( long i = 0; i < downs[level]; i++ ) {
+        std::vector<PyObject*> group_links;
+        for ( long j = 0; j < rtrs_in_group; j++ ) {
+            group_links.push_back(rtr_links[j][i]);
+        }
+        if ( !fattreeLevel(level - 1, group * downs[level] + i, group_links) ) return false;
+    }
+
+    for ( size_t i = 0; i < links.size(); i++ ) {
+        rtr_links[i % rtrs_in_group].push_back(links[i]);
+    }
+
+    for ( long i = 0; i < rtrs_in_group; i++ ) {
+        PyRef rtr(instanceRouter(ups[level] + downs[level], id + i));
+        if ( !rtr ) return false;
+        PyRef sub(setTopology(rtr.get(), "merlin.fattree", false));
+        if ( !sub ) return false;
+        if ( !call(sub.get(), "addParams", main_params.get()) ) return false;
+
+        for ( size_t l = 0; l < rtr_links[i].size(); l++ ) {
+            if ( !addLink(rtr.get(), rtr_links[i][l], portName(l), link_latency.get()) ) return false;
+        }
+    }
+    return true;
+}
+
+
+bool
+TopologyBuilder::buildFattree()
+{
+    if ( !getLongList("_ups", ups) ) return false;
+    if ( !getLongList("_downs", downs) ) return false;
+    if ( !getLongList("_routers_per_level", routers_per_level) ) return false;
+    if ( !getLongList("_groups_per_level", groups_per_level) ) return false;
+    if ( !getLongList("_start_ids", start_ids) ) return false;
+    if ( !getTruth("bundleEndpoints", bundle_endpoints) ) return false;
+
+    if ( ups.empty() ) {
+        PyErr_SetString(PyExc_ValueError, "native fattree build requires at least two levels");
+        return false;
+    }
+
+    main_params.reset(PyObject_CallMethod(topo, "_getGroupParams", "s", "main"));
+    if ( !main_params ) return false;
+
+    const long level = ups.size();
+    const long rtrs_in_group = routers_per_level[level] / groups_per_level[level];
+
+    std::vector<std::vector<PyObject*> > rtr_links(rtrs_in_group);
+    for ( long i = 0; i < rtrs_in_group; i++ ) {
+        for ( long j = 0; j < downs[level]; j++ ) {
+            PyObject* link = newLink("link_l" + std::to_string(level) + "_g0_r" + std::to_string(i) + "_p" + std::to_string(j));
+            if ( !link ) return false;
+            rtr_links[i].push_back(link);
+        }
+    }
+
+    for ( long i = 0; i < downs[level]; i++ ) {
+        std::vector<PyObject*> group_links;
+        for ( long j = 0; j < rtrs_in_group; j++ ) {
+            group_links.push_back(rtr_links[j][i]);
+        }
+        if ( !fattreeLevel(level - 1, i, group_links) ) return false;
+    }
+
+    const long radix = downs[level];
+    for ( long i = 0; i < routers_per_level[level]; i++ ) {
+        PyRef rtr(instanceRouter(radix, start_ids[level] + i));
+        if ( !rtr ) return false;
+        PyRef sub(setTopology(rtr.get(), "merlin.fattree", true));
+        if ( !sub ) return false;
+        if ( !call(sub.get(), "addParams", main_params.get()) ) return false;
+
+        for ( size_t l = 0; l < rtr_links[i].size(); l++ ) {
+            if ( !addLink(rtr.get(), rtr_links[i][l], portName(l), link_latency.get()) ) return false;
+        }
+    }
+    return true;
+}
+
+
+bool
+TopologyBuilder::buildPolarfly()
+{
+    long total_routers, hosts_per_router, total_radix;
+    if ( !getLong("total_routers", total_routers) ) return false;
+    if ( !getLong("hosts_per_router", hosts_per_router) ) return false;
+    if ( !getLong("total_radix", total_radix) ) return false;
+    if ( !getTruth("bundleEndpoints", bundle_endpoints) ) return false;
+
+    PyRef graph(PyObject_GetAttrString(topo, "topo"));
+    if ( !graph ) return false;
+
+    main_params.reset(PyObject_CallMethod(topo, "_getGroupParams", "s", "main"));
+    if ( !main_params ) return false;
+
+    for ( long router = 0; router < total_routers; router++ ) {
+        PyRef rtr(instanceRouter(total_radix, router));
+        if ( !rtr ) return false;
+        PyRef sub(setTopology(rtr.get(), "merlin.polarfly", false));
+        if ( !sub ) return false;
+        if ( !call(sub.get(), "addParams", main_params.get()) ) return false;
+
+        long port = 0;
+        for ( long local = 0; local < hosts_per_router; local++ ) {
+            PyRef ep, ep_port;
+            if ( !buildEndpoint(router * hosts_per_router + local, ep, ep_port) ) return false;
+            if ( !!ep ) {
+                PyObject* link = newLink("nic_" + std::to_string(router) + "_" + std::to_string(local));
+                if ( !link ) return false;
+                PyRef ret;
+                if ( bundle_endpoints ) {
+                    ret.reset(PyObject_CallMethod(link, "setNoCut", NULL));
+                    if ( !ret ) return false;
+                }
+                ret.reset(PyObject_CallMethod(link, "connect", "(OOO)(OsO)",
+                                              ep.get(), ep_port.get(), host_link_latency.get(),
+                                              rtr.get(), portName(port).c_str(), host_link_latency.get()));
+                if ( !ret ) return false;
+            }
+            port++;
+        }
+
+        // Link names order the two endpoints by their string form,
+        // the same as the python getLink()
+        const std::string router_str = std::to_string(router);
+        PyRef neighbors(PySequence_GetItem(graph.get(), router));
+        if ( !neighbors ) return false;
+        PyRef iter(PyObject_GetIter(neighbors.get()));
+        if ( !iter ) return false;
+        while ( true ) {
+            PyRef neighbor(PyIter_Next(iter.get()));
+            if ( !neighbor ) {
+                if ( PyErr_Occurred() ) return false;
+                break;
+            }
+            std::string neighbor_str;
+            if ( !toString(neighbor.get(), neighbor_str) ) return false;
+
+            std::string name;
+            if ( router_str < neighbor_str ) name = "link_" + router_str + "_" + neighbor_str;
+            else name = "link_" + neighbor_str + "_" + router_str;
+
+            PyObject* link = getLink(name);
+            if ( !link ) return false;
+            if ( !addLink(rtr.get(), link, portName(port), link_latency.get()) ) return false;
+            port++;
+        }
+
+        if ( port >= total_radix + 1 ) {
+            PyErr_Format(PyExc_AssertionError, "polarfly router %ld uses %ld ports but has radix %ld",
+                         router, port, total_radix);
+            return false;
+        }
+    }
+    return true;
+}
+
+
+PyObject*
+buildTopology(PyObject* self, PyObject* args)
+{
+    const char* kind;
+    PyObject* topo;
+    PyObject* endpoint;
+    if ( !PyArg_ParseTuple(args, "sOO", &kind, &topo, &endpoint) ) return NULL;
+
+    TopologyBuilder builder(topo, endpoint);
+    if ( !builder.init() ) return NULL;
+
+    const std::string name(kind);
+    bool ok;
+    if ( name == "dragonfly" ) ok = builder.buildDragonfly();
+    else if ( name == "fattree" ) ok = builder.buildFattree();
+    else if ( name == "polarfly" ) ok = builder.buildPolarfly();
+    else {
+        PyErr_Format(PyExc_ValueError, "no native builder for topology '%s'", kind);
+        return NULL;
+    }
+    if ( !ok ) return NULL;
+
+    Py_RETURN_NONE;
+}
+
+PyMethodDef native_builder_methods[] = {
+    { "_buildTopology", buildTopology, METH_VARARGS,
+      "_buildTopology(kind, topology, endpoint): build the routers and links of a dragonfly, fattree or polarfly topology" },
+    { NULL, NULL, 0, NULL }
+};
+
+}
+
+
+void addMerlinNativeBuilders(void* module)
+{
+    if ( !module ) return;
+    if ( PyModule_AddFunctions((PyObject*)module, native_builder_methods) < 0 ) {
+        // Leave the python builds in place if the functions can't be added
+        PyErr_Clear();
+    }
+}
@@ -17,6 +17,8 @@ from sst.merlin.endpoint import *
 from sst.merlin.interface import *
 from sst.merlin.topology import *
 
+import sys
+
 if __name__ == "__main__":
 
 
@@ -27,6 +29,7 @@ if __name__ == "__main__":
     topo.intergroup_links = 4
     topo.num_groups = 5
     topo.algorithm = ["minimal","ugal"]
+    topo.native_build = "--native" in sys.argv
 
     group_size = topo.hosts_per_router * topo.routers_per_group
     
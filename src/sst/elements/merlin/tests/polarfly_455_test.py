@@ -26,6 +26,7 @@ if __name__ == "__main__":
     topo                        = topoPolarFly(q=specified_q)
     topo.algorithm              = specified_algo
     topo.hosts_per_router       = specified_k
+    topo.native_build           = "--native" in sys.argv
 
 
     # Set up the routers
@@ -95,6 +95,16 @@ class testcase_merlin_Component(SSTTestCase):
     def test_merlin_polarstar_504(self):
         self.merlin_test_template("polarstar_504_test")
 
+    def test_merlin_dragon_128_native(self):
+        self.merlin_native_test_template("dragon_128_test")
+
+    def test_merlin_fattree_128_native(self):
+        self.merlin_native_test_template("fattree_128_system_test")
+
+    @unittest.skipIf(not(('sympy.polys.galoistools' in sys.modules) and ('sympy.polys.domains' in sys.modules)), "Polarfly construction requires sympy")
+    def test_merlin_polarfly_455_native(self):
+        self.merlin_native_test_template("polarfly_455_test")
+
 
 #####
 
@@ -132,3 +142,34 @@ class testcase_merlin_Component(SSTTestCase):
             diffdata = testing_get_diff_data(testcase)
             log_failure(diffdata)
         self.assertTrue(cmp_result, "Sorted Output file {0} does not match sorted Reference File {1}".format(outfile, reffile))
+
+    # Builds the topology with the python loops and again with the native
+    # builder (--native sets native_build) and checks both runs agree
+    def merlin_native_test_template(self, testcase):
+        # Get the path to the test files
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        # Set the various file paths
+        testDataFileName="test_merlin_{0}".format(testcase)
+
+        sdlfile = "{0}/{1}.py".format(test_path, testcase)
+        pyoutfile = "{0}/{1}_python.out".format(outdir, testDataFileName)
+        pyerrfile = "{0}/{1}_python.err".format(outdir, testDataFileName)
+        outfile = "{0}/{1}_native.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}_native.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}_native.testfile".format(outdir, testDataFileName)
+        pympioutfiles = "{0}/{1}_python.testfile".format(outdir, testDataFileName)
+
+        self.run_sst(sdlfile, pyoutfile, pyerrfile, mpi_out_files=pympioutfiles)
+        self.run_sst(sdlfile, outfile, errfile, other_args='--model-options=\"--native\"', mpi_out_files=mpioutfiles)
+
+        # Perform the tests
+        if os_test_file(errfile, "-s"):
+            log_testing_note("merlin test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+        cmp_result = testing_compare_sorted_diff(testcase, outfile, pyoutfile)
+        if (cmp_result == False):
+            diffdata = testing_get_diff_data(testcase)
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Sorted native build output file {0} does not match sorted python build output file {1}".format(outfile, pyoutfile))
@@ -64,7 +64,16 @@ class topoDragonFly(Topology):
         return sst.findComponentByName(self.getRouterNameForLocation(group,rtr))
 
 
+    def _getPartitionPosition(self,rtr_id):
+        # Keep groups together
+        rpg = self.routers_per_group
+        return (rtr_id // rpg, rtr_id % rpg, rpg, self.num_groups)
+
+    def _getRouterForNode(self,nid):
+        return nid // self.hosts_per_router
+
     def build(self, endpoint):
+        endpoint = self._partitionEndpoint(endpoint)
         if self._check_first_build():
             sst.addGlobalParams("params_%s"%self._instance_name, self._getGroupParams("main"))
 
@@ -118,6 +127,8 @@ class topoDragonFly(Topology):
 
         # End set global link map with default
 
+        if self._nativeBuild("dragonfly", endpoint):
+            return
 
         # g is group number
         # r is router number with group
@@ -113,7 +113,24 @@ class topoFatTree(Topology):
     
     
     
+    def _getPartitionPosition(self,rtr_id):
+        # Keep pods (the groups one level below the top) together.
+        # Every level is spread evenly over the pods, which also
+        # shares the top level routers out between them.
+        top = len(self._downs) - 1
+        num_pods = self._groups_per_level[max(top - 1, 0)]
+        level = top
+        while rtr_id < self._start_ids[level]:
+            level = level - 1
+        pos = (rtr_id - self._start_ids[level]) * num_pods
+        rtrs = self._routers_per_level[level]
+        return (pos // rtrs, pos % rtrs, rtrs, num_pods)
+
+    def _getRouterForNode(self,nid):
+        return nid // self._downs[0]
+
     def build(self, endpoint):
+        endpoint = self._partitionEndpoint(endpoint)
 
         if not self.host_link_latency:
             self.host_link_latency = self.link_latency
@@ -185,6 +202,9 @@ class topoFatTree(Topology):
         #  End recursive function
 
         level = len(self._ups)
+        if self._ups and self._nativeBuild("fattree", endpoint):
+            return
+
         if self._ups: # True for all cases except for single level
             #  Create the router links
             rtrs_in_group = self._routers_per_level[level] // self._groups_per_level[level]
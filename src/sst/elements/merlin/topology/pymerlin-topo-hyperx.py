@@ -107,7 +107,18 @@ class topoHyperX(Topology):
         return sst.findComponentByName(self.getRouterNameForLocation(location))
         
     
+    def _getPartitionPosition(self,rtr_id):
+        # Keep slabs along the last dimension together
+        slab = 1
+        for x in self._dim_size[:-1]:
+            slab = slab * x
+        return (rtr_id // slab, rtr_id % slab, slab, self._dim_size[-1])
+
+    def _getRouterForNode(self,nid):
+        return nid // int(self.local_ports)
+
     def build(self, endpoint):
+        endpoint = self._partitionEndpoint(endpoint)
         if self.host_link_latency is None:
             self.host_link_latency = self.link_latency
 
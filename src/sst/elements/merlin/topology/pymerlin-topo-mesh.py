@@ -106,7 +106,18 @@ class _topoMeshBase(Topology):
     def findRouterByLocation(self,location):
         return sst.findComponentByName(self.getRouterNameForLocation(location))
         
+    def _getPartitionPosition(self,rtr_id):
+        # Keep slabs along the last dimension together
+        slab = 1
+        for x in self._dim_size[:-1]:
+            slab = slab * x
+        return (rtr_id // slab, rtr_id % slab, slab, self._dim_size[-1])
+
+    def _getRouterForNode(self,nid):
+        return nid // int(self.local_ports)
+
     def build(self, endpoint):
+        endpoint = self._partitionEndpoint(endpoint)
         if self.host_link_latency is None:
             self.host_link_latency = self.link_latency
         
@@ -230,7 +241,14 @@ class topoSingle(Topology):
     def getRouterNameForId(self,rtr_id):
         return "%srouter"%self._prefix
         
+    def _getPartitionPosition(self,rtr_id):
+        return (0, 0, 1, 1)
+
+    def _getRouterForNode(self,nid):
+        return 0
+
     def build(self, endpoint):
+        endpoint = self._partitionEndpoint(endpoint)
         rtr = self._instanceRouter(self.num_ports,0)
 
         topo = rtr.setSubComponent(self.router.getTopologySlotName(),"merlin.singlerouter",0)
@@ -419,7 +419,15 @@ class topoPolarFly(Topology):
                 print( " ".join(str(e) for e in node) + " ", file=f)
         
 
+    def _getPartitionPosition(self,rtr_id):
+        # No natural grouping, split by router id
+        return (rtr_id, 0, 1, self.total_routers)
+
+    def _getRouterForNode(self,nid):
+        return nid // self.hosts_per_router
+
     def build(self, endpoint):
+        endpoint = self._partitionEndpoint(endpoint)
         if self._check_first_build():
             sst.addGlobalParams("params_%s"%self._instance_name, self._getGroupParams("main"))
 
@@ -443,6 +451,9 @@ class topoPolarFly(Topology):
             nxFound = True
         self.generate(validate=nxFound, save=True)
 
+        if self._nativeBuild("polarfly", endpoint):
+            return
+
         node_num = 0
         #2. Iterate over each router
         for router in range(self.total_routers):
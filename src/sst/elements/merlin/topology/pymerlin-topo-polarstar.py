@@ -610,7 +610,15 @@ class topoPolarStar(Topology):
         return adj_ps
     
     
+    def _getPartitionPosition(self,rtr_id):
+        # No natural grouping, split by router id
+        return (rtr_id, 0, 1, self.total_routers)
+
+    def _getRouterForNode(self,nid):
+        return nid // self.hosts_per_router
+
     def build(self, endpoint):
+        endpoint = self._partitionEndpoint(endpoint)
 
         if self._check_first_build():
             sst.addGlobalParams("params_%s"%self._instance_name, self._getGroupParams("main"))
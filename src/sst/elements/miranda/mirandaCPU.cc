@@ -71,6 +71,7 @@ RequestGenCPU::RequestGenCPU(SST::ComponentId_t id, SST::Params& params) :
         stdMemHandlers = new StdMemHandler(this, out);
 
 	maxOpLookup = params.find<uint64_t>("max_reorder_lookups", 16);
+	pendingRequests.setLookupLimit(maxOpLookup);
 
 	out->verbose(CALL_INFO, 1, 0, "Loaded memory interface successfully.\n");
 
@@ -241,10 +242,8 @@ void RequestGenCPU::handleEvent( Interfaces::StandardMem::Request* ev) {
 			out->verbose(CALL_INFO, 4, 0, "-> Entry has all parts satisfied, removing ID=%" PRIu64 ", total processing time: %" PRIu64 "ns\n",
 				cpuReq->getOriginalReqID(), (getCurrentSimTimeNano() - cpuReq->getIssueTime()));
 
-			// Notify every pending request that there may be a satisfied dependency
-			for(uint32_t i = 0; i < pendingRequests.size(); ++i) {
-				pendingRequests.at(i)->satisfyDependency(cpuReq->getOriginalReqID());
-			}
+			// Wake up any pending requests which depend on this one
+			pendingRequests.complete(cpuReq->getOriginalReqID());
 
 			delete cpuReq;
 		}
@@ -437,7 +436,6 @@ bool RequestGenCPU::clockTick(SST::Cycle_t cycle) {
 
     bool issued = false;
     uint32_t reqsIssuedThisCycle = 0;
-    std::vector<uint32_t> delReqs;
 
     // We need to generate at least as many requests as can be looked up in the OoO window
     // otherwise the issue will have starvation.
@@ -445,95 +443,125 @@ bool RequestGenCPU::clockTick(SST::Cycle_t cycle) {
         if( reqGen->isFinished()) {
             break;
     	} else {
-            reqGen->generate(&pendingRequests);
+            reqGen->generate(&generatedRequests);
     	}
     }
 
-    for(uint32_t i = 0; i < pendingRequests.size(); ++i) {
-        if(reqsIssuedThisCycle == reqMaxPerCycle) {
-            statMaxIssuePerCycle->addData(1);
-            break;
-    	}
+    for(uint32_t i = 0; i < generatedRequests.size(); ++i) {
+        pendingRequests.push_back(generatedRequests.at(i));
+    }
+    generatedRequests.clear();
+
+    // Work out where an in-order walk of the window would stop: at the reorder
+    // limit, the first fence, or the first load/store whose slots are all taken.
+    // Only requests with their dependencies satisfied before that point are visited.
+    enum { STOP_END, STOP_REORDER, STOP_FENCE, STOP_FULL } stopReason =
+        pendingRequests.beyondWindow() ? STOP_REORDER : STOP_END;
+    uint64_t stopAt = pendingRequests.getWindowEnd();
+
+    const uint64_t fenceAt = pendingRequests.nextFence(0);
+    if(fenceAt < stopAt) {
+        stopAt = fenceAt;
+        stopReason = STOP_FENCE;
+    }
 
-	// Only a certain number of lookups are allowed, if we exceed this then we
-        // must exit the issue loop
-    	if(i == maxOpLookup) {
-            out->verbose(CALL_INFO, 2, 0, "Hit maximum reorder limit this cycle, no further operations will issue.\n");
-            statCyclesHitReorderLimit->addData(1);
-            break;
-    	}
+    const ReqOperation memOps[] = { READ, WRITE };
+    for(int op = 0; op < 2; ++op) {
+        if(requestsPending[memOps[op]] >= maxRequestsPending[memOps[op]]) {
+            const uint64_t fullAt = pendingRequests.nextOfType(memOps[op], 0);
+            if(fullAt < stopAt) {
+                stopAt = fullAt;
+                stopReason = STOP_FULL;
+            }
+        }
+    }
 
-        MemoryOpRequest* memOpReq;
-	GeneratorRequest* nxtRq = pendingRequests.at(i);
+    bool hitMaxIssue = false;
 
-	if(nxtRq->getOperation() == REQ_FENCE) {
-            if(0 == requestsInFlight.size()) {
-		out->verbose(CALL_INFO, 4, 0, "Fence operation completed, no pending requests, will be retired.\n");
+    if(0 == reqMaxPerCycle && ! pendingRequests.empty()) {
+        statMaxIssuePerCycle->addData(1);
+        hitMaxIssue = true;
+    }
 
-                // Keep record we will delete fence at i
-    		delReqs.push_back(i);
+    std::set<uint64_t>& ready = pendingRequests.getReady();
+    auto nxtReady = ready.begin();
 
-                // Delete the fence
-    		delete nxtRq;
-            } else {
-                out->verbose(CALL_INFO, 4, 0, "Fence operation in flight (>0 pending requests), stall.\n");
-            }
+    while( ! hitMaxIssue && nxtReady != ready.end() && *nxtReady < stopAt ) {
+        const uint64_t seq = *nxtReady;
+        ++nxtReady;
 
-            statCyclesHitFence->addData(1);
+        GeneratorRequest* nxtRq = pendingRequests.at(seq);
+        const ReqOperation op = nxtRq->getOperation();
 
-            // Fence operations do now allow anything else to complete in this cycle
-            break;
-        } else if (nxtRq->getOperation() == CUSTOM) {
-            if (requestsPending[CUSTOM] < maxRequestsPending[CUSTOM]) {
-                out->verbose(CALL_INFO, 4, 0, "Will attempt to issue as free slots in the load/store unit.\n");
+        if(CUSTOM == op && requestsPending[CUSTOM] >= maxRequestsPending[CUSTOM]) {
+            continue;
+        }
 
-		if(nxtRq->canIssue()) {
-                    issued = true;
-                    reqsIssuedThisCycle++;
-                    out->verbose(CALL_INFO, 4, 0, "Request %" PRIu64 " encountered, cleared to be issued, %" PRIu32 " issued this cycle.\n",
-                            nxtRq->getRequestID(), reqsIssuedThisCycle);
+        out->verbose(CALL_INFO, 4, 0, "Will attempt to issue as free slots in the load/store unit.\n");
 
-    		    // Keep record we will delete at index i
-                    delReqs.push_back(i);
+        issued = true;
+        reqsIssuedThisCycle++;
+        out->verbose(CALL_INFO, 4, 0, "Request %" PRIu64 " encountered, cleared to be issued, %" PRIu32 " issued this cycle.\n",
+                nxtRq->getRequestID(), reqsIssuedThisCycle);
 
-                    issueCustomRequest(static_cast<CustomOpRequest*>(nxtRq));
+        pendingRequests.remove(seq);
 
-                    delete nxtRq;
+        if(CUSTOM == op) {
+            issueCustomRequest(static_cast<CustomOpRequest*>(nxtRq));
+        } else if(READ == op || WRITE == op) {
+            issueRequest(static_cast<MemoryOpRequest*>(nxtRq));
+
+            if(requestsPending[op] >= maxRequestsPending[op]) {
+                const uint64_t fullAt = pendingRequests.nextOfType(op, seq + 1);
+                if(fullAt < stopAt) {
+                    stopAt = fullAt;
+                    stopReason = STOP_FULL;
                 }
             }
-        } else if ( ( memOpReq = dynamic_cast<MemoryOpRequest*>(nxtRq) ) ) {
+        } else {
+            out->fatal(CALL_INFO, -1, "Error, invalid operation \n");
+        }
 
-            if( requestsPending[memOpReq->getOperation()] < maxRequestsPending[memOpReq->getOperation()] ) {
-                out->verbose(CALL_INFO, 4, 0, "Will attempt to issue as free slots in the load/store unit.\n");
+        delete nxtRq;
 
+        if(reqsIssuedThisCycle == reqMaxPerCycle && pendingRequests.hasLiveAfter(seq)) {
+            statMaxIssuePerCycle->addData(1);
+            hitMaxIssue = true;
+        }
+    }
 
-		if(nxtRq->canIssue()) {
-                    issued = true;
-                    reqsIssuedThisCycle++;
+    if( ! hitMaxIssue ) {
+        switch(stopReason) {
+        case STOP_REORDER:
+            out->verbose(CALL_INFO, 2, 0, "Hit maximum reorder limit this cycle, no further operations will issue.\n");
+            statCyclesHitReorderLimit->addData(1);
+            break;
 
-                    out->verbose(CALL_INFO, 4, 0, "Request %" PRIu64 " encountered, cleared to be issued, %" PRIu32 " issued this cycle.\n",
-                            nxtRq->getRequestID(), reqsIssuedThisCycle);
+        case STOP_FENCE:
+            if(0 == requestsInFlight.size()) {
+                out->verbose(CALL_INFO, 4, 0, "Fence operation completed, no pending requests, will be retired.\n");
 
-    		    // Keep record we will delete at index i
-                    delReqs.push_back(i);
+                GeneratorRequest* fence = pendingRequests.at(stopAt);
+                pendingRequests.remove(stopAt);
+                delete fence;
+            } else {
+                out->verbose(CALL_INFO, 4, 0, "Fence operation in flight (>0 pending requests), stall.\n");
+            }
 
-                    issueRequest(memOpReq);
+            // Fence operations do now allow anything else to complete in this cycle
+            statCyclesHitFence->addData(1);
+            break;
 
-                    delete nxtRq;
-		} else {
-                    out->verbose(CALL_INFO, 4, 0, "Request %" PRIu64 " in queue, has dependencies which are not satisfied, wait.\n",
-                            nxtRq->getRequestID());
-                }
-    	    } else {
-                out->verbose(CALL_INFO, 4, 0, "All load/store/custom slots occupied, no more issues will be attempted.\n");
-    	        break;
-            }
-	} else {
-            out->fatal(CALL_INFO, -1, "Error, invalid operation \n");
+        case STOP_FULL:
+            out->verbose(CALL_INFO, 4, 0, "All load/store/custom slots occupied, no more issues will be attempted.\n");
+            break;
+
+        default:
+            break;
         }
     }
 
-    pendingRequests.erase(delReqs);
+    pendingRequests.endCycle();
 
     if(issued) {
 	statCyclesWithIssue->addData(1);
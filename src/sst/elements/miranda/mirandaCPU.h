@@ -23,6 +23,7 @@
 #include "mirandaGenerator.h"
 #include "mirandaEvent.h"
 #include "mirandaMemMgr.h"
+#include "mirandaIssueWindow.h"
 
 using namespace SST;
 using namespace SST::Interfaces;
@@ -147,7 +148,8 @@ private:
     MirandaReqEvent* srcReqEvent;
     StdMemHandler* stdMemHandlers;
 
-    MirandaRequestQueue<GeneratorRequest*> pendingRequests;
+    MirandaRequestQueue<GeneratorRequest*> generatedRequests;
+    MirandaIssueWindow pendingRequests;
     MirandaMemoryManager* memMgr;
 
     uint32_t maxRequestsPending[OPCOUNT];
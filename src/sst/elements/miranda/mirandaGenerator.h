@@ -51,6 +51,10 @@ public:
 		dependsOn.push_back(depReq);
 	}
 
+	const std::vector<uint64_t>& getDependencies() const {
+		return dependsOn;
+	}
+
 	void satisfyDependency(const GeneratorRequest* req) {
 		satisfyDependency(req->getRequestID());
 	}
@@ -124,21 +128,24 @@ public:
 		return maxCapacity;
 	}
 
+	void clear() {
+		curSize = 0;
+	}
+
        	QueueType at(const uint32_t index) {
                	return theQ[index];
        	}
 
-       	void erase(const std::vector<uint32_t> eraseList) {
+       	void erase(const std::vector<uint32_t>& eraseList) {
 		if(0 == eraseList.size()) {
 			return;
 		}
 
-               	QueueType* newQ = (QueueType*) malloc(sizeof(QueueType) * maxCapacity);
-
                	uint32_t nextSkipIndex = 0;
                	uint32_t nextSkip = eraseList.at(nextSkipIndex);
                 uint32_t nextNewQIndex = 0;
 
+		// Compact in place, entries only ever move towards the front
                	for(uint32_t i = 0; i < curSize; ++i) {
                        	if(nextSkip == i) {
                                 nextSkipIndex++;
@@ -149,14 +156,11 @@ public:
                                        	nextSkip = eraseList.at(nextSkipIndex);
                                 }
                        	} else {
-                               	newQ[nextNewQIndex] = theQ[i];
+                               	theQ[nextNewQIndex] = theQ[i];
                                 nextNewQIndex++;
                        	}
                	}
 
-                free(theQ);
-
-               	theQ = newQ;
 		curSize = nextNewQIndex;
         }
 
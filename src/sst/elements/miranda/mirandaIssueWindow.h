@@ -0,0 +1,227 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_MIRANDA_ISSUE_WINDOW
+#define _H_SST_MIRANDA_ISSUE_WINDOW
+
+#include <stdint.h>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "mirandaGenerator.h"
+
+namespace SST {
+namespace Miranda {
+
+/*
+ * Out-of-order issue window for the Miranda CPU.
+ *
+ * Requests are held in a ring indexed by a sequence number assigned in
+ * generation order. Issued requests leave holes which are skipped as the
+ * head advances. The first lookupLimit live requests form the reorder
+ * window.
+ *
+ * Dependencies are tracked as a producer->consumer graph: each consumer
+ * counts the producers it is still waiting on and joins the ready set when
+ * the count reaches zero, so the CPU only looks at requests that can issue.
+ */
+class MirandaIssueWindow {
+public:
+	MirandaIssueWindow() :
+		slots(16), head(0), tail(0), windowEnd(0),
+		liveCount(0), liveInWindow(0), lookupLimit(16) {}
+
+	void setLookupLimit(const uint32_t limit) { lookupLimit = limit; }
+
+	uint32_t size() const { return liveCount; }
+	bool empty() const { return 0 == liveCount; }
+
+	/* True if there are live requests beyond the reorder window */
+	bool beyondWindow() const { return liveCount > liveInWindow; }
+
+	/* Sequence numbers at or past this are outside the reorder window */
+	uint64_t getWindowEnd() const { return windowEnd; }
+
+	GeneratorRequest* at(const uint64_t seq) const { return slot(seq).req; }
+
+	/* True if a live request was generated after seq */
+	bool hasLiveAfter(const uint64_t seq) const { return seq + 1 < tail; }
+
+	void push_back(GeneratorRequest* req) {
+		if(tail - head == slots.size()) {
+			grow();
+		}
+
+		const uint64_t seq = tail++;
+		Slot& s = slot(seq);
+		s.req = req;
+		s.waitingOn = 0;
+
+		// Link to producers which have not completed yet
+		const std::vector<uint64_t>& deps = req->getDependencies();
+		for(uint32_t i = 0; i < deps.size(); ++i) {
+			auto producer = consumers.find(deps[i]);
+			if(producer != consumers.end()) {
+				producer->second.push_back(seq);
+				s.waitingOn++;
+			}
+		}
+
+		consumers[req->getRequestID()];
+
+		const ReqOperation op = req->getOperation();
+		if(REQ_FENCE == op) {
+			fences.insert(seq);
+		} else if(READ == op || WRITE == op) {
+			byOp[op].insert(seq);
+		}
+
+		if(0 == s.waitingOn && REQ_FENCE != op) {
+			ready.insert(seq);
+		}
+
+		liveCount++;
+		advanceWindow();
+	}
+
+	/* Remove a request which has been issued or retired. Positions of the
+	 * remaining requests do not change until endCycle() is called. */
+	void remove(const uint64_t seq) {
+		Slot& s = slot(seq);
+		const ReqOperation op = s.req->getOperation();
+
+		if(REQ_FENCE == op) {
+			fences.erase(seq);
+			complete(s.req->getRequestID());
+		} else if(READ == op || WRITE == op) {
+			byOp[op].erase(seq);
+		}
+
+		ready.erase(seq);
+		s.req = NULL;
+		removed.push_back(seq);
+	}
+
+	/* Apply this cycle's removals and slide the window forward */
+	void endCycle() {
+		for(uint32_t i = 0; i < removed.size(); ++i) {
+			liveCount--;
+			if(removed[i] < windowEnd) {
+				liveInWindow--;
+			}
+		}
+		removed.clear();
+
+		while(head < tail && NULL == slot(head).req) {
+			head++;
+		}
+
+		while(tail > head && NULL == slot(tail - 1).req) {
+			tail--;
+		}
+
+		if(windowEnd > tail) {
+			windowEnd = tail;
+		}
+
+		advanceWindow();
+	}
+
+	/* A producer has fully completed, wake up its consumers */
+	void complete(const uint64_t reqID) {
+		auto producer = consumers.find(reqID);
+		if(producer == consumers.end()) {
+			return;
+		}
+
+		for(uint32_t i = 0; i < producer->second.size(); ++i) {
+			const uint64_t seq = producer->second[i];
+			Slot& s = slot(seq);
+			if(0 == --s.waitingOn && REQ_FENCE != s.req->getOperation()) {
+				ready.insert(seq);
+			}
+		}
+
+		consumers.erase(producer);
+	}
+
+	/* Requests with all dependencies satisfied, in generation order */
+	std::set<uint64_t>& getReady() { return ready; }
+
+	/* First fence at or after seq, or UINT64_MAX */
+	uint64_t nextFence(const uint64_t seq) const {
+		return first(fences, seq);
+	}
+
+	/* First read/write of type op at or after seq, or UINT64_MAX */
+	uint64_t nextOfType(const ReqOperation op, const uint64_t seq) const {
+		return first(byOp[op], seq);
+	}
+
+private:
+	struct Slot {
+		Slot() : req(NULL), waitingOn(0) {}
+		GeneratorRequest* req;
+		uint32_t waitingOn;
+	};
+
+	Slot& slot(const uint64_t seq) { return slots[seq & (slots.size() - 1)]; }
+	const Slot& slot(const uint64_t seq) const { return slots[seq & (slots.size() - 1)]; }
+
+	static uint64_t first(const std::set<uint64_t>& seqs, const uint64_t seq) {
+		auto it = seqs.lower_bound(seq);
+		return it == seqs.end() ? UINT64_MAX : *it;
+	}
+
+	void grow() {
+		std::vector<Slot> bigger(slots.size() * 2);
+		for(uint64_t seq = head; seq < tail; ++seq) {
+			bigger[seq & (bigger.size() - 1)] = slot(seq);
+		}
+		slots.swap(bigger);
+	}
+
+	void advanceWindow() {
+		while(liveInWindow < lookupLimit && windowEnd < tail) {
+			if(NULL != slot(windowEnd).req) {
+				liveInWindow++;
+			}
+			windowEnd++;
+		}
+	}
+
+	std::vector<Slot> slots;
+	uint64_t head;
+	uint64_t tail;
+	uint64_t windowEnd;
+	uint32_t liveCount;
+	uint32_t liveInWindow;
+	uint32_t lookupLimit;
+
+	std::set<uint64_t> ready;
+	std::set<uint64_t> fences;
+	std::set<uint64_t> byOp[OPCOUNT];
+	std::vector<uint64_t> removed;
+
+	// Consumers waiting on each pending or in-flight producer
+	std::unordered_map<uint64_t, std::vector<uint64_t> > consumers;
+};
+
+}
+}
+
+#endif
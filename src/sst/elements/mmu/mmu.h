@@ -30,7 +30,7 @@ class MMU : public SubComponent {
   public:
 
     typedef std::function<void(RequestID,/*link*/unsigned,/*core*/ unsigned ,/*hwThread*/ unsigned ,
-                 /*pid*/unsigned,/*vpn*/uint32_t,/*perms*/uint32_t,/*instPtr*/uint64_t,/*memAddr*/ uint64_t )> Callback;
+                 /*pid*/unsigned,/*vpn*/uint64_t,/*perms*/uint32_t,/*instPtr*/uint64_t,/*memAddr*/ uint64_t )> Callback;
 
     SST_ELI_REGISTER_SUBCOMPONENT_API(SST::MMU_Lib::MMU)
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS()
@@ -52,15 +52,17 @@ class MMU : public SubComponent {
     virtual void dup( unsigned fromPid, unsigned toPid ) = 0;
     virtual void removeWrite( unsigned pid ) = 0;
     virtual void flushTlb( unsigned core, unsigned hwThread ) = 0;
-    virtual void unmap( unsigned pid, uint32_t vpn, size_t numPages ) = 0;
-    virtual void map( unsigned pid, uint32_t vpn, std::vector<uint32_t>& ppns, int pageSize, uint64_t flags ) = 0;
-    virtual void map( unsigned pid, uint32_t vpn, uint32_t ppn, int pageSize, uint64_t flags ) = 0;
-    virtual int getPerms( unsigned pid, uint32_t vpn ) = 0;
-    virtual void faultHandled( RequestID, unsigned link, unsigned pid, unsigned vpn, bool success = false ) = 0;
+    // invalidate numPages translations starting at vpn, the whole hwThread if not supported
+    virtual void flushTlb( unsigned core, unsigned hwThread, uint64_t vpn, size_t numPages ) { flushTlb( core, hwThread ); }
+    virtual void unmap( unsigned pid, uint64_t vpn, size_t numPages ) = 0;
+    virtual void map( unsigned pid, uint64_t vpn, std::vector<uint32_t>& ppns, int pageSize, uint64_t flags ) = 0;
+    virtual void map( unsigned pid, uint64_t vpn, uint32_t ppn, int pageSize, uint64_t flags ) = 0;
+    virtual void faultHandled( RequestID, unsigned link, unsigned pid, uint64_t vpn, bool success = false ) = 0;
     virtual void initPageTable( unsigned pid ) = 0;
     virtual void setCoreToPageTable( unsigned core, unsigned hwThread, unsigned pid ) = 0; 
     virtual uint32_t virtToPhys( unsigned pid, uint64_t vpn ) = 0;
-    virtual uint32_t getPerms( unsigned pid, uint64_t vpn ) = 0;
+    // -1 if vpn is not mapped
+    virtual int getPerms( unsigned pid, uint64_t vpn ) = 0;
 
   protected:
 
@@ -115,19 +115,29 @@ class TlbFlushReqEvent  : public SST::Event {
 
   public:
     TlbFlushReqEvent() : Event() {}
-    TlbFlushReqEvent( unsigned hwThread ) : Event(), hwThread(hwThread) { }
+    TlbFlushReqEvent( unsigned hwThread ) : Event(), hwThread(hwThread), vpn(0), numPages(0) { }
+    TlbFlushReqEvent( unsigned hwThread, uint64_t vpn, size_t numPages ) : Event(), hwThread(hwThread), vpn(vpn), numPages(numPages) { }
     virtual ~TlbFlushReqEvent() {}
 
     unsigned getHwThread() { return hwThread; }
 
+    // a flush of zero pages flushes every translation for the hwThread
+    bool isRange() { return numPages > 0; }
+    uint64_t getVPN() { return vpn; }
+    size_t getNumPages() { return numPages; }
+
   private:
     void serialize_order(SST::Core::Serialization::serializer& ser) override {
         Event::serialize_order(ser);
         ser& hwThread;
+        ser& vpn;
+        ser& numPages;
     }
     ImplementSerializable(TlbFlushReqEvent);
 
     unsigned hwThread;
+    uint64_t vpn;
+    size_t numPages;
 };
 
 class TlbFlushRespEvent  : public SST::Event {
@@ -0,0 +1,341 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MMU_PAGE_TABLE_H
+#define MMU_PAGE_TABLE_H
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include "mmuTypes.h"
+
+namespace SST {
+
+namespace MMU_Lib {
+
+//
+// Multi-level radix page table keyed by a 64-bit VPN, 9 bits per level.
+// The tree only has as many levels as the largest VPN mapped needs and
+// grows upwards when a bigger VPN is added.
+//
+// Nodes are reference counted so a copy of a table (fork) shares the whole
+// tree with the original. A node is copied the first time it is written
+// through a table that shares it, so a copy costs nothing up front and only
+// the paths that are modified afterwards get duplicated.
+//
+// Every node keeps the number of mapped and writable PTEs below it so
+// removing a range or write permission can skip untouched subtrees without
+// copying them.
+//
+class PageTable {
+
+    static const int Bits = 9;
+    static const int Fanout = 1 << Bits;
+    static const int MaxLevels = ( 64 + Bits - 1 ) / Bits;
+
+    struct Node {
+        Node() : refs(1), entries(0), writable(0) {}
+        uint32_t refs;
+        uint64_t entries;
+        uint64_t writable;
+    };
+
+    struct Inner : public Node {
+        Inner() { memset( child, 0, sizeof(child) ); }
+        Node* child[Fanout];
+    };
+
+    struct Leaf : public Node {
+        Leaf() { memset( present, 0, sizeof(present) ); }
+        bool isPresent( int i ) const { return ( present[i/64] >> (i%64) ) & 1; }
+        PTE pte[Fanout];
+        uint64_t present[Fanout/64];
+    };
+
+    static bool isWritable( const PTE& pte ) { return pte.perms & 0x2; }
+
+  public:
+    PageTable() : m_root(nullptr), m_levels(0) {}
+
+    // the copy shares every node with the original
+    PageTable( const PageTable& other ) : m_root(other.m_root), m_levels(other.m_levels) {
+        if ( m_root ) {
+            ++m_root->refs;
+        }
+    }
+
+    ~PageTable() {
+        release( m_root, m_levels );
+    }
+
+    size_t size() const { return m_root ? m_root->entries : 0; }
+
+    void add( uint64_t vpn, PTE pte ) {
+        if ( levelsFor( vpn ) > m_levels ) {
+            grow( levelsFor( vpn ) );
+        }
+        add( m_root, m_levels, vpn, pte );
+    }
+
+    // remove numPages translations starting at vpn
+    void remove( uint64_t vpn, size_t numPages = 1 ) {
+        if ( 0 == numPages || nullptr == m_root || levelsFor( vpn ) > m_levels ) {
+            return;
+        }
+        uint64_t last = vpn + numPages - 1;
+        if ( last < vpn ) {
+            last = UINT64_MAX;
+        }
+        remove( m_root, m_levels, 0, vpn, last );
+        if ( 0 == m_root->entries ) {
+            release( m_root, m_levels );
+            m_root = nullptr;
+            m_levels = 0;
+        }
+    }
+
+    const PTE* find( uint64_t vpn ) const {
+        if ( levelsFor( vpn ) > m_levels ) {
+            return nullptr;
+        }
+        const Node* node = m_root;
+        for ( int level = m_levels - 1; level > 0 && node; level-- ) {
+            node = static_cast<const Inner*>(node)->child[ index( vpn, level ) ];
+        }
+        if ( nullptr == node ) {
+            return nullptr;
+        }
+        const Leaf* leaf = static_cast<const Leaf*>(node);
+        int i = index( vpn, 0 );
+        return leaf->isPresent( i ) ? &leaf->pte[i] : nullptr;
+    }
+
+    void removeWrite() {
+        if ( m_root ) {
+            removeWrite( m_root, m_levels );
+        }
+    }
+
+    void print( const std::string str ) {
+        print( m_root, m_levels, 0, str );
+    }
+
+  private:
+    PageTable& operator=( const PageTable& ); // do not implement
+
+    static int index( uint64_t vpn, int level ) {
+        return ( vpn >> ( Bits * level ) ) & ( Fanout - 1 );
+    }
+
+    static int levelsFor( uint64_t vpn ) {
+        int levels = 1;
+        while ( levels < MaxLevels && ( vpn >> ( Bits * levels ) ) ) {
+            ++levels;
+        }
+        return levels;
+    }
+
+    void grow( int levels ) {
+        if ( nullptr == m_root ) {
+            m_root = ( 1 == levels ) ? static_cast<Node*>( new Leaf ) : static_cast<Node*>( new Inner );
+            m_levels = levels;
+            return;
+        }
+        // the old root moves under the new one, its reference count does not change
+        while ( m_levels < levels ) {
+            Inner* top = new Inner;
+            top->child[0] = m_root;
+            top->entries = m_root->entries;
+            top->writable = m_root->writable;
+            m_root = top;
+            ++m_levels;
+        }
+    }
+
+    static void release( Node* node, int levels ) {
+        if ( nullptr == node || --node->refs ) {
+            return;
+        }
+        if ( 1 == levels ) {
+            delete static_cast<Leaf*>(node);
+            return;
+        }
+        Inner* inner = static_cast<Inner*>(node);
+        for ( int i = 0; i < Fanout; i++ ) {
+            release( inner->child[i], levels - 1 );
+        }
+        delete inner;
+    }
+
+    // make sure the node in this slot is owned only by this table
+    static Node* unshare( Node*& slot, int levels ) {
+        if ( 1 == slot->refs ) {
+            return slot;
+        }
+        Node* copy;
+        if ( 1 == levels ) {
+            copy = new Leaf( *static_cast<Leaf*>(slot) );
+        } else {
+            Inner* inner = new Inner( *static_cast<Inner*>(slot) );
+            for ( int i = 0; i < Fanout; i++ ) {
+                if ( inner->child[i] ) {
+                    ++inner->child[i]->refs;
+                }
+            }
+            copy = inner;
+        }
+        copy->refs = 1;
+        --slot->refs;
+        slot = copy;
+        return copy;
+    }
+
+    static void add( Node*& slot, int levels, uint64_t vpn, PTE pte ) {
+        Node* node = unshare( slot, levels );
+        int i = index( vpn, levels - 1 );
+
+        if ( 1 == levels ) {
+            Leaf* leaf = static_cast<Leaf*>(node);
+            if ( leaf->isPresent( i ) ) {
+                leaf->entries--;
+                leaf->writable -= isWritable( leaf->pte[i] );
+            }
+            leaf->present[i/64] |= (uint64_t) 1 << (i%64);
+            leaf->pte[i] = pte;
+            leaf->entries++;
+            leaf->writable += isWritable( pte );
+            return;
+        }
+
+        Inner* inner = static_cast<Inner*>(node);
+        Node*& child = inner->child[i];
+        if ( nullptr == child ) {
+            child = ( 2 == levels ) ? static_cast<Node*>( new Leaf ) : static_cast<Node*>( new Inner );
+        }
+        inner->entries -= child->entries;
+        inner->writable -= child->writable;
+        add( child, levels - 1, vpn, pte );
+        inner->entries += child->entries;
+        inner->writable += child->writable;
+    }
+
+    // remove [first,last] from the subtree covering VPNs starting at base
+    static void remove( Node*& slot, int levels, uint64_t base, uint64_t first, uint64_t last ) {
+        if ( 0 == slot->entries ) {
+            return;
+        }
+        Node* node = unshare( slot, levels );
+
+        if ( 1 == levels ) {
+            Leaf* leaf = static_cast<Leaf*>(node);
+            int lo = first > base ? first - base : 0;
+            int hi = last - base < Fanout - 1 ? last - base : Fanout - 1;
+            for ( int i = lo; i <= hi; i++ ) {
+                if ( leaf->isPresent( i ) ) {
+                    leaf->present[i/64] &= ~( (uint64_t) 1 << (i%64) );
+                    leaf->entries--;
+                    leaf->writable -= isWritable( leaf->pte[i] );
+                }
+            }
+            return;
+        }
+
+        Inner* inner = static_cast<Inner*>(node);
+        int shift = Bits * ( levels - 1 );
+        uint64_t span = (uint64_t) 1 << shift;
+        int lo = first > base ? ( first - base ) >> shift : 0;
+        int hi = ( last - base ) >> shift < (uint64_t) Fanout - 1 ? ( last - base ) >> shift : Fanout - 1;
+
+        for ( int i = lo; i <= hi; i++ ) {
+            Node*& child = inner->child[i];
+            if ( nullptr == child ) {
+                continue;
+            }
+            uint64_t childBase = base + i * span;
+            inner->entries -= child->entries;
+            inner->writable -= child->writable;
+
+            if ( first <= childBase && childBase + ( span - 1 ) <= last ) {
+                // the whole subtree goes, no need to look inside it
+                release( child, levels - 1 );
+                child = nullptr;
+                continue;
+            }
+
+            remove( child, levels - 1, childBase, first, last );
+            if ( 0 == child->entries ) {
+                release( child, levels - 1 );
+                child = nullptr;
+            } else {
+                inner->entries += child->entries;
+                inner->writable += child->writable;
+            }
+        }
+    }
+
+    static void removeWrite( Node*& slot, int levels ) {
+        if ( 0 == slot->writable ) {
+            return;
+        }
+        Node* node = unshare( slot, levels );
+
+        if ( 1 == levels ) {
+            Leaf* leaf = static_cast<Leaf*>(node);
+            for ( int i = 0; i < Fanout; i++ ) {
+                leaf->pte[i].perms &= ~0x2;
+            }
+            leaf->writable = 0;
+            return;
+        }
+
+        Inner* inner = static_cast<Inner*>(node);
+        for ( int i = 0; i < Fanout; i++ ) {
+            if ( inner->child[i] ) {
+                removeWrite( inner->child[i], levels - 1 );
+            }
+        }
+        inner->writable = 0;
+    }
+
+    static void print( const Node* node, int levels, uint64_t base, const std::string& str ) {
+        if ( nullptr == node ) {
+            return;
+        }
+        if ( 1 == levels ) {
+            const Leaf* leaf = static_cast<const Leaf*>(node);
+            for ( int i = 0; i < Fanout; i++ ) {
+                if ( leaf->isPresent( i ) ) {
+                    printf("PageTabl::%s() %s vpn=%" PRIu64 " ppn=%d perm=%#x\n",__func__,str.c_str(),
+                        base + i, leaf->pte[i].ppn, leaf->pte[i].perms);
+                }
+            }
+            return;
+        }
+        const Inner* inner = static_cast<const Inner*>(node);
+        for ( int i = 0; i < Fanout; i++ ) {
+            print( inner->child[i], levels - 1, base + ( (uint64_t) i << ( Bits * ( levels - 1 ) ) ), str );
+        }
+    }
+
+    Node* m_root;
+    int m_levels;
+};
+
+} //namespace MMU_Lib
+} //namespace SST
+
+#endif /* MMU_PAGE_TABLE_H */
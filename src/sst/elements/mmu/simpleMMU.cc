@@ -23,6 +23,8 @@ using namespace SST::MMU_Lib;
 
 SimpleMMU::SimpleMMU(SST::ComponentId_t id, SST::Params& params) : MMU(id,params)
 {
+    m_rangeFlush = params.find<bool>("range_flush", false);
+
     char buffer[100];
     snprintf(buffer,100,"@t:SimpleMMU::@p():@l ");
     m_dbg.init( buffer,
@@ -78,28 +80,26 @@ void SimpleMMU::handleTlbEvent( Event* ev, int link )
     delete ev;
 }
 
-void SimpleMMU::map( unsigned pid, uint32_t vpn, uint32_t ppn, int pageSize, uint64_t flags ) 
+void SimpleMMU::map( unsigned pid, uint64_t vpn, uint32_t ppn, int pageSize, uint64_t flags ) 
 {
-    m_dbg.debug(CALL_INFO_LONG,1,0,"pid=%d vpn=%d ppn=%d pageSize=%d flags=%#" PRIx64 "\n", pid, vpn, ppn, pageSize, flags );
+    m_dbg.debug(CALL_INFO_LONG,1,0,"pid=%d vpn=%" PRIu64 " ppn=%d pageSize=%d flags=%#" PRIx64 "\n", pid, vpn, ppn, pageSize, flags );
     auto pageTable = getPageTable(pid);
     assert( pageTable );
 
     pageTable->add( vpn, PTE( ppn, flags ) );
 }
 
-void SimpleMMU::map( unsigned pid, uint32_t vpn, std::vector<uint32_t>& ppns, int pageSize, uint64_t flags ) {
+void SimpleMMU::map( unsigned pid, uint64_t vpn, std::vector<uint32_t>& ppns, int pageSize, uint64_t flags ) {
 
-    m_dbg.debug(CALL_INFO_LONG,1,0,"pid=%d vpn=%d numPages=%zu pageSize=%d flags=%#" PRIx64 "\n", pid, vpn, ppns.size(), pageSize, flags );
+    m_dbg.debug(CALL_INFO_LONG,1,0,"pid=%d vpn=%" PRIu64 " numPages=%zu pageSize=%d flags=%#" PRIx64 "\n", pid, vpn, ppns.size(), pageSize, flags );
     assert(0);
 }
 
-void SimpleMMU::unmap( unsigned pid, uint32_t vpn, size_t numPages ) {
-    m_dbg.debug(CALL_INFO_LONG,1,0,"pid=%d vpn=%d numPages=%zu\n", pid, vpn, numPages );
+void SimpleMMU::unmap( unsigned pid, uint64_t vpn, size_t numPages ) {
+    m_dbg.debug(CALL_INFO_LONG,1,0,"pid=%d vpn=%" PRIu64 " numPages=%zu\n", pid, vpn, numPages );
     auto pageTable = getPageTable(pid);
     assert( pageTable );
-    for ( auto i = 0; i < numPages; i++ ) {
-        pageTable->remove( vpn + i );
-    }
+    pageTable->remove( vpn, numPages );
 }
 
 void SimpleMMU::removeWrite( unsigned pid ) {
@@ -116,6 +116,7 @@ void SimpleMMU::dup( unsigned fromPid, unsigned toPid ) {
     //printf("%s() %p\n",__func__,fromTable);
     assert( fromTable );
 
+    // the child shares the parents page table until one of them changes it
     auto newTable = new PageTable( *fromTable );
     //newTable->print("new");
     initPageTable( toPid, newTable );
@@ -127,27 +128,27 @@ void SimpleMMU::flushTlb( unsigned core, unsigned hwThread ) {
     sendEvent( getLink(core,"dtlb"), new TlbFlushReqEvent( hwThread ) );
 } 
 
-void SimpleMMU::faultHandled( RequestID requestId, unsigned link, unsigned pid, unsigned vpn, bool success ) {
+void SimpleMMU::flushTlb( unsigned core, unsigned hwThread, uint64_t vpn, size_t numPages ) {
+    if ( ! m_rangeFlush ) {
+        flushTlb( core, hwThread );
+        return;
+    }
+    m_dbg.debug(CALL_INFO_LONG,1,0,"core=%d hwThread=%d vpn=%" PRIu64 " numPages=%zu\n",core,hwThread,vpn,numPages);
+    // one message covers the whole range
+    sendEvent( getLink(core,"dtlb"), new TlbFlushReqEvent( hwThread, vpn, numPages ) );
+} 
+
+void SimpleMMU::faultHandled( RequestID requestId, unsigned link, unsigned pid, uint64_t vpn, bool success ) {
 
     if ( success ) {
         auto pageTable = getPageTable(pid);
         assert( pageTable );
-        m_dbg.debug(CALL_INFO_LONG,1,0,"link=%d vpn=%#x virtAddr=%#" PRIx64 " ppn=%#x\n",
-            link, vpn, (uint64_t) vpn<<12, pageTable->find( vpn )->ppn );
+        m_dbg.debug(CALL_INFO_LONG,1,0,"link=%d vpn=%#" PRIx64 " virtAddr=%#" PRIx64 " ppn=%#x\n",
+            link, vpn, vpn<<12, pageTable->find( vpn )->ppn );
         sendEvent( link, new TlbFillEvent( requestId, *pageTable->find( vpn ) ) );
     } else {
-        m_dbg.debug(CALL_INFO_LONG,1,0,"link=%d vpn=%#x failed\n",link,vpn);
+        m_dbg.debug(CALL_INFO_LONG,1,0,"link=%d vpn=%#" PRIx64 " failed\n",link,vpn);
         sendEvent( link, new TlbFillEvent( requestId ) );
     }
 } 
 
-int SimpleMMU::getPerms( unsigned pid, uint32_t vpn ) {
-    auto pageTable = getPageTable(pid);
-    assert( pageTable );
-    PTE* pte = pageTable->find( vpn );
-    if ( nullptr == pte ) { 
-        return -1;
-    } 
-    return  pte->perms; 
-}
-
@@ -19,6 +19,7 @@
 #include <sst/core/link.h>
 #include "mmu.h"
 #include "mmuTypes.h"
+#include "pageTable.h"
 
 namespace SST {
 
@@ -40,20 +41,21 @@ class SimpleMMU : public MMU {
 #if 0
         {"hitLatency", "latency of MMU hit in ns","0"},
 #endif
+        {"range_flush", "Only invalidate the pages being unmapped in the TLBs instead of flushing the hardware thread","false"},
     )
 
     SimpleMMU(SST::ComponentId_t id, SST::Params& params);
 
     virtual void removeWrite( unsigned pid );
-    virtual void map( unsigned pid, uint32_t vpn, std::vector<uint32_t>& ppns, int pageSize, uint64_t flags );
-    virtual void map( unsigned pid, uint32_t vpn, uint32_t ppn, int pageSize, uint64_t flags );
-    virtual void unmap( unsigned pid, uint32_t vpn, size_t numPages );
+    virtual void map( unsigned pid, uint64_t vpn, std::vector<uint32_t>& ppns, int pageSize, uint64_t flags );
+    virtual void map( unsigned pid, uint64_t vpn, uint32_t ppn, int pageSize, uint64_t flags );
+    virtual void unmap( unsigned pid, uint64_t vpn, size_t numPages );
     virtual void dup( unsigned fromPid, unsigned toPid );
 
     virtual void flushTlb( unsigned core, unsigned hwThread );
+    virtual void flushTlb( unsigned core, unsigned hwThread, uint64_t vpn, size_t numPages );
 
-    virtual int getPerms( unsigned pid, uint32_t vpn );
-    virtual void faultHandled( RequestID, unsigned link, unsigned pid, unsigned vpn, bool success );
+    virtual void faultHandled( RequestID, unsigned link, unsigned pid, uint64_t vpn, bool success );
 
     void init( unsigned int phase )
     {
@@ -70,11 +72,11 @@ class SimpleMMU : public MMU {
         m_coreToPid[core][hwThread] = pid;
     }
 
-    virtual uint32_t getPerms( unsigned pid, uint64_t vpn ) {
+    virtual int getPerms( unsigned pid, uint64_t vpn ) {
         auto pageTable = m_pageTableMap[pid];
         assert( pageTable );
-        uint32_t perms = -1;
-        PTE* pte = nullptr;
+        int perms = -1;
+        const PTE* pte = nullptr;
         if ( ( pte = pageTable->find( vpn ) ) ) {
             m_dbg.debug(CALL_INFO_LONG,1,0,"found PTE ppn %d, perms %#x\n",pte->ppn,pte->perms);
             perms = pte->perms;
@@ -87,7 +89,7 @@ class SimpleMMU : public MMU {
         auto pageTable = m_pageTableMap[pid];
         assert( pageTable );
         uint32_t ppn= -1;
-        PTE* pte = nullptr;
+        const PTE* pte = nullptr;
         if ( ( pte = pageTable->find( vpn ) ) ) {
             m_dbg.debug(CALL_INFO_LONG,1,0,"found PTE ppn %d, perms %#x\n",pte->ppn,pte->perms);
             ppn = pte->ppn;
@@ -98,35 +100,6 @@ class SimpleMMU : public MMU {
 
   private:
 
-    class PageTable {
-      public:
-        void add( uint32_t vpn, PTE pte ) { 
-            pteMap[vpn] = pte;
-        }
-        void remove( uint32_t vpn ) { 
-            pteMap.erase(vpn);
-        }
-        PTE* find( uint32_t vpn ) {
-            if ( pteMap.find( vpn ) == pteMap.end() ) {
-                return nullptr;
-            } else { 
-                return &pteMap[vpn];
-            }
-        }
-        void removeWrite(  ) { 
-            for ( auto& kv : pteMap ) {
-                kv.second.perms &= ~0x2;
-            }
-        }
-        void print( const std::string str) {
-            for ( auto& kv : pteMap ) {
-                printf("PageTabl::%s() %s vpn=%d ppn=%d perm=%#x\n",__func__,str.c_str(),kv.first,kv.second.ppn,kv.second.perms);
-            }
-        }
-      private:
-        std::map<uint32_t,PTE> pteMap; 
-    };
-
     void initPageTable( unsigned pid, PageTable* table = nullptr ) {
         m_dbg.debug(CALL_INFO_LONG,1,0,"pid=%d\n",pid);
         auto iter = m_pageTableMap.find(pid);
@@ -167,6 +140,8 @@ class SimpleMMU : public MMU {
     std::map< unsigned, PageTable* > m_pageTableMap;
 
     std::vector< std::vector< unsigned > > m_coreToPid;
+
+    bool m_rangeFlush;
 };
 
 } //namespace MMU_Lib
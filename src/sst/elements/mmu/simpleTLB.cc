@@ -90,8 +90,13 @@ void SimpleTLB::handleMMUEvent( Event* ev ) {
     if ( nullptr == req ) {
         auto req = dynamic_cast<TlbFlushReqEvent*>(ev);
         if ( nullptr != req ) {
-            flushThread(req->getHwThread());
+            if ( req->isRange() ) {
+                flushRange( req->getHwThread(), req->getVPN(), req->getNumPages() );
+            } else {
+                flushThread( req->getHwThread() );
+            }
             m_mmuLink->send( 0, new TlbFlushRespEvent( req->getHwThread() ) );
+            delete ev;
             return;
         } else {
             assert(0);
@@ -22,6 +22,7 @@
 #include "mmuEvents.h"
 #include "tlb.h"
 #include <queue>
+#include <unordered_map>
 
 namespace SST {
 
@@ -184,6 +185,33 @@ class SimpleTLB : public TLB {
         }
     }
 
+    void flushRange( int hwThread, uint64_t vpn, size_t numPages ) {
+        m_dbg.debug(CALL_INFO,1,0,"hwThread=%d vpn=%" PRIu64 " numPages=%zu\n",hwThread,vpn,numPages);
+
+        auto& slice = m_tlbData[ hwThread ];
+
+        // probe each page unless the range is bigger than the TLB
+        if ( numPages <= slice.size() * m_tlbSetSize ) {
+            for ( size_t i = 0; i < numPages; i++ ) {
+                TlbEntry* entry = findTlbEntry( hwThread, vpn + i );
+                if ( entry ) {
+                    entry->setInvalid();
+                }
+            }
+            return;
+        }
+
+        for ( int i = 0; i < slice.size(); i++ ) {
+            auto& set = slice[i];
+            for ( int j = 0; j < set.size(); j++ ) {
+                size_t entryVpn = set[j].tag() << m_tlbIndexShift | i;
+                if ( set[j].isValid() && entryVpn >= vpn && entryVpn - vpn < numPages ) {
+                    set[j].setInvalid();
+                }
+            }
+        }
+    }
+
     Link* m_selfLink;
     Link* m_mmuLink;
     uint64_t m_hitLatency;
@@ -199,7 +227,7 @@ class SimpleTLB : public TLB {
     uint64_t m_minVirtAddr;
     uint64_t m_maxVirtAddr;
 
-    std::vector< std::map<size_t,std::queue<RequestID> > > m_waitingMiss;
+    std::vector< std::unordered_map<size_t,std::queue<RequestID> > > m_waitingMiss;
 };
 
 } //namespace MMU_Lib
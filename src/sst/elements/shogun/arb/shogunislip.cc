@@ -0,0 +1,184 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+
+#include "shogun_event.h"
+#include "shogunislip.h"
+#include "shogun_stat_bundle.h"
+
+using namespace SST::Shogun;
+
+ShogunISLIPArbitrator::ShogunISLIPArbitrator(const int ports, const int iterations)
+    : words((ports + 63) / 64)
+    , maxIterations(iterations <= 0 ? INT32_MAX : iterations)
+    , requests(ports * words, 0)
+    , eligible(words, 0)
+    , grantPtr(ports, 0)
+    , freeSlots(ports, 0)
+    , remaining(ports, 0)
+    , requestRound(ports, 0)
+    , round(0)
+    , matchedCycle(ports, UINT64_MAX)
+{
+    requested.reserve(ports);
+}
+
+ShogunISLIPArbitrator::~ShogunISLIPArbitrator() {}
+
+int ShogunISLIPArbitrator::findFrom(const uint64_t* mask, const int start) const
+{
+    int w = start / 64;
+    uint64_t bits = mask[w] & (~UINT64_C(0) << (start % 64));
+
+    // The last pass comes back to the starting word to pick up the bits
+    // below start
+    for (int n = 0; n <= words; ++n) {
+        if (bits != 0) {
+            return (w * 64) + __builtin_ctzll(bits);
+        }
+
+        w = (w + 1) % words;
+        bits = mask[w];
+    }
+
+    return -1;
+}
+
+void ShogunISLIPArbitrator::moveEvents(const int num_events,
+                                       const int port_count,
+                                       ShogunQueue<ShogunEvent*>** inputQueues,
+                                       int32_t output_slots,
+                                       ShogunEvent*** outputEvents,
+                                       uint64_t cycle ) {
+
+    output->verbose(CALL_INFO, 4, 0, "BEGIN: Arbitration (iSLIP) -------------------------------------------\n");
+
+    int32_t moved_count = 0;
+    int32_t matched_outputs = 0;
+    int32_t iteration = 0;
+
+    for (int32_t i = 0; i < words; ++i) {
+        eligible[i] = 0;
+    }
+
+    for (int32_t i = 0; i < port_count; ++i) {
+        if (num_events != 0 && !inputQueues[i]->empty()) {
+            remaining[i] = num_events;
+            setBit(&eligible[0], i);
+        }
+
+        freeSlots[i] = 0;
+        for (int32_t k = 0; k < output_slots; ++k) {
+            if (outputEvents[i][k] == nullptr) {
+                freeSlots[i]++;
+            }
+        }
+    }
+
+    for (; iteration < maxIterations; ++iteration) {
+        // Request: every eligible input asks for the output of its head event
+        requested.clear();
+        round++;
+
+        for (int32_t w = 0; w < words; ++w) {
+            uint64_t bits = eligible[w];
+
+            while (bits != 0) {
+                const int32_t in = (w * 64) + __builtin_ctzll(bits);
+                bits &= bits - 1;
+
+                const int32_t dest = inputQueues[in]->peek()->getDestination();
+
+                if (freeSlots[dest] == 0) {
+                    // Output stays full this cycle, nothing more can move from this input
+                    clearBit(&eligible[0], in);
+                    continue;
+                }
+
+                if (requestRound[dest] != round) {
+                    requestRound[dest] = round;
+                    requested.push_back(dest);
+                }
+
+                setBit(&requests[dest * words], in);
+            }
+        }
+
+        if (requested.empty()) {
+            break;
+        }
+
+        output->verbose(CALL_INFO, 4, 0, "-> iteration %" PRIi32 ": %" PRIu64 " outputs requested\n", iteration,
+                        static_cast<uint64_t>(requested.size()));
+
+        // Grant/accept: each output takes requesting inputs round robin from its
+        // pointer while it has free slots
+        for (const int32_t dest : requested) {
+            uint64_t* mask = &requests[dest * words];
+            int32_t start = grantPtr[dest];
+
+            while (freeSlots[dest] > 0) {
+                const int32_t in = findFrom(mask, start);
+
+                if (in < 0) {
+                    break;
+                }
+
+                clearBit(mask, in);
+
+                int32_t k = 0;
+                while (outputEvents[dest][k] != nullptr) {
+                    ++k;
+                }
+
+                output->verbose(CALL_INFO, 4, 0, "  -> moving event from: %" PRIi32 " to: %" PRIi32 " slot: %" PRIi32 "\n",
+                                in, dest, k);
+
+                outputEvents[dest][k] = inputQueues[in]->pop();
+                freeSlots[dest]--;
+                moved_count++;
+
+                if (matchedCycle[dest] != cycle) {
+                    matchedCycle[dest] = cycle;
+                    matched_outputs++;
+                }
+
+                if (0 == iteration) {
+                    grantPtr[dest] = (in + 1) % port_count;
+                }
+
+                if (inputQueues[in]->empty() || (num_events != -1 && --remaining[in] == 0)) {
+                    clearBit(&eligible[0], in);
+                }
+
+                start = (in + 1) % port_count;
+            }
+
+            // Requests that were not granted are dropped, the inputs ask again
+            // next iteration
+            for (int32_t m = 0; m < words; ++m) {
+                mask[m] = 0;
+            }
+        }
+    }
+
+    bundle->getPacketsMoved()->addData(moved_count);
+    bundle->getMatchSize()->addData(matched_outputs);
+    bundle->getArbIterations()->addData(iteration);
+
+    output->verbose(CALL_INFO, 4, 0, "-> moved: %" PRIi32 " to %" PRIi32 " outputs in %" PRIi32 " iterations\n", moved_count, matched_outputs, iteration);
+    output->verbose(CALL_INFO, 4, 0, "END: Arbitration ----------------------------------------------------\n");
+}
@@ -0,0 +1,89 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_SHOGUN_ISLIP_ARB_H
+#define _H_SHOGUN_ISLIP_ARB_H
+
+#include <cstdint>
+#include <vector>
+
+#include "shogun_event.h"
+#include "shogunarb.h"
+
+namespace SST {
+namespace Shogun {
+
+    /*
+     * iSLIP style arbitration. Each iteration every input whose queue
+     * head can still move requests the output of that event, each output
+     * with free slots grants requesting inputs round robin starting at
+     * its grant pointer and the granted events move across. Inputs keep
+     * a single FIFO (no virtual output queues) so an input only ever has
+     * one request, which makes the accept step the grant itself.
+     *
+     * Requests are kept as a bitmask of inputs per output, so a grant is
+     * a find-first-set from the grant pointer rather than a scan of every
+     * input. Grant pointers only move on matches made in the first
+     * iteration.
+     */
+    class ShogunISLIPArbitrator : public ShogunArbitrator {
+
+    public:
+        ShogunISLIPArbitrator(const int ports, const int iterations);
+        ~ShogunISLIPArbitrator();
+
+        void moveEvents(const int num_events,
+                        const int port_count,
+                        ShogunQueue<ShogunEvent*>** inputQueues,
+                        int32_t output_slots,
+                        ShogunEvent*** outputEvents,
+                        uint64_t cycle ) override;
+
+    private:
+        const int words;
+        const int maxIterations;
+
+        // Per output request bitmask, words entries per output
+        std::vector<uint64_t> requests;
+        // Inputs which can still move an event this cycle
+        std::vector<uint64_t> eligible;
+        std::vector<int32_t> grantPtr;
+        std::vector<int32_t> freeSlots;
+        std::vector<int32_t> remaining;
+        std::vector<int32_t> requested;
+        // Last round each output was added to requested
+        std::vector<uint64_t> requestRound;
+        uint64_t round;
+        // Last cycle each output was matched
+        std::vector<uint64_t> matchedCycle;
+
+        void setBit(uint64_t* mask, const int i) const
+        {
+            mask[i / 64] |= (UINT64_C(1) << (i % 64));
+        }
+
+        void clearBit(uint64_t* mask, const int i) const
+        {
+            mask[i / 64] &= ~(UINT64_C(1) << (i % 64));
+        }
+
+        // First set bit at or after start, wrapping around, -1 if none
+        int findFrom(const uint64_t* mask, const int start) const;
+    };
+
+}
+}
+
+#endif
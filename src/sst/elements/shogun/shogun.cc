@@ -19,6 +19,7 @@
 #include <sst/core/output.h>
 #include <sst/core/unitAlgebra.h>
 
+#include "arb/shogunislip.h"
 #include "arb/shogunrrarb.h"
 #include "shogun.h"
 #include "shogun_credit_event.h"
@@ -43,17 +44,26 @@ ShogunComponent::ShogunComponent(ComponentId_t id, Params& params)
     previousCycle = 0;
     pending_events = 0;
 
-    arb = new ShogunRoundRobinArbitrator();
-
     const int32_t verbosity = params.find<uint32_t>("verbose", 0);
 
     char prefix[256];
     snprintf(prefix, 256, "[t=@t][%s]: ", getName().c_str());
     output = new SST::Output(prefix, verbosity, 0, Output::STDOUT);
-    arb->setOutput(output);
 
     port_count = params.find<int32_t>("port_count", -1);
 
+    const std::string arbitration = params.find<std::string>("arbitration", "roundrobin");
+
+    if ("roundrobin" == arbitration) {
+        arb = new ShogunRoundRobinArbitrator();
+    } else if ("islip" == arbitration) {
+        arb = new ShogunISLIPArbitrator(port_count > 0 ? port_count : 1, params.find<int32_t>("islip_iterations", 4));
+    } else {
+        output->fatal(CALL_INFO, -1, "Error: unknown arbitration scheme: %s\n", arbitration.c_str());
+    }
+
+    arb->setOutput(output);
+
     output->verbose(CALL_INFO, 1, 0, "Creating Shogun crossbar at %s clock rate and %" PRIi32 " ports\n",
         clock_rate.c_str(), port_count);
 
@@ -103,6 +113,10 @@ ShogunComponent::ShogunComponent(ComponentId_t id, Params& params)
     stats = new ShogunStatisticsBundle(port_count);
     stats->registerStatistics(this);
 
+    if ("islip" == arbitration) {
+        stats->registerMatchStatistics(this);
+    }
+
     zeroEventCycles = registerStatistic<uint64_t>("cycles_zero_events");
     eventCycles = registerStatistic<uint64_t>("cycles_events");
 
@@ -45,7 +45,8 @@ public:
     SST_ELI_DOCUMENT_PARAMS(
         { "verbose",                "Level of output verbosity, higher is more output, 0 is no output", 0 },
         { "port_count",             "Number of ports on the Crossbar", "0" },
-        { "arbitration",            "Select the arbitration scheme", "roundrobin" },
+        { "arbitration",            "Select the arbitration scheme (roundrobin or islip)", "roundrobin" },
+        { "islip_iterations",       "Maximum request-grant-accept iterations per cycle for islip arbitration; 0 iterates until no more matches", "4" },
         { "clock",                  "Clock Frequency for the crossbar", "1.0GHz" },
         { "queue_slots",            "Depth of input queue", "64" },
         { "in_msg_per_cycle",       "Number of messages injested per cycle; -1 is unlimited", "1" },
@@ -56,6 +57,8 @@ public:
         { "cycles_zero_events",  "Number of cycles where there were no events to process, x-bar was quiet", "cycles", 1 },
         { "cycles_events",       "Number of cycles where events needed to be processed, x-bar may have been busy.", "cycles", 1 },
         { "packets_moved",       "Number of packets moved each cycle", "packets", 1 },
+        { "match_size",          "Number of output ports matched to an input each cycle (islip arbitration only)", "ports", 1 },
+        { "arb_iterations",      "Number of matching iterations which made progress each cycle (islip arbitration only)", "iterations", 1 },
         { "output_packet_count", "Number of communication packets which have been output", "packets", 1 },
         { "input_packet_count",  "Number of communication packets which have been input", "packets", 1 }
     )
@@ -31,6 +31,8 @@ namespace Shogun {
     public:
         ShogunStatisticsBundle(const int ports)
             : port_count(ports)
+            , matchSize(nullptr)
+            , arbIterations(nullptr)
         {
 
             output_packet_count = (Statistic<uint64_t>**)malloc(sizeof(Statistic<uint64_t>*) * port_count);
@@ -63,6 +65,13 @@ namespace Shogun {
             delete[] subIDName;
         }
 
+        // Only arbitrators which compute a matching record these
+        void registerMatchStatistics(ShogunComponent* comp)
+        {
+            matchSize = comp->bundleRegisterStatistic("match_size");
+            arbIterations = comp->bundleRegisterStatistic("arb_iterations");
+        }
+
         Statistic<uint64_t>* getOutputPacketCount(const int port)
         {
             return output_packet_count[port];
@@ -78,11 +87,23 @@ namespace Shogun {
             return packetsMoved;
         }
 
+        Statistic<uint64_t>* getMatchSize()
+        {
+            return matchSize;
+        }
+
+        Statistic<uint64_t>* getArbIterations()
+        {
+            return arbIterations;
+        }
+
     private:
         const int port_count;
         Statistic<uint64_t>** output_packet_count;
         Statistic<uint64_t>** input_packet_count;
         Statistic<uint64_t>* packetsMoved;
+        Statistic<uint64_t>* matchSize;
+        Statistic<uint64_t>* arbIterations;
     };
 
 }
@@ -1,4 +1,5 @@
 import sst
+import sys
 
 # Define SST core options
 sst.setProgramOption("timebase", "1ps")
@@ -8,6 +9,9 @@ sst.setStatisticLoadLevel(4)
 
 memory_mb = 1024
 
+# --model-options="islip" switches the crossbar to iSLIP arbitration
+arbitration = "islip" if "islip" in sys.argv[1:] else "roundrobin"
+
 # Define the simulation components
 comp_cpu0 = sst.Component("cpu0", "miranda.BaseCPU")
 gen_cpu0 = comp_cpu0.setSubComponent("generator", "miranda.GUPSGenerator")
@@ -154,6 +158,7 @@ shogun_xbar = sst.Component("shogunxbar", "shogun.ShogunXBar")
 shogun_xbar.addParams({
        "clock" : "1.0GHz",
        "port_count" : 4,
+       "arbitration" : arbitration,
        "verbose" : 0
 })
 
@@ -49,6 +49,9 @@ class testcase_shogun(SSTTestCase):
     def test_shogun_hierarchy_test(self):
         self.shogun_test_template("hierarchy_test")
 
+    def test_shogun_basic_miranda_islip(self):
+        self.shogun_islip_test_template("basic_miranda")
+
 #####
 
     def shogun_test_template(self, testcase):
@@ -85,3 +88,42 @@ class testcase_shogun(SSTTestCase):
             log_failure(diffdata)
         self.assertTrue(cmp_result, "Sorted Output file {0} does not match sorted Reference File {1}".format(outfile, reffile))
 
+    # Runs testcase with the crossbar using iSLIP arbitration.  Timing
+    # changes with the arbitration scheme, so the reference file only holds
+    # the statistics that do not depend on it; each of those lines has to
+    # be in the output, along with the iSLIP statistics.
+    def shogun_islip_test_template(self, testcase):
+        # Get the path to the test files
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        # Set the various file paths
+        testDataFileName="test_shogun_{0}_islip".format(testcase)
+
+        sdlfile = "{0}/{1}.py".format(test_path, testcase)
+        reffile = "{0}/refFiles/{1}.out".format(test_path, testDataFileName)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+        self.run_sst(sdlfile, outfile, errfile, other_args='--model-options=\"islip\"', mpi_out_files=mpioutfiles)
+
+        testing_remove_component_warning_from_file(outfile)
+
+        # Perform the tests
+        if os_test_file(errfile, "-s"):
+            log_testing_note("shogun test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+        with open(outfile) as f:
+            outlines = set(line.strip() for line in f)
+        with open(reffile) as f:
+            reflines = [line.strip() for line in f if line.strip()]
+
+        missing = [line for line in reflines if line not in outlines]
+        for line in missing:
+            log_failure("missing from output: {0}".format(line))
+        self.assertTrue(len(missing) == 0, "Output file {0} is missing {1} lines of Reference File {2}".format(outfile, len(missing), reffile))
+
+        for stat in ["match_size", "arb_iterations"]:
+            found = any(line.startswith("shogunxbar.{0} :".format(stat)) for line in outlines)
+            self.assertTrue(found, "Output file {0} has no shogunxbar.{1} statistic".format(outfile, stat))
@@ -0,0 +1,1134 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_OOO_LSQ
+#define _H_VANADIS_OOO_LSQ
+
+#include <sst/core/output.h>
+#include <sst/core/subcomponent.h>
+#include <sst/core/interfaces/stdMem.h>
+
+#include "lsq/vlsq.h"
+#include "lsq/vooolsqentry.h"
+#include "inst/vstorecond.h"
+
+#include <cassert>
+#include <cinttypes>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <set>
+#include <vector>
+
+using namespace SST::Interfaces;
+
+namespace SST {
+namespace Vanadis {
+
+/*
+ * Load-store queue with separate load and store queues which lets loads
+ * execute out of order with respect to each other and to older stores.
+ *
+ * - Loads issue as soon as their address is known. A load that overlaps
+ *   an older store with a known address takes its data from the youngest
+ *   such store if that store covers it, otherwise it waits for the store
+ *   to drain.
+ * - Loads may issue past older stores whose addresses are not known yet
+ *   (speculative_loads). When such a store resolves to an address that
+ *   overlaps a younger load which has already issued, the load is replayed.
+ *   Dependent instructions in Vanadis only read a register once its
+ *   producer retires, so a load is only marked executed once every older
+ *   store of its thread has an address, and a replay never needs a
+ *   pipeline flush.
+ * - Stores drain to memory in order once they are front of the ROB, the
+ *   same as the basic LSQ.
+ *
+ * Entries live in preallocated rings. Candidate overlaps are found through
+ * small counting filters indexed by 8-byte address granule, so the queues
+ * are only searched when an access could actually overlap.
+ */
+class VanadisOutOfOrderLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue {
+
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(VanadisOutOfOrderLoadStoreQueue, "vanadis", "VanadisOutOfOrderLoadStoreQueue",
+                                          SST_ELI_ELEMENT_VERSION(1, 0, 0),
+                                          "Implements an out-of-order load-store queue with store-to-load forwarding for use with the SST standardInterface",
+                                          SST::Vanadis::VanadisLoadStoreQueue)
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS({ "memory_interface", "Set the interface to memory",
+                                          "SST::Interfaces::StandardMem" })
+
+    SST_ELI_DOCUMENT_PORTS({ "dcache_link", "Connects the LSQ to the data cache", {} })
+
+    SST_ELI_DOCUMENT_PARAMS(
+            { "verbose", "Set the verbosity of output for the LSQ", "0" },
+            { "max_stores", "Set the maximum number of stores permitted in the store queue", "8" },
+            { "max_loads", "Set the maximum number of loads permitted in the load queue", "16" },
+            { "address_mask", "Can mask off address bits if needed during construction of a operation", "0xFFFFFFFFFFFFFFFF"},
+            { "issues_per_cycle", "Maximum number of loads and stores the LSQ can compute addresses for or issue per cycle.", "2"},
+            { "speculative_loads", "Allow loads to issue before the addresses of older stores are known, replaying them if they turn out to overlap", "1"}
+        )
+
+    SST_ELI_DOCUMENT_STATISTICS({ "bytes_read", "Count all the bytes read for data operations", "bytes", 1 },
+                                { "bytes_stored", "Count all the bytes written for data operations", "bytes", 1 },
+                                { "loads_issued", "Count the number of loads issued", "operations", 1 },
+                                { "stores_issued", "Count the number of stores issued", "operations", 1 },
+                                { "fences_issued", "Count the number of fences issued", "operations", 1},
+                                { "loads_executed", "Count the number of loads executed", "operations", 1 },
+                                { "stores_executed", "Count the number of stores executed", "operations", 1 },
+                                { "fences_executed", "Count the number of fences executed", "operations", 1},
+                                { "loads_in_flight", "Count the number of loads which are in-flight", "operations", 1},
+                                { "stores_in_flight", "Count the number of stores which are in-flight", "operations", 1},
+                                { "store_buffer_entries", "Count the number of stores held in the store queue", "operations", 1},
+                                { "loads_forwarded", "Count the number of loads which took their data from an older store", "operations", 1},
+                                { "loads_speculated", "Count the number of loads issued before all older store addresses were known", "operations", 1},
+                                { "load_replays", "Count the number of loads replayed because an older store overlapped them", "operations", 1})
+
+    VanadisOutOfOrderLoadStoreQueue(ComponentId_t id, Params& params) : VanadisLoadStoreQueue(id, params),
+        max_stores(params.find<size_t>("max_stores", 8)),
+        max_loads(params.find<size_t>("max_loads", 16)),
+        max_issue_attempts_per_cycle(params.find("issues_per_cycle", 2)),
+        speculative_loads(params.find<bool>("speculative_loads", true)),
+        loads(max_loads == 0 ? 1 : max_loads),
+        stores(max_stores == 0 ? 1 : max_stores),
+        next_seq(1) {
+
+        if(0 == max_loads || 0 == max_stores) {
+            output->fatal(CALL_INFO, -1, "Error: max_loads and max_stores must both be at least 1.\n");
+        }
+
+        std_mem_handlers = new VanadisOutOfOrderLoadStoreQueue::StandardMemHandlers(this, output);
+
+        memInterface = loadUserSubComponent<Interfaces::StandardMem>(
+            "memory_interface", ComponentInfo::SHARE_PORTS | ComponentInfo::INSERT_STATS, getTimeConverter("1ps"),
+            new StandardMem::Handler<SST::Vanadis::VanadisOutOfOrderLoadStoreQueue>(
+                this, &VanadisOutOfOrderLoadStoreQueue::processIncomingDataCacheEvent));
+
+        address_mask = params.find<uint64_t>("address_mask", 0xFFFFFFFFFFFFFFFFULL);
+
+        cache_line_width = params.find<uint64_t>("cache_line_width", 64);
+
+        memset(store_filter, 0, sizeof(store_filter));
+        memset(load_filter, 0, sizeof(load_filter));
+
+        stat_loads_issued = registerStatistic<uint64_t>("loads_issued", "1");
+        stat_stores_issued = registerStatistic<uint64_t>("stores_issued", "1");
+        stat_fences_issued = registerStatistic<uint64_t>("fences_issued", "1");
+
+        stat_loads_executed = registerStatistic<uint64_t>("loads_executed", "1");
+        stat_stores_executed = registerStatistic<uint64_t>("stores_executed", "1");
+        stat_fences_executed = registerStatistic<uint64_t>("fences_executed", "1");
+
+        stat_loaded_bytes = registerStatistic<uint64_t>("bytes_read", "1");
+        stat_stored_bytes = registerStatistic<uint64_t>("bytes_stored", "1");
+
+        stat_store_buffer_entries = registerStatistic<uint64_t>("store_buffer_entries", "1");
+        stat_stores_pending = registerStatistic<uint64_t>("stores_in_flight", "1");
+        stat_loads_pending = registerStatistic<uint64_t>("loads_in_flight", "1");
+
+        stat_loads_forwarded = registerStatistic<uint64_t>("loads_forwarded", "1");
+        stat_loads_speculated = registerStatistic<uint64_t>("loads_speculated", "1");
+        stat_load_replays = registerStatistic<uint64_t>("load_replays", "1");
+    }
+
+    virtual ~VanadisOutOfOrderLoadStoreQueue() {
+        delete std_mem_handlers;
+    }
+
+    bool storeFull() override { return stores.full(); }
+    bool loadFull() override { return loads.full(); }
+    bool storeBufferFull() override { return std_stores_in_flight.size() >= max_stores; }
+
+    size_t storeSize() override { return stores.size(); }
+    size_t loadSize() override { return loads.size(); }
+    size_t storeBufferSize() override { return std_stores_in_flight.size(); }
+
+    void push(VanadisStoreInstruction* store_me) override {
+        VanadisOOOStoreEntry& entry = stores.push_back();
+
+        entry.ins     = store_me;
+        entry.seq     = next_seq++;
+        entry.hw_thr  = store_me->getHWThread();
+        entry.state   = VanadisOOOStoreState::WAITING;
+        entry.address = 0;
+        entry.width   = 0;
+        entry.request = 0;
+
+        stat_stores_issued->addData(1);
+    }
+
+    void push(VanadisLoadInstruction* load_me) override {
+        VanadisOOOLoadEntry& entry = loads.push_back();
+
+        entry.ins            = load_me;
+        entry.seq            = next_seq++;
+        entry.hw_thr         = load_me->getHWThread();
+        entry.state          = VanadisOOOLoadState::WAITING;
+        entry.address        = 0;
+        entry.width          = 0;
+        entry.forwarded_from = 0;
+        entry.request_count  = 0;
+
+        stat_loads_issued->addData(1);
+    }
+
+    void push(VanadisFenceInstruction* fence) override {
+        fences.push_back({ fence, next_seq++, fence->getHWThread() });
+        stat_fences_issued->addData(1);
+    }
+
+    void clearLSQByThreadID(const uint32_t thread) override {
+        // Outstanding requests of removed entries no longer match anything
+        // when they return so they are dropped by the handlers
+        loads.removeIf([this, thread](VanadisOOOLoadEntry& entry) {
+            if(entry.hw_thr != thread) {
+                return false;
+            }
+            if(inLoadFilter(entry)) {
+                updateFilter(load_filter, entry.address, entry.width, -1);
+            }
+            return true;
+        });
+
+        stores.removeIf([this, thread](VanadisOOOStoreEntry& entry) {
+            if(entry.hw_thr != thread) {
+                return false;
+            }
+            if(inStoreFilter(entry)) {
+                updateFilter(store_filter, entry.address, entry.width, -1);
+            }
+            return true;
+        });
+
+        for(auto fence_itr = fences.begin(); fence_itr != fences.end(); ) {
+            if(fence_itr->hw_thr == thread) {
+                fence_itr = fences.erase(fence_itr);
+            } else {
+                ++fence_itr;
+            }
+        }
+    }
+
+    // must be implemented to allow the memory system to initialize itself during
+    // boot-up
+    void init(unsigned int phase) override {
+        memInterface->init(phase);
+
+        // update the cache line size each cycle to make sure we get updates
+        cache_line_width = memInterface->getLineSize();
+
+        output->verbose(CALL_INFO, 2, 0, "updating cache line size to: %" PRIu64 "\n", cache_line_width);
+    }
+
+    void printStatus(SST::Output& out) override {
+        if(output->getVerboseLevel() >= 16) {
+            for(size_t i = 0; i < loads.size(); ++i) {
+                VanadisOOOLoadEntry& entry = loads.at(i);
+
+                out.verbose(CALL_INFO, 16, 0, "-> load  [%4zu] seq: %" PRIu64 " state: %9s thr: %4" PRIu32 " addr: 0x%llx width: %" PRIu16 "\n",
+                    i, entry.seq, getLoadStateName(entry.state), entry.hw_thr, entry.address, entry.width);
+            }
+
+            for(size_t i = 0; i < stores.size(); ++i) {
+                VanadisOOOStoreEntry& entry = stores.at(i);
+
+                out.verbose(CALL_INFO, 16, 0, "-> store [%4zu] seq: %" PRIu64 " state: %10s thr: %4" PRIu32 " addr: 0x%llx width: %" PRIu16 "\n",
+                    i, entry.seq, getStoreStateName(entry.state), entry.hw_thr, entry.address, entry.width);
+            }
+
+            for(auto& fence : fences) {
+                out.verbose(CALL_INFO, 16, 0, "-> fence seq: %" PRIu64 " ins: 0x%llx thr: %4" PRIu32 "\n",
+                    fence.seq, fence.ins->getInstructionAddress(), fence.hw_thr);
+            }
+        }
+    }
+
+    void tick(uint64_t cycle) override {
+        output->verbose(CALL_INFO, 16, 0, "-> tick LSQ at cycle %" PRIu64 " (loads: %zu / stores: %zu / fences: %zu)\n",
+            cycle, loads.size(), stores.size(), fences.size());
+
+        stat_loads_pending->addData(countLoadsInFlight());
+        stat_stores_pending->addData(std_stores_in_flight.size());
+        stat_store_buffer_entries->addData(stores.size());
+
+        uint32_t budget = max_issue_attempts_per_cycle;
+
+        // Store addresses first, the sooner they are known the fewer loads
+        // have to wait or be replayed
+        for(size_t i = 0; i < stores.size() && budget > 0; ++i) {
+            VanadisOOOStoreEntry& entry = stores.at(i);
+
+            if(entry.state == VanadisOOOStoreState::WAITING && entry.ins->completedIssue()) {
+                computeStoreAddress(entry);
+                budget--;
+            }
+        }
+
+        for(size_t i = 0; i < loads.size(); ++i) {
+            VanadisOOOLoadEntry& entry = loads.at(i);
+
+            switch(entry.state) {
+            case VanadisOOOLoadState::WAITING:
+                if(budget > 0 && entry.ins->completedIssue()) {
+                    budget--;
+
+                    if(computeLoadAddress(entry)) {
+                        attemptLoad(entry);
+                    }
+                }
+                break;
+            case VanadisOOOLoadState::ADDRESSED:
+                if(budget > 0 && attemptLoad(entry)) {
+                    budget--;
+                }
+                break;
+            case VanadisOOOLoadState::COMPLETE:
+                markLoadExecuted(entry);
+                break;
+            default:
+                break;
+            }
+        }
+
+        retireLoads();
+        processFences();
+
+        // attempt to issue any front of ROB stores into memory system
+        issueStoreFront();
+    }
+
+protected:
+
+    class StandardMemHandlers : public Interfaces::StandardMem::RequestHandler {
+    public:
+        friend class VanadisOutOfOrderLoadStoreQueue;
+
+        StandardMemHandlers(VanadisOutOfOrderLoadStoreQueue* lsq, SST::Output* output) :
+                Interfaces::StandardMem::RequestHandler(output), lsq(lsq) {}
+
+        virtual ~StandardMemHandlers() {}
+
+        virtual void handle(StandardMem::ReadResp* ev) {
+            out->verbose(CALL_INFO, 16, VANADIS_DBG_LSQ_LOAD_FLG, "-> handle read-response (virt-addr: 0x%llx)\n", ev->vAddr);
+            lsq->stat_loaded_bytes->addData(ev->size);
+
+            VanadisOOOLoadEntry* load_entry = nullptr;
+
+            for(size_t i = 0; i < lsq->loads.size(); ++i) {
+                VanadisOOOLoadEntry& entry = lsq->loads.at(i);
+
+                if(entry.state == VanadisOOOLoadState::ISSUED && entry.containsRequest(ev->getID())) {
+                    load_entry = &entry;
+                    break;
+                }
+            }
+
+            if(nullptr == load_entry) {
+                // not found, so cleared by a branch mis-predict or replayed, ignore
+                delete ev;
+                return;
+            }
+
+            VanadisLoadInstruction* load_ins = load_entry->ins;
+
+            if(ev->getFail() || ev->vAddr < 64) {
+                load_ins->flagError();
+            }
+
+            lsq->writeLoadData(*load_entry, ev->vAddr, &ev->data[0], ev->size);
+            load_entry->removeRequest(ev->getID());
+
+            if(0 == load_entry->request_count) {
+                lsq->completeLoad(*load_entry);
+                lsq->markLoadExecuted(*load_entry);
+                lsq->retireLoads();
+            } else {
+                out->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_LOAD_FLG,
+                    "---> LSQ load (0x%llx / thr:%" PRIu32 ") has %" PRIu8 " requests left, will not execute until all done.\n",
+                    load_ins->getInstructionAddress(), load_entry->hw_thr, load_entry->request_count);
+            }
+
+            delete ev;
+        }
+
+        virtual void handle(StandardMem::WriteResp* ev) {
+            out->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_STORE_FLG, "-> handle write-response (virt-addr: 0x%llx)\n", ev->vAddr);
+            lsq->stat_stored_bytes->addData(ev->size);
+
+            auto iter = lsq->std_stores_in_flight.find( ev->getID() );
+            if ( iter != lsq->std_stores_in_flight.end() ) {
+                lsq->std_stores_in_flight.erase(iter);
+                delete ev;
+                return;
+            }
+
+            // only the store queue front can be waiting on a response, anything
+            // else was removed by a branch mis-predict
+            if(lsq->stores.empty()) {
+                delete ev;
+                return;
+            }
+
+            VanadisOOOStoreEntry& store_entry = lsq->stores.front();
+
+            if(store_entry.state != VanadisOOOStoreState::DISPATCHED || store_entry.request != ev->getID()) {
+                delete ev;
+                return;
+            }
+
+            VanadisStoreInstruction* store_ins = store_entry.ins;
+
+            switch(store_ins->getTransactionType()) {
+            case MEM_TRANSACTION_LLSC_STORE:
+            {
+                const uint16_t value_reg = store_ins->getPhysIntRegOut(0);
+
+                VanadisStoreConditionalInstruction* store_cond_ins = dynamic_cast<VanadisStoreConditionalInstruction*>(store_ins);
+
+                if(UNLIKELY(nullptr == store_cond_ins)) {
+                    out->fatal(CALL_INFO, -1, "Unable to cast an LLSC_STORE into a store-conditional, logic failure.\n");
+                }
+
+                if (ev->getSuccess()) {
+                    out->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_STORE_FLG, "---> LSQ LLSC-STORE rt: %" PRIu16 " (success)\n", value_reg);
+                    lsq->registerFiles->at(store_entry.hw_thr)->setIntReg<int64_t>(value_reg,
+                        store_cond_ins->getResultSuccess());
+                } else {
+                    out->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_STORE_FLG, "---> LSQ LLSC-STORE rt: %" PRIu16 " (failed)\n", value_reg);
+                    lsq->registerFiles->at(store_entry.hw_thr)->setIntReg<uint64_t>(value_reg,
+                        store_cond_ins->getResultFailure());
+                }
+            } break;
+            case MEM_TRANSACTION_LOCK:
+                break;
+            default:
+                // this is a logical error. fatal()
+                out->fatal(CALL_INFO, -1, "Error - reached a transaction NONE or LLSC_LOAD in a store return. Logical error (ins: 0x%llx / thr: %" PRIu32 ")\n",
+                    store_ins->getInstructionAddress(), store_entry.hw_thr);
+                break;
+            }
+
+            store_ins->markExecuted();
+            lsq->stat_stores_executed->addData(1);
+            lsq->popStoreFront();
+
+            delete ev;
+        }
+
+        VanadisOutOfOrderLoadStoreQueue* lsq;
+    };
+
+    void processIncomingDataCacheEvent(StandardMem::Request* ev) {
+        output->verbose(CALL_INFO, 16, 0, "received incoming data cache request -> processIncomingDataCacheEvent()\n");
+
+        assert(ev != nullptr);
+        assert(std_mem_handlers != nullptr);
+
+        ev->handle(std_mem_handlers);
+    }
+
+    // Address filters ---------------------------------------------------------
+
+    static const uint32_t filter_size = 256;
+
+    void updateFilter(uint16_t* filter, const uint64_t address, const uint64_t width, const int delta) {
+        const uint64_t last = (address + (width == 0 ? 0 : width - 1)) >> 3;
+
+        for(uint64_t granule = address >> 3; granule <= last; ++granule) {
+            filter[granule & (filter_size - 1)] += delta;
+        }
+    }
+
+    bool filterHit(const uint16_t* filter, const uint64_t address, const uint64_t width) const {
+        const uint64_t last = (address + (width == 0 ? 0 : width - 1)) >> 3;
+
+        for(uint64_t granule = address >> 3; granule <= last; ++granule) {
+            if(filter[granule & (filter_size - 1)] != 0) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    static bool inLoadFilter(const VanadisOOOLoadEntry& entry) {
+        return entry.state == VanadisOOOLoadState::ISSUED || entry.state == VanadisOOOLoadState::COMPLETE;
+    }
+
+    static bool inStoreFilter(const VanadisOOOStoreEntry& entry) {
+        return entry.state == VanadisOOOStoreState::ADDRESSED || entry.state == VanadisOOOStoreState::DISPATCHED;
+    }
+
+    // Stores ------------------------------------------------------------------
+
+    void computeStoreAddress(VanadisOOOStoreEntry& entry) {
+        VanadisStoreInstruction* store_ins = entry.ins;
+
+        uint64_t store_address = 0;
+        uint16_t store_width   = 0;
+
+        store_ins->computeStoreAddress(output, registerFiles->at(entry.hw_thr), &store_address, &store_width);
+
+        if(store_ins->trapsError()) {
+            output->verbose(CALL_INFO, 16, 0, "----> warning: 0x%llx / thr: %" PRIu32 " traps error, marks executed and does not process.\n",
+                store_ins->getInstructionAddress(), entry.hw_thr);
+            store_ins->markExecuted();
+            entry.state = VanadisOOOStoreState::DONE;
+            entry.ins   = nullptr;
+            return;
+        }
+
+        output->verbose(CALL_INFO, 16, 0, "----> computed store address: 0x%llx width: %" PRIu16 " thr: %" PRIu32 "\n",
+            store_address, store_width, entry.hw_thr);
+
+        entry.address = store_address;
+        entry.width   = store_width;
+        entry.state   = VanadisOOOStoreState::ADDRESSED;
+        updateFilter(store_filter, entry.address, entry.width, 1);
+
+        // any younger load which has already read this data got a stale value
+        if(filterHit(load_filter, entry.address, entry.width)) {
+            for(size_t i = 0; i < loads.size(); ++i) {
+                VanadisOOOLoadEntry& load_entry = loads.at(i);
+
+                if(load_entry.hw_thr == entry.hw_thr && load_entry.seq > entry.seq && inLoadFilter(load_entry) &&
+                    load_entry.forwarded_from < entry.seq && load_entry.overlaps(entry.address, entry.width)) {
+                    output->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_LOAD_FLG, "---> replay load ins: 0x%llx / thr: %" PRIu32 ", overlaps store ins: 0x%llx\n",
+                        load_entry.ins->getInstructionAddress(), load_entry.hw_thr, store_ins->getInstructionAddress());
+
+                    updateFilter(load_filter, load_entry.address, load_entry.width, -1);
+                    load_entry.state          = VanadisOOOLoadState::ADDRESSED;
+                    load_entry.request_count  = 0;
+                    load_entry.forwarded_from = 0;
+                    stat_load_replays->addData(1);
+                }
+            }
+        }
+    }
+
+    void popStoreFront() {
+        VanadisOOOStoreEntry& entry = stores.front();
+
+        if(inStoreFilter(entry)) {
+            updateFilter(store_filter, entry.address, entry.width, -1);
+        }
+
+        stores.pop_front();
+    }
+
+    void issueStoreFront() {
+        // stores which trapped have been marked executed already
+        while(! stores.empty() && stores.front().state == VanadisOOOStoreState::DONE) {
+            popStoreFront();
+        }
+
+        if(stores.empty()) {
+            return;
+        }
+
+        VanadisOOOStoreEntry& current_store = stores.front();
+
+        if(current_store.state != VanadisOOOStoreState::ADDRESSED) {
+            return;
+        }
+
+        VanadisStoreInstruction* store_ins = current_store.ins;
+
+        if( UNLIKELY(store_ins->checkFrontOfROB()) ) {
+            // store instruction is current front of ROB so ready to be send to memory system
+            if(LIKELY(issueStore(current_store))) {
+                output->verbose(CALL_INFO, 16, VANADIS_DBG_LSQ_STORE_FLG, "---> issued store: 0x%llx / thr: %" PRIu32 " into memory system using standard store operation\n",
+                    store_ins->getInstructionAddress(), current_store.hw_thr);
+
+                popStoreFront();
+                store_ins->markExecuted();
+                stat_stores_executed->addData(1);
+            } else {
+                output->verbose(CALL_INFO, 16, VANADIS_DBG_LSQ_STORE_FLG, "---> issued non-standard store: 0x%llx / thr: %" PRIu32 " (marked dispatch, will stall until response)\n",
+                    store_ins->getInstructionAddress(), current_store.hw_thr);
+            }
+        }
+    }
+
+    // Returns true if this was a standard store which needs no response
+    bool issueStore(VanadisOOOStoreEntry& store_entry) {
+        VanadisStoreInstruction* store_ins = store_entry.ins;
+
+        const uint64_t store_address = store_entry.address;
+        const uint64_t store_width   = store_entry.width;
+        const bool     value_is_fp   = store_ins->getValueRegisterType() == STORE_FP_REGISTER;
+        const uint16_t value_reg     = value_is_fp ? store_ins->getPhysFPRegIn(0) : store_ins->getPhysIntRegIn(1);
+        VanadisRegisterFile* reg_file = registerFiles->at(store_entry.hw_thr);
+        StandardMem::Request* store_req = nullptr;
+        std::vector<uint8_t> payload(store_width);
+
+        const bool needs_split = operationStraddlesCacheLine(store_address, store_width);
+
+        if(LIKELY(! needs_split)) {
+            reg_file->copyFromRegister(value_reg, store_ins->getRegisterOffset(), &payload[0], store_width, value_is_fp);
+        }
+
+        switch(store_ins->getTransactionType()) {
+        case MEM_TRANSACTION_NONE:
+        {
+            if(UNLIKELY(needs_split)) {
+                const uint64_t store_width_right = (store_address + store_width) % cache_line_width;
+                const uint64_t store_width_left  = store_width - store_width_right;
+                const uint64_t store_address_right = store_address + store_width_left;
+
+                assert(store_width_left > 0);
+                assert(store_width_right > 0);
+
+                output->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_STORE_FLG, "---> store-left-at: 0x%llx left-width: %" PRIu64 ", store-right-at: 0x%llx right-width: %" PRIu64 "\n",
+                    store_address, store_width_left, store_address_right, store_width_right);
+
+                payload.resize(store_width_left);
+                reg_file->copyFromRegister(value_reg, store_ins->getRegisterOffset(), &payload[0], store_width_left, value_is_fp);
+
+                store_req = new StandardMem::Write(store_address & address_mask, payload.size(), payload,
+                    false, 0, store_address, store_ins->getInstructionAddress(), store_entry.hw_thr);
+                std_stores_in_flight.insert(store_req->getID());
+                memInterface->send(store_req);
+
+                payload.resize(store_width_right);
+                reg_file->copyFromRegister(value_reg, store_ins->getRegisterOffset() + store_width_left, &payload[0], store_width_right, value_is_fp);
+
+                store_req = new StandardMem::Write(store_address_right & address_mask, payload.size(), payload,
+                    false, 0, store_address_right, store_ins->getInstructionAddress(), store_entry.hw_thr);
+                std_stores_in_flight.insert(store_req->getID());
+                memInterface->send(store_req);
+            } else {
+                output->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_STORE_FLG, "---> [memory-transaction]: standard store ins: 0x%llx store-at: 0x%llx width: %" PRIu64 "\n",
+                    store_ins->getInstructionAddress(), store_address, store_width);
+
+                store_req = new StandardMem::Write(store_address & address_mask, payload.size(), payload,
+                    false, 0, store_address, store_ins->getInstructionAddress(), store_entry.hw_thr);
+                std_stores_in_flight.insert(store_req->getID());
+                memInterface->send(store_req);
+            }
+
+            return true;
+        } break;
+        case MEM_TRANSACTION_LLSC_LOAD:
+        {
+            output->fatal(CALL_INFO, -1, "Error - attempted to issue a LLSC-load via store instruction. Invalid operation.\n");
+        } break;
+        case MEM_TRANSACTION_LLSC_STORE:
+        {
+            if(UNLIKELY(needs_split)) {
+                output->fatal(CALL_INFO, -1, "Error - attempted to perform an LLSC-store over a split-cache line. This is not permitted.\n");
+            }
+
+            output->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_STORE_FLG, "---> [memory-transaction]: LLSC-store store-at: 0x%llx width: %" PRIu64 "\n",
+                store_address, store_width);
+
+            store_req = new StandardMem::StoreConditional(store_address & address_mask, payload.size(), payload,
+                        0, store_address, store_ins->getInstructionAddress(), store_entry.hw_thr);
+        } break;
+        case MEM_TRANSACTION_LOCK:
+        {
+            if(UNLIKELY(needs_split)) {
+                output->fatal(CALL_INFO, -1, "Error - attempted to perform an LOCK-store over a split-cache line. This is not permitted.\n");
+            }
+
+            output->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_STORE_FLG, "---> [memory-transaction]: LOCK-store store-at: 0x%llx width: %" PRIu64 "\n",
+                store_address, store_width);
+
+            store_req = new StandardMem::WriteUnlock(store_address & address_mask, payload.size(), payload,
+                        0, store_address, store_ins->getInstructionAddress(), store_entry.hw_thr);
+        } break;
+        }
+
+        // equivalent to a seg-fault for the store
+        if(store_address < 4096) {
+            store_ins->flagError();
+        }
+
+        store_entry.request = store_req->getID();
+        store_entry.state   = VanadisOOOStoreState::DISPATCHED;
+        memInterface->send(store_req);
+
+        return false;
+    }
+
+    // Loads -------------------------------------------------------------------
+
+    // Returns true if the load has a valid address
+    bool computeLoadAddress(VanadisOOOLoadEntry& entry) {
+        VanadisLoadInstruction* load_ins = entry.ins;
+
+        uint64_t load_address = 0;
+        uint16_t load_width   = 0;
+
+        load_ins->computeLoadAddress(output, registerFiles->at(entry.hw_thr), &load_address, &load_width);
+
+        if(UNLIKELY(load_ins->trapsError())) {
+            output->verbose(CALL_INFO, 16, 0, "---> load ins: 0x%llx / thr: %" PRIu32 " traps error, will not process and allow pipeline to handle.\n",
+                load_ins->getInstructionAddress(), entry.hw_thr);
+            entry.state = VanadisOOOLoadState::DONE;
+            return false;
+        }
+
+        output->verbose(CALL_INFO, 16, 0, "---> load ins: 0x%llx / thr: %" PRIu32 " want load at 0x%llx / width: %" PRIu16 "\n",
+            load_ins->getInstructionAddress(), entry.hw_thr, load_address, load_width);
+
+        entry.address = load_address;
+        entry.width   = load_width;
+        entry.state   = VanadisOOOLoadState::ADDRESSED;
+        return true;
+    }
+
+    // Returns true if the load issued to memory or took its data from a store
+    bool attemptLoad(VanadisOOOLoadEntry& entry) {
+        if(blockedByFence(entry)) {
+            return false;
+        }
+
+        if(entry.ins->getTransactionType() != MEM_TRANSACTION_NONE) {
+            // atomics are not reordered with any older store
+            if(olderStore(entry, false)) {
+                return false;
+            }
+
+            issueLoad(entry);
+            return true;
+        }
+
+        if(filterHit(store_filter, entry.address, entry.width)) {
+            // the youngest older store which overlaps supplies the data
+            for(size_t i = stores.size(); i > 0; --i) {
+                VanadisOOOStoreEntry& store_entry = stores.at(i - 1);
+
+                if(store_entry.seq > entry.seq || store_entry.hw_thr != entry.hw_thr || ! inStoreFilter(store_entry) ||
+                    ! store_entry.overlaps(entry.address, entry.width)) {
+                    continue;
+                }
+
+                if(canForward(store_entry, entry)) {
+                    forwardLoad(store_entry, entry);
+                    return true;
+                }
+
+                output->verbose(CALL_INFO, 16, 0, "---> load ins: 0x%llx / thr: %" PRIu32 " partially overlaps store ins: 0x%llx, waits for the store to drain\n",
+                    entry.ins->getInstructionAddress(), entry.hw_thr, store_entry.ins->getInstructionAddress());
+                return false;
+            }
+        }
+
+        const bool speculates = olderStore(entry, true);
+
+        if(speculates) {
+            if(! speculative_loads) {
+                return false;
+            }
+
+            stat_loads_speculated->addData(1);
+        }
+
+        issueLoad(entry);
+        return true;
+    }
+
+    bool canForward(const VanadisOOOStoreEntry& store_entry, const VanadisOOOLoadEntry& load_entry) {
+        return store_entry.state == VanadisOOOStoreState::ADDRESSED &&
+            store_entry.ins->getTransactionType() == MEM_TRANSACTION_NONE &&
+            ! store_entry.ins->isPartialStore() &&
+            store_entry.covers(load_entry.address, load_entry.width);
+    }
+
+    void forwardLoad(VanadisOOOStoreEntry& store_entry, VanadisOOOLoadEntry& load_entry) {
+        VanadisStoreInstruction* store_ins = store_entry.ins;
+        const bool value_is_fp = store_ins->getValueRegisterType() == STORE_FP_REGISTER;
+        std::vector<uint8_t> data(load_entry.width);
+
+        registerFiles->at(store_entry.hw_thr)->copyFromRegister(
+            value_is_fp ? store_ins->getPhysFPRegIn(0) : store_ins->getPhysIntRegIn(1),
+            store_ins->getRegisterOffset() + (load_entry.address - store_entry.address),
+            &data[0], load_entry.width, value_is_fp);
+
+        output->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_LOAD_FLG, "---> forward store ins: 0x%llx -> load ins: 0x%llx / thr: %" PRIu32 " addr: 0x%llx width: %" PRIu16 "\n",
+            store_ins->getInstructionAddress(), load_entry.ins->getInstructionAddress(), load_entry.hw_thr,
+            load_entry.address, load_entry.width);
+
+        writeLoadData(load_entry, load_entry.address, &data[0], load_entry.width);
+
+        load_entry.forwarded_from = store_entry.seq;
+        updateFilter(load_filter, load_entry.address, load_entry.width, 1);
+        completeLoad(load_entry);
+        markLoadExecuted(load_entry);
+
+        stat_loads_forwarded->addData(1);
+    }
+
+    void issueLoad(VanadisOOOLoadEntry& load_entry) {
+        VanadisLoadInstruction* load_ins = load_entry.ins;
+        const uint64_t load_address = load_entry.address;
+        const uint64_t load_width   = load_entry.width;
+        StandardMem::Request* load_req = nullptr;
+
+        // do we need to perform a split load (which loads from two cache lines)?
+        const bool needs_split = operationStraddlesCacheLine(load_address, load_width);
+
+        load_entry.request_count  = 0;
+        load_entry.forwarded_from = 0;
+
+        switch (load_ins->getTransactionType()) {
+            case MEM_TRANSACTION_NONE:
+            {
+                if(UNLIKELY(needs_split)) {
+                    // How many bytes are in the left most line?
+                    const uint64_t load_width_right = (load_address + load_width) % cache_line_width;
+                    const uint64_t load_width_left = load_width - load_width_right;
+
+                    assert(load_width_right > 0);
+                    assert(load_width_left > 0);
+
+                    output->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_LOAD_FLG, "---> split load at-left: 0x%llx left-width: %" PRIu64 " / at-right: 0x%llx right-width: %" PRIu64 "\n",
+                        load_address, load_width_left, load_address + load_width_left, load_width_right);
+
+                    load_req = new StandardMem::Read(load_address & address_mask, load_width_left, 0,
+                        load_address, load_ins->getInstructionAddress(), load_entry.hw_thr);
+
+                    load_entry.requests[load_entry.request_count++] = load_req->getID();
+                    memInterface->send(load_req);
+
+                    load_req = new StandardMem::Read((load_address + load_width_left) & address_mask, load_width_right, 0,
+                        load_address + load_width_left, load_ins->getInstructionAddress(), load_entry.hw_thr);
+                } else if(UNLIKELY(0 == (load_address & address_mask))) {
+                    output->verbose(CALL_INFO, 16, 0, "---> address resolves to zero, flag as error and do not generate event.\n");
+                    load_ins->flagError();
+                } else {
+                    output->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_LOAD_FLG, "---> [memory-transaction]: standard load (not split) load-at: 0x%llx width: %" PRIu64 "\n",
+                        load_address, load_width);
+
+                    load_req = new StandardMem::Read(load_address & address_mask, load_width, 0,
+                        load_address, load_ins->getInstructionAddress(), load_entry.hw_thr);
+                }
+            } break;
+            case MEM_TRANSACTION_LLSC_LOAD:
+            {
+                if(UNLIKELY(needs_split)) {
+                    output->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_LOAD_FLG, "---> load is marked LLSC but it requires a cache line split, generates an error\n");
+                    load_ins->flagError();
+                } else {
+                    load_req = new StandardMem::LoadLink(load_address & address_mask, load_width, 0,
+                                        load_address, load_ins->getInstructionAddress(), load_entry.hw_thr);
+                }
+            } break;
+            case MEM_TRANSACTION_LLSC_STORE:
+            {
+                output->fatal(CALL_INFO, -1,
+                    "Error - logical error, LOAD instruction is marked with "
+                    "an LLSC STORE transaction class.\n");
+            } break;
+            case MEM_TRANSACTION_LOCK:
+            {
+                if(UNLIKELY(needs_split)) {
+                    output->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_LOAD_FLG, "---> load is marked LOCK but it requires a cache line split, this generates an error\n");
+                    load_ins->flagError();
+                } else {
+                    load_req = new StandardMem::ReadLock(load_address & address_mask, load_width, 0,
+                                        load_address, load_ins->getInstructionAddress(), load_entry.hw_thr);
+                }
+            } break;
+        }
+
+        // if the instruction traps an error the pipeline handles it at the front of the ROB
+        if(UNLIKELY(load_ins->trapsError())) {
+            load_entry.state = VanadisOOOLoadState::DONE;
+            return;
+        }
+
+        assert(load_req != nullptr);
+
+        load_entry.requests[load_entry.request_count++] = load_req->getID();
+        load_entry.state = VanadisOOOLoadState::ISSUED;
+        updateFilter(load_filter, load_entry.address, load_entry.width, 1);
+        memInterface->send(load_req);
+    }
+
+    // Copies data read from address into the load's target register
+    void writeLoadData(VanadisOOOLoadEntry& load_entry, const uint64_t address, uint8_t* data, const uint64_t size) {
+        VanadisLoadInstruction* load_ins = load_entry.ins;
+        VanadisRegisterFile* reg_file = registerFiles->at(load_entry.hw_thr);
+        const uint64_t offset = load_ins->getRegisterOffset() + (address - load_entry.address);
+
+        switch(load_ins->getValueRegisterType()) {
+        case LOAD_INT_REGISTER:
+        {
+            const uint16_t target_reg = load_ins->getPhysIntRegOut(0);
+
+            if(target_reg != load_ins->getISAOptions()->getRegisterIgnoreWrites()) {
+                assert((offset + size) <= reg_file->getIntRegWidth());
+                reg_file->copyToIntRegister(target_reg, offset, data, size);
+            }
+        } break;
+        case LOAD_FP_REGISTER:
+        {
+            assert((offset + size) <= reg_file->getFPRegWidth());
+            reg_file->copyToFPRegister(load_ins->getPhysFPRegOut(0), offset, data, size);
+        } break;
+        default:
+            output->fatal(CALL_INFO, -1, "Unknown register type.\n");
+        }
+    }
+
+    // All the data for the load is in its register, extend it to the full
+    // register width
+    void completeLoad(VanadisOOOLoadEntry& load_entry) {
+        VanadisLoadInstruction* load_ins = load_entry.ins;
+        VanadisRegisterFile* reg_file = registerFiles->at(load_entry.hw_thr);
+        const uint64_t end = load_ins->getRegisterOffset() + load_entry.width;
+
+        switch(load_ins->getValueRegisterType()) {
+        case LOAD_INT_REGISTER:
+        {
+            const uint16_t target_reg = load_ins->getPhysIntRegOut(0);
+
+            if(target_reg != load_ins->getISAOptions()->getRegisterIgnoreWrites()) {
+                const uint32_t reg_width = reg_file->getIntRegWidth();
+                std::vector<uint8_t> register_value(reg_width);
+                reg_file->copyFromIntRegister(target_reg, 0, &register_value[0], reg_width);
+
+                uint8_t fill = 0x00;
+                if(load_ins->performSignExtension() && end > 0 && (register_value[end - 1] & 0x80) != 0) {
+                    fill = 0xFF;
+                }
+
+                for(auto i = end; i < reg_width; ++i) {
+                    register_value[i] = fill;
+                }
+
+                reg_file->copyToIntRegister(target_reg, 0, &register_value[0], reg_width);
+            }
+        } break;
+        case LOAD_FP_REGISTER:
+        {
+            const uint32_t reg_width = reg_file->getFPRegWidth();
+            std::vector<uint8_t> zeros(reg_width, 0);
+
+            if(end < reg_width) {
+                reg_file->copyToFPRegister(load_ins->getPhysFPRegOut(0), end, &zeros[0], reg_width - end);
+            }
+        } break;
+        default:
+            output->fatal(CALL_INFO, -1, "Unknown register type.\n");
+        }
+
+        load_entry.state = VanadisOOOLoadState::COMPLETE;
+    }
+
+    // A complete load is only marked executed once no older store can still
+    // turn out to overlap it, until then it can be replayed
+    void markLoadExecuted(VanadisOOOLoadEntry& load_entry) {
+        if(olderStore(load_entry, true)) {
+            return;
+        }
+
+        output->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_LOAD_FLG,
+            "---> LSQ Execute: %s (0x%llx / thr: %" PRIu32 ") load data instruction marked executed.\n",
+            load_entry.ins->getInstCode(), load_entry.ins->getInstructionAddress(), load_entry.hw_thr);
+
+        updateFilter(load_filter, load_entry.address, load_entry.width, -1);
+        load_entry.ins->markExecuted();
+        load_entry.ins   = nullptr;
+        load_entry.state = VanadisOOOLoadState::DONE;
+        stat_loads_executed->addData(1);
+    }
+
+    void retireLoads() {
+        while(! loads.empty() && loads.front().state == VanadisOOOLoadState::DONE) {
+            loads.pop_front();
+        }
+    }
+
+    size_t countLoadsInFlight() {
+        size_t in_flight = 0;
+
+        for(size_t i = 0; i < loads.size(); ++i) {
+            if(loads.at(i).state == VanadisOOOLoadState::ISSUED) {
+                in_flight++;
+            }
+        }
+
+        return in_flight;
+    }
+
+    // Is there a store older than the load in the same thread, either any
+    // store or only one whose address is still unknown
+    bool olderStore(const VanadisOOOLoadEntry& load_entry, const bool unaddressed_only) {
+        for(size_t i = 0; i < stores.size(); ++i) {
+            const VanadisOOOStoreEntry& store_entry = stores.at(i);
+
+            if(store_entry.seq > load_entry.seq) {
+                break;
+            }
+
+            if(store_entry.hw_thr != load_entry.hw_thr || store_entry.state == VanadisOOOStoreState::DONE) {
+                continue;
+            }
+
+            if(! unaddressed_only || store_entry.state == VanadisOOOStoreState::WAITING) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Fences ------------------------------------------------------------------
+
+    bool blockedByFence(const VanadisOOOLoadEntry& load_entry) const {
+        for(auto& fence : fences) {
+            if(fence.seq > load_entry.seq) {
+                break;
+            }
+
+            if(fence.hw_thr == load_entry.hw_thr) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void processFences() {
+        std::set<uint32_t> threads_blocked;
+
+        for(auto fence_itr = fences.begin(); fence_itr != fences.end(); ) {
+            VanadisFenceInstruction* fence_ins = fence_itr->ins;
+
+            // fences of a thread execute in order
+            if(threads_blocked.count(fence_itr->hw_thr) != 0 || ! fence_ins->completedIssue()) {
+                threads_blocked.insert(fence_itr->hw_thr);
+                ++fence_itr;
+                continue;
+            }
+
+            bool can_execute = true;
+
+            if(fence_ins->createsLoadFence()) {
+                for(size_t i = 0; i < loads.size() && can_execute; ++i) {
+                    const VanadisOOOLoadEntry& load_entry = loads.at(i);
+
+                    if(load_entry.seq > fence_itr->seq) {
+                        break;
+                    }
+
+                    can_execute = load_entry.hw_thr != fence_itr->hw_thr || load_entry.state == VanadisOOOLoadState::DONE;
+                }
+            }
+
+            if(fence_ins->createsStoreFence()) {
+                // stores are fenced if there are no pending stores AND all issued to the memory system
+                // have returned so are currently visible.
+                for(size_t i = 0; i < stores.size() && can_execute; ++i) {
+                    const VanadisOOOStoreEntry& store_entry = stores.at(i);
+
+                    if(store_entry.seq > fence_itr->seq) {
+                        break;
+                    }
+
+                    can_execute = store_entry.hw_thr != fence_itr->hw_thr || store_entry.state == VanadisOOOStoreState::DONE;
+                }
+
+                can_execute = can_execute && std_stores_in_flight.empty();
+            }
+
+            if(can_execute) {
+                output->verbose(CALL_INFO, 16, 0, "-> execute fence instruction (0x%llx), all checks have passed.\n",
+                    fence_ins->getInstructionAddress());
+                fence_ins->markExecuted();
+                stat_fences_executed->addData(1);
+                fence_itr = fences.erase(fence_itr);
+            } else {
+                threads_blocked.insert(fence_itr->hw_thr);
+                ++fence_itr;
+            }
+        }
+    }
+
+    bool operationStraddlesCacheLine(uint64_t address, uint64_t width) const {
+        const uint64_t cache_line_left  = (address / cache_line_width);
+        const uint64_t cache_line_right = ((address + width - 1) / cache_line_width);
+
+        return cache_line_left != cache_line_right;
+    }
+
+    static const char* getLoadStateName(const VanadisOOOLoadState state) {
+        switch(state) {
+        case VanadisOOOLoadState::WAITING:   return "WAITING";
+        case VanadisOOOLoadState::ADDRESSED: return "ADDRESSED";
+        case VanadisOOOLoadState::ISSUED:    return "ISSUED";
+        case VanadisOOOLoadState::COMPLETE:  return "COMPLETE";
+        case VanadisOOOLoadState::DONE:      return "DONE";
+        }
+        return "UNKNOWN";
+    }
+
+    static const char* getStoreStateName(const VanadisOOOStoreState state) {
+        switch(state) {
+        case VanadisOOOStoreState::WAITING:    return "WAITING";
+        case VanadisOOOStoreState::ADDRESSED:  return "ADDRESSED";
+        case VanadisOOOStoreState::DISPATCHED: return "DISPATCHED";
+        case VanadisOOOStoreState::DONE:       return "DONE";
+        }
+        return "UNKNOWN";
+    }
+
+    const size_t max_stores;
+    const size_t max_loads;
+
+    const uint32_t max_issue_attempts_per_cycle;
+    const bool speculative_loads;
+
+    VanadisLSQRing<VanadisOOOLoadEntry> loads;
+    VanadisLSQRing<VanadisOOOStoreEntry> stores;
+    std::deque<VanadisOOOFenceEntry> fences;
+    std::set<StandardMem::Request::id_t> std_stores_in_flight;
+
+    // program order of every load, store and fence pushed
+    uint64_t next_seq;
+
+    // Number of addressed stores and of issued loads touching each 8-byte
+    // granule (hashed), a zero means nothing in that queue can overlap
+    uint16_t store_filter[filter_size];
+    uint16_t load_filter[filter_size];
+
+    StandardMem* memInterface;
+    StandardMemHandlers* std_mem_handlers;
+
+    uint64_t cache_line_width;
+
+    Statistic<uint64_t>* stat_store_buffer_entries;
+    Statistic<uint64_t>* stat_stores_pending;
+    Statistic<uint64_t>* stat_loads_pending;
+    Statistic<uint64_t>* stat_stores_issued;
+    Statistic<uint64_t>* stat_loads_issued;
+    Statistic<uint64_t>* stat_fences_issued;
+    Statistic<uint64_t>* stat_stores_executed;
+    Statistic<uint64_t>* stat_loads_executed;
+    Statistic<uint64_t>* stat_fences_executed;
+    Statistic<uint64_t>* stat_stored_bytes;
+    Statistic<uint64_t>* stat_loaded_bytes;
+    Statistic<uint64_t>* stat_loads_forwarded;
+    Statistic<uint64_t>* stat_loads_speculated;
+    Statistic<uint64_t>* stat_load_replays;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
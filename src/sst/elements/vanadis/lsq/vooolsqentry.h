@@ -0,0 +1,181 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_OOO_LSQ_ENTRY
+#define _H_VANADIS_OOO_LSQ_ENTRY
+
+#include <sst/core/interfaces/stdMem.h>
+
+#include "inst/vfence.h"
+#include "inst/vload.h"
+#include "inst/vstore.h"
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+// Fixed capacity ring of entries held by value, oldest entry at index 0.
+// Entries are only ever allocated once when the ring is constructed.
+template <typename T>
+class VanadisLSQRing {
+public:
+    VanadisLSQRing(const size_t size) : entries(size), head(0), count(0) {}
+
+    bool   empty() const { return 0 == count; }
+    bool   full() const { return entries.size() == count; }
+    size_t size() const { return count; }
+    size_t capacity() const { return entries.size(); }
+
+    T& at(const size_t index) {
+        assert(index < count);
+        return entries[(head + index) % entries.size()];
+    }
+
+    T& front() { return at(0); }
+
+    T& push_back() {
+        assert(count < entries.size());
+        T& entry = entries[(head + count) % entries.size()];
+        count++;
+        return entry;
+    }
+
+    void pop_front() {
+        assert(count > 0);
+        head = (head + 1) % entries.size();
+        count--;
+    }
+
+    // Removes every entry the predicate matches, keeping the rest in order
+    template <typename P>
+    void removeIf(P pred) {
+        size_t kept = 0;
+
+        for(size_t i = 0; i < count; ++i) {
+            T& entry = at(i);
+
+            if(! pred(entry)) {
+                if(kept != i) {
+                    entries[(head + kept) % entries.size()] = entry;
+                }
+                kept++;
+            }
+        }
+
+        count = kept;
+    }
+
+protected:
+    std::vector<T> entries;
+    size_t head;
+    size_t count;
+};
+
+enum class VanadisOOOLoadState {
+    WAITING,    // operands not ready, address unknown
+    ADDRESSED,  // address known, not yet issued
+    ISSUED,     // requests outstanding in the memory system
+    COMPLETE,   // register written, waiting for older stores to resolve
+    DONE        // marked executed (or trapped), waiting to leave the ring
+};
+
+enum class VanadisOOOStoreState {
+    WAITING,    // operands not ready, address unknown
+    ADDRESSED,  // address known, waiting to be front of ROB
+    DISPATCHED, // LLSC/LOCK store sent, waiting for the response
+    DONE        // trapped, waiting to leave the ring
+};
+
+static inline bool vanadisOverlaps(const uint64_t a_addr, const uint64_t a_width,
+    const uint64_t b_addr, const uint64_t b_width) {
+    return (a_addr < (b_addr + b_width)) && (b_addr < (a_addr + a_width));
+}
+
+struct VanadisOOOLoadEntry {
+    VanadisLoadInstruction* ins;
+    uint64_t seq;
+    uint32_t hw_thr;
+    VanadisOOOLoadState state;
+
+    uint64_t address;
+    uint16_t width;
+
+    // sequence number of the store this load took its data from, 0 if it
+    // was read from memory
+    uint64_t forwarded_from;
+
+    // a load split over two cache lines has two requests
+    SST::Interfaces::StandardMem::Request::id_t requests[2];
+    uint8_t request_count;
+
+    bool overlaps(const uint64_t addr, const uint64_t w) const {
+        return vanadisOverlaps(address, width, addr, w);
+    }
+
+    bool containsRequest(const SST::Interfaces::StandardMem::Request::id_t req) const {
+        for(uint8_t i = 0; i < request_count; ++i) {
+            if(requests[i] == req) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void removeRequest(const SST::Interfaces::StandardMem::Request::id_t req) {
+        for(uint8_t i = 0; i < request_count; ++i) {
+            if(requests[i] == req) {
+                requests[i] = requests[request_count - 1];
+                request_count--;
+                break;
+            }
+        }
+    }
+};
+
+struct VanadisOOOStoreEntry {
+    VanadisStoreInstruction* ins;
+    uint64_t seq;
+    uint32_t hw_thr;
+    VanadisOOOStoreState state;
+
+    uint64_t address;
+    uint16_t width;
+
+    // only used by LLSC/LOCK stores which wait for a response
+    SST::Interfaces::StandardMem::Request::id_t request;
+
+    bool overlaps(const uint64_t addr, const uint64_t w) const {
+        return vanadisOverlaps(address, width, addr, w);
+    }
+
+    bool covers(const uint64_t addr, const uint64_t w) const {
+        return (address <= addr) && ((addr + w) <= (address + width));
+    }
+};
+
+struct VanadisOOOFenceEntry {
+    VanadisFenceInstruction* ins;
+    uint64_t seq;
+    uint32_t hw_thr;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
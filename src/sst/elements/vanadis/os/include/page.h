@@ -36,8 +36,8 @@ namespace OS {
 class Page {
   public:
     Page( PhysMemManager* mem ) : mem(mem), refCnt(1) {
-        ppn = mem->allocPage( PhysMemManager::PageSize::FourKB ); 
-        PageDbg("ppn=%d\n",ppn);
+        ppn = mem->allocPage( PhysMemManager::PageSize::FourKB, neverUsed ); 
+        PageDbg("ppn=%d neverUsed=%d\n",ppn,neverUsed);
     }
     ~Page() {
         PageDbg("ppn=%d\n",ppn);
@@ -53,6 +53,11 @@ class Page {
         return ppn;
     }
 
+    // true if no one has used this physical page since the simulation started
+    bool isNeverUsed() {
+        return neverUsed;
+    }
+
     void incRefCnt() { 
         ++refCnt; 
         PageDbg("ppn=%d refCnt=%d\n",ppn,refCnt);
@@ -68,6 +73,7 @@ class Page {
     PhysMemManager* mem;
     unsigned refCnt; 
     unsigned ppn;
+    bool neverUsed;
 };
 
 }
@@ -198,15 +198,15 @@ class ProcessInfo {
         return m_futex->getNumWaiters( addr );
     }
 
-    void mapVirtToPage( unsigned vpn, OS::Page* page ) {
-        m_dbg.verbose(CALL_INFO,1,0,"vpn=%d ppn=%d virtAddr=%#" PRIx64 "\n", vpn, page->getPPN(), (uint64_t) vpn << m_pageShift );
+    void mapVirtToPage( uint64_t vpn, OS::Page* page ) {
+        m_dbg.verbose(CALL_INFO,1,0,"vpn=%" PRIu64 " ppn=%d virtAddr=%#" PRIx64 "\n", vpn, page->getPPN(), vpn << m_pageShift );
         auto region = findMemRegion( vpn << m_pageShift );
         assert( region );
         region->mapVirtToPhys( vpn, page );
     }
 
     uint64_t virtToPhys( uint64_t virtAddr) {
-        uint32_t vpn = virtAddr >> m_pageShift;
+        uint64_t vpn = virtAddr >> m_pageShift;
 
         auto region = findMemRegion(virtAddr);
         if ( nullptr == region ) {
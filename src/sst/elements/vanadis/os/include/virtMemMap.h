@@ -75,9 +75,9 @@ struct MemoryRegion {
         }
     }
 
-    void mapVirtToPhys( unsigned vpn, OS::Page* page ) {
+    void mapVirtToPhys( uint64_t vpn, OS::Page* page ) {
         OS::Page* ret = nullptr;
-        MemoryRegionDbg("vpn=%d ppn=%d refCnt=%d\n", vpn, page->getPPN(),page->getRefCnt());
+        MemoryRegionDbg("vpn=%" PRIu64 " ppn=%d refCnt=%d\n", vpn, page->getPPN(),page->getRefCnt());
         if( m_virtToPhysMap.find(vpn) != m_virtToPhysMap.end() ) {
             auto* tmp = m_virtToPhysMap[vpn];
             MemoryRegionDbg("decRef ppn=%d refCnt=%d\n", tmp->getPPN(),tmp->getRefCnt()-1);
@@ -113,7 +113,7 @@ struct MemoryRegion {
     MemoryBacking* backing; 
 
   private:
-    std::map<unsigned, OS::Page* > m_virtToPhysMap;
+    std::map<uint64_t, OS::Page* > m_virtToPhysMap;
 };
 
 
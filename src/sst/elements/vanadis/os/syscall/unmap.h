@@ -32,15 +32,18 @@ public:
 
         m_output->verbose(CALL_INFO, 16, 0, "[syscall-unmap] addr=%#" PRIx64 " lenght=%" PRIu64 "\n",address, length);
 
+        uint64_t vpn = address >> m_os->getPageShift();
+        size_t numPages = length/m_os->getPageSize();
+
         auto threads = process->getThreadList();
         for ( const auto iter : threads) {
             auto thread = iter.second;
             if ( thread ) {
-                m_os->getMMU()->flushTlb( thread->getCore(), thread->getHwThread() );
+                m_os->getMMU()->flushTlb( thread->getCore(), thread->getHwThread(), vpn, numPages );
             }
         } 
 
-        m_os->getMMU()->unmap( process->getpid(), address >> m_os->getPageShift(), length/m_os->getPageSize() );
+        m_os->getMMU()->unmap( process->getpid(), vpn, numPages );
 
         int ret = process->unmap( address, length );
         if ( ret ) {
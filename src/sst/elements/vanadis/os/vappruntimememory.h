@@ -21,6 +21,7 @@
 #include <unistd.h>
 #include <string>
 #include "sst/core/interfaces/stdMem.h"
+#include "sst/core/output.h"
 #include <sst/core/module.h>
 #include <sst/core/rng/xorshift.h>
 
@@ -32,7 +33,6 @@
 
 #include "sst/elements/mmu/mmu.h"
 #include "os/vphysmemmanager.h"
-#include "os/vloadpage.h"
 #include "os/include/process.h"
 
 namespace SST {
@@ -456,9 +456,6 @@ uint64_t AppRuntimeMemory<Type>::configureStack(  Output* output, int page_size,
     size_t  phdrRegionStop = phdr_address + phdr_data_block.size();  
     // setup a VM memory region for this process
     processInfo->addMemRegion( "phdr", phdr_address, phdrRegionStop - phdr_address, 0x4  );
-
-    // write contents to memory 
-    loadPages( output, mem_if, mmu, memMgr, processInfo->getPid(), phdr_address, phdr_data_block, 0x4, page_size );
 #endif // PHDR
 
     // get a page aligned base of the stack 
@@ -477,8 +474,6 @@ uint64_t AppRuntimeMemory<Type>::configureStack(  Output* output, int page_size,
     output->verbose( CALL_INFO, 16, 0, "stack_address=%#" PRIx64 " aligned_stack_address=%#" PRIx64 " length=%zu\n",
                                                         start_stack_address, page_aligned_stack_addr, stack_data.size());
 
-    loadPages( output, mem_if, mmu, memMgr, processInfo->getPid(), page_aligned_stack_addr, stack_data, 0x6, page_size );
-
     processInfo->printRegions("after app runtime setup");
 #endif
     // Set up the stack pointer
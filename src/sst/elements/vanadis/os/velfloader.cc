@@ -18,111 +18,27 @@
 #include <string>
 #include <math.h>
 #include "os/velfloader.h"
-#include "os/vloadpage.h"
 #include "os/vosDbgFlags.h"
 
 namespace SST {
 namespace Vanadis {
 
-static size_t roundDown( size_t num, size_t step ) {
-    return num & ~( step - 1 );
-}
-
-static size_t roundUp( size_t num, size_t step ) {
-    if ( num & ( step - 1 ) ) {
-        return roundDown( num, step) + step;
-    } else {
-        return num;
-    }
-}
-
-void loadElfFile( Output* output, Interfaces::StandardMem* mem_if, MMU_Lib::MMU* mmu,  PhysMemManager* memMgr, VanadisELFInfo* elf_info, int hwThread,
-        int page_size, OS::ProcessInfo* processInfo ) 
-{
-    // we are not using this for loads for the elf is faulted in, but could use it for a system without virtual memory 
-    // so leave it here but fault, it will need to be verified when used
-    assert(0);
-    uint64_t initial_brk = 0;
-
-    auto path = elf_info->getBinaryPath(); 
-    output->verbose( CALL_INFO, 2, 0, "-> Loading %s, to locate program secs ...\n", path);
-    FILE* exec_file = fopen(path, "rb");
-
+uint8_t* readElfPage( Output* output, VanadisELFInfo* elf_info, uint64_t vpn, int page_size ) {
+    auto path = elf_info->getBinaryPath();
+    output->verbose( CALL_INFO, 2, VANADIS_OS_DBG_READ_ELF, "-> Loading %s, to locate program sections ...\n", path);
+    FILE* exec_file = fopen(elf_info->getBinaryPath(), "rb");
     if ( nullptr == exec_file ) {
-        output->fatal(CALL_INFO, -1, "Error: unable to open %s\n", path );
-    }
-
-    output->verbose(CALL_INFO, 2, 0, "-> populating memory contents with info from the executable...\n");
-
-    for ( size_t i = 0; i < elf_info->countProgramHeaders(); ++i ) {
-
-        const VanadisELFProgramHeaderEntry* hdr = elf_info->getProgramHeader(i);
-        if ( PROG_HEADER_LOAD == hdr->getHeaderType() ) {
-            uint64_t virtAddr = hdr->getVirtualMemoryStart(); 
-            size_t   memLen = hdr->getHeaderMemoryLength();
-            size_t   imageLen = hdr->getHeaderImageLength();
-            uint64_t flags = hdr->getSegmentFlags();
-
-            fseek(exec_file, hdr->getImageOffset(), SEEK_SET); 
-
-            uint64_t virtAddrPage = roundDown( virtAddr, page_size ); 
-            uint64_t virtAddrEnd = roundUp(virtAddr + memLen, page_size );
-            size_t numBytes = page_size - (virtAddr - virtAddrPage); 
-            size_t imageOffset = 0;
-
-            output->verbose( CALL_INFO, 2, 0,"ELF virtAddrStart=%#" PRIx64 " memLen=%zu imageLen=%zu flags=%#" PRIx64 "\n",virtAddr, memLen, imageLen, flags );
-            output->verbose( CALL_INFO, 2, 0,"page aligned virtual address region: %#" PRIx64 " - %#" PRIx64 "\n", virtAddrPage, virtAddrEnd );
-            std::string name;
-            if ( elf_info->getEntryPoint() >= virtAddrPage && elf_info->getEntryPoint() < virtAddrEnd ) {
-                name = "text";
-            }else{
-                name = "data";
-            }
-            processInfo->addMemRegion( name, virtAddrPage, virtAddrEnd-virtAddrPage, flags );
-
-            while( virtAddrPage < virtAddrEnd ) {
-                std::vector<uint8_t> buffer(page_size,0);
-
-                if ( imageOffset < imageLen ) {
-                    if ( numBytes > imageLen - imageOffset ) {
-                        numBytes = imageLen - imageOffset;
-                    }
-                    size_t pageOffset = (virtAddr + imageOffset) - virtAddrPage;
-                    fread( buffer.data() + pageOffset, numBytes, 1, exec_file);
-                    imageOffset += numBytes;
-                    output->verbose( CALL_INFO, 2, 0,"write page, pageVirtAddr=%#" PRIx64 " imageOffset=%zu pageOffset=%zu numBytes=%zu\n",
-                        virtAddrPage,imageOffset,pageOffset,numBytes); 
-                } 
-
-                loadPages( output, mem_if, mmu, memMgr, processInfo->getpid(), virtAddrPage, buffer, flags, page_size );
-
-                virtAddrPage += page_size;
-                numBytes = page_size;
-            }
-            if ( virtAddrEnd > initial_brk ) {
-                initial_brk = virtAddrEnd;
-            }
-        }
+        output->fatal(CALL_INFO, -1, "Error: unable to open %s\n", path);
     }
-
+    uint8_t* data = readElfPage( output, elf_info, vpn, page_size, exec_file );
     fclose(exec_file);
-
-    output->verbose( CALL_INFO, 2, 0,
-                    ">> Setting initial break point to image size in "
-                    "memory ( brk: 0x%llx )\n",
-                    initial_brk);
-    processInfo->initBrk( initial_brk );
+    return data;
 }
 
-uint8_t* readElfPage( Output* output, VanadisELFInfo* elf_info, int vpn, int page_size ) {
+uint8_t* readElfPage( Output* output, VanadisELFInfo* elf_info, uint64_t vpn, int page_size, FILE* exec_file ) {
     uint64_t virtAddr = vpn<<12;  
     auto path = elf_info->getBinaryPath();
-    output->verbose( CALL_INFO, 2, VANADIS_OS_DBG_READ_ELF, "-> Loading %s, to locate program sections ...\n", path);
-    output->verbose( CALL_INFO, 2, VANADIS_OS_DBG_READ_ELF,"%s vpn=%d addr=%#" PRIx64 " page_size=%d\n",path,vpn,virtAddr,page_size);
-    FILE* exec_file = fopen(elf_info->getBinaryPath(), "rb");
-    if ( nullptr == exec_file ) {
-        output->fatal(CALL_INFO, -1, "Error: unable to open %s\n", path);
-    }
+    output->verbose( CALL_INFO, 2, VANADIS_OS_DBG_READ_ELF,"%s vpn=%" PRIu64 " addr=%#" PRIx64 " page_size=%d\n",path,vpn,virtAddr,page_size);
     uint8_t* data = new uint8_t[page_size];
     bzero(data, page_size); 
     const VanadisELFProgramHeaderEntry* secHdr = elf_info->findProgramHeader( virtAddr );
@@ -163,7 +79,6 @@ uint8_t* readElfPage( Output* output, VanadisELFInfo* elf_info, int vpn, int pag
         fread( data + dataOffset, numBytes, 1, exec_file);
     }
 
-    fclose(exec_file);
     return data; 
 }
 
@@ -25,8 +25,9 @@
 namespace SST {
 namespace Vanadis {
 
-void loadElfFile( Output*, Interfaces::StandardMem*, MMU_Lib::MMU*, PhysMemManager*, VanadisELFInfo*, int hwThread, int page_size, OS::ProcessInfo* );
-uint8_t* readElfPage( Output*, VanadisELFInfo*, int vpn, int page_size );
+uint8_t* readElfPage( Output*, VanadisELFInfo*, uint64_t vpn, int page_size );
+// same as above, reading from an already open executable
+uint8_t* readElfPage( Output*, VanadisELFInfo*, uint64_t vpn, int page_size, FILE* exec_file );
 
 }
 }
@@ -51,6 +51,7 @@ VanadisNodeOSComponent::VanadisNodeOSComponent(SST::ComponentId_t id, SST::Param
     m_osStartTimeNano = params.find<uint64_t>("osStartTimeNano",1000000000);
     m_processDebugLevel = params.find<uint32_t>("processDebugLevel",0);
     m_phdr_address = params.find<uint64_t>("program_header_address", 0x60000000);
+    m_fastPageLoad = params.find<bool>("fast_page_load", false);
 
     // MIPS default is 0x7fffffff according to SYS-V manual
     // we are using it for RISCV as well
@@ -186,6 +187,13 @@ VanadisNodeOSComponent::init(unsigned int phase) {
     mem_if->init(phase);
     if ( nullptr != m_mmu ) {
         m_mmu->init(phase);
+
+        // the untimed writes are queued by the interface until memory is ready for them
+        if ( 0 == phase && m_fastPageLoad ) {
+            for ( const auto kv : m_threadMap ) {
+                preloadElfImage( kv.second );
+            }
+        }
     }
 
     // do we need to check for this, really?
@@ -253,7 +261,10 @@ VanadisNodeOSComponent::startProcess( OS::HwThreadID& threadID, OS::ProcessInfo*
     int pid = process->getpid();
 
     if ( m_mmu ) {
-        m_mmu->initPageTable( pid );
+        // with fast_page_load the table was created when the image was preloaded during init
+        if ( ! m_fastPageLoad ) {
+            m_mmu->initPageTable( pid );
+        }
         m_mmu->setCoreToPageTable( threadID.core, threadID.hwThread, pid );
     }
 
@@ -305,7 +316,7 @@ void VanadisNodeOSComponent::writeMem( OS::ProcessInfo* process, uint64_t virtAd
         output->fatal(CALL_INFO, -1, "Error: ran out of physical memory\n");
     }
 
-    unsigned vpn = virtAddr >> m_pageShift; 
+    uint64_t vpn = virtAddr >> m_pageShift; 
 
     process->mapVirtToPage( vpn, page );
 
@@ -372,16 +383,16 @@ void VanadisNodeOSComponent::processSyscallPost( VanadisSyscall* syscall ) {
 void VanadisNodeOSComponent::processOsPageFault( VanadisSyscall* syscall, uint64_t virtAddr, bool isWrite ) {
     output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT, "virtAddr=%#" PRIx64 " isWrite=%d\n",virtAddr, isWrite);
 
-    uint32_t vpn = virtAddr >> m_pageShift;
+    uint64_t vpn = virtAddr >> m_pageShift;
     uint32_t faultPerms = isWrite ? 1 << 1:  1<< 2;
 
     pageFaultHandler2( -1, -1, -1, -1, syscall->getPid(), vpn, faultPerms, 0, virtAddr, syscall );    
 }
 
 void VanadisNodeOSComponent::pageFaultHandler2( MMU_Lib::RequestID reqId, unsigned link, unsigned core, unsigned hwThread, 
-                unsigned pid,  uint32_t vpn, uint32_t faultPerms, uint64_t instPtr, uint64_t memVirtAddr, VanadisSyscall* syscall ) 
+                unsigned pid,  uint64_t vpn, uint32_t faultPerms, uint64_t instPtr, uint64_t memVirtAddr, VanadisSyscall* syscall ) 
 {
-    output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT, "RequestID=%#" PRIx64 " link=%d pid=%d vpn=%d perms=%#x instPtr=%#" PRIx64 " syscall=%p\n",
+    output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT, "RequestID=%#" PRIx64 " link=%d pid=%d vpn=%" PRIu64 " perms=%#x instPtr=%#" PRIx64 " syscall=%p\n",
             reqId, link, pid, vpn, faultPerms, instPtr, syscall ); 
 
     auto tmp = new PageFault( reqId, link, core, hwThread, pid, vpn, faultPerms, instPtr, memVirtAddr, syscall );
@@ -395,7 +406,7 @@ void VanadisNodeOSComponent::pageFaultHandler2( MMU_Lib::RequestID reqId, unsign
 
 void VanadisNodeOSComponent::pageFaultFini( PageFault* info, bool success )
 {
-    output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT,"link=%d pid=%d vpn=%d %#" PRIx32 " %s\n",
+    output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT,"link=%d pid=%d vpn=%" PRIu64 " %#" PRIx64 " %s\n",
                 info->link,info->pid,info->vpn, info->vpn << m_pageShift, success ? "success":"fault" );
 
     if( info->syscall ) {
@@ -419,12 +430,12 @@ void VanadisNodeOSComponent::pageFault( PageFault *info )
     MMU_Lib::RequestID reqId = info->reqId;
     unsigned link = info->link;
     unsigned pid = info->pid;
-    uint32_t vpn = info->vpn;
+    uint64_t vpn = info->vpn;
     uint32_t faultPerms = info->faultPerms;
 
     assert(pid > 0);
     if ( m_threadMap.find(pid) == m_threadMap.end() ) {
-        output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT,"process %d is gone, wanted vpn=%d pass error back to CPU\n",pid,vpn);
+        output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT,"process %d is gone, wanted vpn=%" PRIu64 " pass error back to CPU\n",pid,vpn);
         pageFaultFini( info, false );
         return;
     }
@@ -445,7 +456,7 @@ void VanadisNodeOSComponent::pageFault( PageFault *info )
 
     if ( region ) { 
         // -1 indicates the vpn is not mapped to a physical page
-        uint32_t pagePerms = m_mmu->getPerms( pid, vpn);
+        int pagePerms = m_mmu->getPerms( pid, vpn);
 
         // We got here because a TLB has to have an address resolved.
         // There are two cases that can happen:
@@ -505,7 +516,7 @@ void VanadisNodeOSComponent::pageFault( PageFault *info )
         }
 
         int pageTablePerms =  m_mmu->getPerms( pid, vpn );
-        output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT,"vpn %d perms %#x\n",vpn,pageTablePerms);
+        output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT,"vpn %" PRIu64 " perms %#x\n",vpn,pageTablePerms);
         if ( pageTablePerms > -1 ) {
             if ( ! MMU_Lib::checkPerms( faultPerms, region->perms ) ) {
                 output->verbose(CALL_INFO, 1, 0,"core %d, hwThread %d, instPtr %#" PRIx64 " caused page fault at address %#" PRIx64 "\n", 
@@ -513,12 +524,13 @@ void VanadisNodeOSComponent::pageFault( PageFault *info )
                 pageFaultFini( info, false );
                 return;
             }
-            output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT,"using existing page vpn=%d\n",vpn);
+            output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT,"using existing page vpn=%" PRIu64 "\n",vpn);
             pageFaultFini( info );
             return;
         }
 
         OS::Page* page = nullptr;
+        bool neverUsed = false;
 
         uint8_t* data = nullptr;
         // if this region has backing 
@@ -529,7 +541,7 @@ void VanadisNodeOSComponent::pageFault( PageFault *info )
                 if ( nullptr == page ) {
                     data = readElfPage( output, region->backing->elfInfo, vpn, m_pageSize );
                 }  else {
-                    output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT,"found elf page vpn %d -> ppn %d\n",vpn, page->getPPN());
+                    output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT,"found elf page vpn %" PRIu64 " -> ppn %d\n",vpn, page->getPPN());
                 }
             } else if ( region->backing->dev ) {
                 // map this physical page into the MMU for this process 
@@ -556,6 +568,7 @@ void VanadisNodeOSComponent::pageFault( PageFault *info )
             output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT,"alloced physical page %d\n", page->getPPN() );
 
             thread->mapVirtToPage( vpn, page );
+            neverUsed = page->isNeverUsed();
         } else {
             page->incRefCnt();
             output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT,"using exiting physical page %d\n",page->getPPN());
@@ -565,16 +578,24 @@ void VanadisNodeOSComponent::pageFault( PageFault *info )
         m_mmu->map( thread->getpid(), vpn, page->getPPN(), m_pageSize, region->perms );
         
         // if there's elfInfo for this region is mapped to a file update the page cache 
-        if ( region->backing && region->backing->elfInfo && 0 == region->name.compare("text") ) {
+        if ( region->backing && region->backing->elfInfo && isSharedElfPage( region ) ) {
             if ( nullptr != data ) { 
                 updatePageCache( region->backing->elfInfo, vpn, page );
             } else {
-                output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT,"fault handled link=%d pid=%d vpn=%d %#" PRIx32 " ppn=%d\n",link,pid,vpn, vpn << m_pageShift,page->getPPN());
+                output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT,"fault handled link=%d pid=%d vpn=%" PRIu64 " %#" PRIx64 " ppn=%d\n",link,pid,vpn, vpn << m_pageShift,page->getPPN());
                 pageFaultFini( info );
                 return;
             }
         }
 
+        // a page no one has used is still zero in memory
+        if ( m_fastPageLoad && neverUsed && ( nullptr == data || isZeroPage( data, m_pageSize ) ) ) {
+            output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT,"zero page, never used, skip write\n");
+            delete[] data;
+            pageFaultFini( info );
+            return;
+        }
+
         auto callback = new Callback( [=]() {
             pageFaultFini( info );
         });
@@ -595,6 +616,89 @@ void VanadisNodeOSComponent::pageFault( PageFault *info )
     } 
 }
 
+// Maps and writes every page of the process's ELF image as untimed data, so
+// the program does not page fault its way through the image at startup.
+// Creates the process's page table, startProcess() relies on that.
+void VanadisNodeOSComponent::preloadElfImage( OS::ProcessInfo* process )
+{
+    VanadisELFInfo* elf_info = process->getElfInfo();
+    unsigned pid = process->getpid();
+
+    FILE* exec_file = fopen(elf_info->getBinaryPath(), "rb");
+    if ( nullptr == exec_file ) {
+        output->fatal(CALL_INFO, -1, "Error: unable to open %s\n", elf_info->getBinaryPath());
+    }
+
+    m_mmu->initPageTable( pid );
+
+    size_t numPages = 0;
+    size_t numWritten = 0;
+
+    for ( size_t i = 0; i < elf_info->countProgramHeaders(); ++i ) {
+        const VanadisELFProgramHeaderEntry* hdr = elf_info->getProgramHeader(i);
+        if ( PROG_HEADER_LOAD != hdr->getHeaderType() ) {
+            continue;
+        }
+
+        uint64_t virtAddrPage = hdr->getVirtualMemoryStart() & ~( (uint64_t) m_pageSize - 1 );
+        uint64_t virtAddrEnd = hdr->getVirtualMemoryStart() + hdr->getHeaderMemoryLength();
+
+        for ( ; virtAddrPage < virtAddrEnd; virtAddrPage += m_pageSize ) {
+            uint64_t vpn = virtAddrPage >> m_pageShift;
+
+            // a page shared with the previous segment
+            if ( m_mmu->getPerms( pid, vpn ) != -1 ) {
+                continue;
+            }
+
+            auto region = process->findMemRegion( virtAddrPage );
+            assert( region && region->backing && region->backing->elfInfo );
+
+            ++numPages;
+
+            bool shared = isSharedElfPage( region );
+            OS::Page* page = shared ? checkPageCache( elf_info, vpn ) : nullptr;
+            if ( page ) {
+                page->incRefCnt();
+                process->mapVirtToPage( vpn, page );
+                m_mmu->map( pid, vpn, page->getPPN(), m_pageSize, region->perms );
+                continue;
+            }
+
+            uint8_t* data = readElfPage( output, elf_info, vpn, m_pageSize, exec_file );
+
+            try {
+                page = allocPage( );
+            } catch ( int err ) {
+                output->fatal(CALL_INFO, -1, "Error: ran out of physical memory\n");
+            }
+
+            process->mapVirtToPage( vpn, page );
+            m_mmu->map( pid, vpn, page->getPPN(), m_pageSize, region->perms );
+
+            if ( shared ) {
+                updatePageCache( elf_info, vpn, page );
+            }
+
+            if ( ! page->isNeverUsed() || ! isZeroPage( data, m_pageSize ) ) {
+                std::vector<uint8_t> buffer( data, data + m_pageSize );
+                auto req = new StandardMem::Write( (uint64_t) page->getPPN() << m_pageShift, m_pageSize, buffer );
+                mem_if->sendUntimedData( req );
+                // the interface copies the payload into its own init event
+                delete req;
+                ++numWritten;
+            }
+
+            delete[] data;
+        }
+    }
+
+    fclose(exec_file);
+
+    output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_INIT, "pid %u: preloaded %zu pages of %s, %zu written to memory\n",
+        pid, numPages, elf_info->getBinaryPath(), numWritten );
+}
+
 bool VanadisNodeOSComponent::PageMemReadReq::handleResp( StandardMem::Request* ev ) {
     
     //printf("PageMemReadReq::%s()\n",__func__);
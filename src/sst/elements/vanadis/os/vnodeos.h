@@ -49,7 +49,8 @@ public:
     SST_ELI_DOCUMENT_PARAMS({ "verbose", "Set the output verbosity, 0 is no output, higher is more." },
                             { "cores", "Number of cores that can request OS services via a link." },
                             { "stdout", "File path to place stdout" }, { "stderr", "File path to place stderr" },
-                            { "stdin", "File path to place stdin" })
+                            { "stdin", "File path to place stdin" },
+                            { "fast_page_load", "Load program images into memory during init and skip writing zero pages which have never been used. Assumes memory starts out zeroed.", "0" })
 
     SST_ELI_DOCUMENT_PORTS({ "core%(cores)d", "Connects to a CPU core", {} })
 
@@ -111,7 +112,7 @@ private:
     };
 
     struct PageFault {
-        PageFault(MMU_Lib::RequestID reqId, unsigned link, unsigned core,unsigned hwThread, unsigned pid,  uint32_t vpn,
+        PageFault(MMU_Lib::RequestID reqId, unsigned link, unsigned core,unsigned hwThread, unsigned pid,  uint64_t vpn,
                             uint32_t faultPerms, uint64_t instPtr, uint64_t memVirtAddr, VanadisSyscall* syscall )
             : reqId(reqId), link(link), core(core), hwThread(hwThread), pid(pid), vpn(vpn), faultPerms(faultPerms),
                 instPtr(instPtr), memVirtAddr(memVirtAddr), syscall(syscall) {}
@@ -120,7 +121,7 @@ private:
         unsigned core;
         unsigned hwThread;
         unsigned pid;
-        uint32_t vpn;
+        uint64_t vpn;
         uint32_t faultPerms;
         uint64_t instPtr;
         uint64_t memVirtAddr;
@@ -143,13 +144,13 @@ private:
     void processOsPageFault( VanadisSyscall*, uint64_t virtAddr, bool isWrite );
 
     void pageFaultHandler( MMU_Lib::RequestID reqId, unsigned link, unsigned core, unsigned hwThread, unsigned pid,
-        uint32_t vpn, uint32_t perms, uint64_t instPtr, uint64_t memVirtAddr ) 
+        uint64_t vpn, uint32_t perms, uint64_t instPtr, uint64_t memVirtAddr ) 
     {
         pageFaultHandler2( reqId, link, core, hwThread, pid, vpn, perms, instPtr, memVirtAddr ); 
     }
 
     void pageFaultHandler2( MMU_Lib::RequestID, unsigned link, unsigned core, unsigned hwThread,  unsigned pid,
-        uint32_t vpn, uint32_t perms, uint64_t instPtr, uint64_t memVirtAddr, VanadisSyscall* syscall = nullptr );
+        uint64_t vpn, uint32_t perms, uint64_t instPtr, uint64_t memVirtAddr, VanadisSyscall* syscall = nullptr );
 
     void pageFault( PageFault* );
     void pageFaultFini( PageFault*, bool success = true );
@@ -197,10 +198,10 @@ private:
         processSyscallPost( syscall ); 
     }
 
-    OS::Page* checkPageCache( VanadisELFInfo* elf_info , int vpn ) {
+    OS::Page* checkPageCache( VanadisELFInfo* elf_info , uint64_t vpn ) {
         auto iter = m_elfPageCache.find( elf_info ); 
         if ( iter != m_elfPageCache.end() ) {
-            auto tmp = iter->second; 
+            auto& tmp = iter->second; 
             auto iter2 = tmp.find(vpn);
             if ( iter2 != tmp.end() ) {
                 return iter2->second;
@@ -209,10 +210,27 @@ private:
         return nullptr;
     } 
 
-    void updatePageCache( VanadisELFInfo* elf_info , int vpn, OS::Page* page ) {
+    void updatePageCache( VanadisELFInfo* elf_info , uint64_t vpn, OS::Page* page ) {
         m_elfPageCache[elf_info][vpn] = page;
     } 
 
+    // text is shared between processes running the same executable, with fast_page_load
+    // so is every other read-only page of it
+    bool isSharedElfPage( OS::MemoryRegion* region ) {
+        return 0 == region->name.compare("text") || ( m_fastPageLoad && 0 == ( region->perms & 0x2 ) );
+    }
+
+    static bool isZeroPage( const uint8_t* data, unsigned page_size ) {
+        for ( unsigned i = 0; i < page_size; i++ ) {
+            if ( data[i] ) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void preloadElfImage( OS::ProcessInfo* );
+
     void writeMem( OS::ProcessInfo*, uint64_t virtAddr, std::vector<uint8_t>* data, int perms, unsigned pageSize, Callback* callback );
 
     template<typename T>
@@ -341,13 +359,14 @@ private:
     uint64_t                    m_stack_top;
     int                         m_nodeNum;
     uint64_t                    m_osStartTimeNano;
+    bool                        m_fastPageLoad;
 
     std::queue<PageFault*>                          m_pendingFault;
     std::map<std::string, VanadisELFInfo* >         m_elfMap; 
     std::unordered_map<uint32_t,OS::ProcessInfo*>   m_threadMap;
     std::queue<PageMemReq*>                         m_blockMemoryWriteReqQ;
 
-    std::map< VanadisELFInfo*, std::map<int,OS::Page*> >            m_elfPageCache;
+    std::map< VanadisELFInfo*, std::map<uint64_t,OS::Page*> >            m_elfPageCache;
     std::unordered_map<StandardMem::Request::id_t, VanadisSyscall*> m_memRespMap;
 
     std::queue< OS::HwThreadID* > m_availHwThreads;
@@ -75,7 +75,7 @@ class PhysMemManager {
 
     typedef std::vector<uint32_t> PageList;
     enum PageSize { FourKB, TwoMB, OneGB }; 
-    PhysMemManager( size_t memSize ) : m_bitMap( memSize/4096), m_numAllocated(0) { }
+    PhysMemManager( size_t memSize ) : m_bitMap( memSize/4096), m_usedBitMap( memSize/4096 ), m_numAllocated(0) { }
     ~PhysMemManager() {
         if ( m_numAllocated > 1 ) { 
             printf("%s() numAllocated=%" PRIu64 "\n",__func__,m_numAllocated);
@@ -93,6 +93,15 @@ class PhysMemManager {
         return findFreePage( pageSize );
     }
 
+    // neverUsed is set if the page has not been handed out before, so it
+    // still holds whatever the memory was initialized with
+    uint32_t allocPage( PageSize pageSize, bool& neverUsed ) {
+        uint32_t page = findFreePage( pageSize );
+        neverUsed = ! m_usedBitMap.getBit( page );
+        m_usedBitMap.setBit( page );
+        return page;
+    }
+
 
     void freePages( PageSize pageSize, PageList& pagesIn ) { 
         for ( size_t i = 0; i < pagesIn.size(); i++ ) {
@@ -152,6 +161,8 @@ class PhysMemManager {
     }
 
     BitMap m_bitMap;
+    // pages which have ever been allocated
+    BitMap m_usedBitMap;
     uint64_t m_numAllocated;
 };
 
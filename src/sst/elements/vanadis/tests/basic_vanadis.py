@@ -64,6 +64,8 @@ verbosity = int(os.getenv("VANADIS_VERBOSE", 0))
 os_verbosity = os.getenv("VANADIS_OS_VERBOSE", verbosity)
 pipe_trace_file = os.getenv("VANADIS_PIPE_TRACE", "")
 lsq_entries = os.getenv("VANADIS_LSQ_ENTRIES", 32)
+fast_page_load = os.getenv("VANADIS_FAST_PAGE_LOAD", 0)
+lsq_type = "vanadis." + os.getenv("VANADIS_LSQ_TYPE", "VanadisBasicLoadStoreQueue")
 
 rob_slots = os.getenv("VANADIS_ROB_SLOTS", 64)
 retires_per_cycle = os.getenv("VANADIS_RETIRES_PER_CYCLE", 4)
@@ -130,6 +132,7 @@ osParams = {
     "heap_verbose" : verbosity,
     "physMemSize" : physMemSize,
     "useMMU" : True,
+    "fast_page_load" : fast_page_load,
 }
 
 
@@ -350,7 +353,7 @@ class CPU_Builder:
             branch_pred.enableAllStatistics()
 
         # CPU.lsq
-        cpu_lsq = cpu.setSubComponent( "lsq", "vanadis.VanadisBasicLoadStoreQueue" )
+        cpu_lsq = cpu.setSubComponent( "lsq", lsq_type )
         cpu_lsq.addParams(lsqParams)
         cpu_lsq.enableAllStatistics()
 
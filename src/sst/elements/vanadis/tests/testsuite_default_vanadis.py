@@ -9,6 +9,14 @@ module_init = 0
 module_sema = threading.Semaphore()
 vanadis_test_matrix = []
 
+# Configuration variants run against the same program output gold files as
+# the default configuration.  Timing differs, so the SST statistics are not
+# compared.  Each variant sets environment variables read by the sdl file.
+vanadis_variants = {
+    "fastpageload" : { "VANADIS_FAST_PAGE_LOAD" : "1" },
+    "ooolsq" : { "VANADIS_LSQ_TYPE" : "VanadisOutOfOrderLoadStoreQueue" },
+}
+
 MakeTests = False
 #MakeTests = True
 updateFiles = False
@@ -72,6 +80,19 @@ def build_vanadis_test_matrix():
             testlist.append(["basic_vanadis.py", location, test,arch, 1,4, "4thread", 300])
             testlist.append(["basic_vanadis.py", location, test,arch, 2,2, "2core-2thread", 300])
 
+    variant_tests = [ ["small/basic-io","hello-world",1,1,""], ["small/basic-io","read-write",1,1,""],
+                      ["small/misc","splitLoad",1,1,""], ["small/misc","fork",2,1,"gold1"] ]
+    for location, test, cores, threads, gold in variant_tests:
+        for arch in arch_list:
+            testlist.append(["basic_vanadis.py", location, test, arch, cores, threads, gold, 300, "fastpageload"])
+
+    variant_tests = [ ["small/basic-io","hello-world"], ["small/basic-io","printf-check"], ["small/basic-io","read-write"],
+                      ["small/basic-math","sqrt-double"], ["small/basic-ops","test-branch"], ["small/basic-ops","test-shift"],
+                      ["small/misc","splitLoad"] ]
+    for location, test in variant_tests:
+        for arch in arch_list:
+            testlist.append(["basic_vanadis.py", location, test, arch, 1, 1, "", 300, "ooolsq"])
+
 
     # Process each line and crack up into an index, hash, options and sdl file
     for testnum, test_info in enumerate(testlist):
@@ -85,10 +106,13 @@ def build_vanadis_test_matrix():
         numHwThreads = test_info[5]
         goldfiledir = test_info[6]
         timeout_sec = test_info[7]
+        variant = test_info[8] if len(test_info) > 8 else ""
         testname = "{0}_{1}_{2}_{3}".format(elftestdir.replace("/", "_"), elffile,isa,goldfiledir)
+        if len(variant):
+            testname = "{0}_{1}".format(testname, variant)
 
         # Build the test_data structure
-        test_data = (testnum, testname, sdlfile, elftestdir, elffile, isa, numCores, numHwThreads, goldfiledir, timeout_sec )
+        test_data = (testnum, testname, sdlfile, elftestdir, elffile, isa, numCores, numHwThreads, goldfiledir, timeout_sec, variant )
         vanadis_test_matrix.append(test_data)
 
 ################################################################################
@@ -144,20 +168,22 @@ class testcase_vanadis(SSTTestCase):
 #####
 
     @parameterized.expand(vanadis_test_matrix, name_func=gen_custom_name)
-    def test_vanadis_short_tests(self, testnum, testname, sdlfile, elftestdir, elffile, isa, numCores, numHwThreads, goldfiledir, timeout_sec):
+    def test_vanadis_short_tests(self, testnum, testname, sdlfile, elftestdir, elffile, isa, numCores, numHwThreads, goldfiledir, timeout_sec, variant):
         self._checkSkipConditions( isa )
 
         if MakeTests:
             self.makeTest( testname, isa, elftestdir, elffile )
         log_debug("Running Vanadis test #{0} ({1}): elffile={4} in dir {3}, isa {5}; using sdl={2}".format(testnum, testname, sdlfile, elftestdir, elffile, isa, timeout_sec))
-        self.vanadis_test_template(testnum, testname, sdlfile, elftestdir, elffile, isa, numCores, numHwThreads, goldfiledir, timeout_sec )
+        self.vanadis_test_template(testnum, testname, sdlfile, elftestdir, elffile, isa, numCores, numHwThreads, goldfiledir, timeout_sec, variant )
 
 #####
 
-    def vanadis_test_template(self, testnum, testname, sdlfile, elftestdir, elffile, isa, numCores, numHwThreads, goldfiledir, testtimeout=120):
+    def vanadis_test_template(self, testnum, testname, sdlfile, elftestdir, elffile, isa, numCores, numHwThreads, goldfiledir, testtimeout=120, variant=""):
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
         outdir = "{0}/vanadis_tests/{1}/{2}/{3}/{4}".format(self.get_test_output_run_dir(), elftestdir,elffile,isa,goldfiledir)
+        if len(variant):
+            outdir = "{0}/{1}".format(outdir, variant)
         tmpdir = self.get_test_output_tmp_dir()
         os.makedirs(outdir)
 
@@ -190,6 +216,12 @@ class testcase_vanadis(SSTTestCase):
         os.environ['VANADIS_NUM_CORES'] = str(numCores)
         os.environ['VANADIS_NUM_HW_THREADS'] = str(numHwThreads)
 
+        for name, env in vanadis_variants.items():
+            for key in env:
+                os.environ.pop(key, None)
+        if len(variant):
+            os.environ.update(vanadis_variants[variant])
+
         testfile_exists = os.path.exists(testfilepath) and os.path.isfile(testfilepath)
         self.assertTrue(testfile_exists, "Vanadis test {0} does not exist".format(testfilepath))
 
@@ -206,7 +238,7 @@ class testcase_vanadis(SSTTestCase):
         self.assertTrue(os_outfileexists, "Vanadis test outfile-os not found in directory {0}".format(outdir))
         self.assertTrue(os_errfileexists, "Vanadis test errfile-os not found in directory {0}".format(outdir))
 
-        if ( os.path.exists( ref_sst_outfile ) ):
+        if ( os.path.exists( ref_sst_outfile ) and not len(variant) ):
             cmp_result = testing_compare_filtered_diff(testname, sst_outfile, ref_sst_outfile ,filters=[StartsWithFilter(" v0.instructions_issued.1")])
             if (cmp_result == False):
                 diffdata = testing_get_diff_data(testname)
@@ -24,6 +24,7 @@
 #include "inst/vinst.h"
 #include "lsq/vlsq.h"
 #include "lsq/vbasiclsq.h"
+#include "lsq/vooolsq.h"
 #include "velf/velfinfo.h"
 #include "vfpflags.h"
 #include "vfuncunit.h"
@@ -15,6 +15,12 @@
 
 #include <sst_config.h>
 
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
 #include "siriusreader.h"
 
 using namespace std;
@@ -31,6 +37,72 @@ using namespace SST::Zodiac;
 #pragma clang diagnostic ignored "-Wunused-variable"
 #endif
 
+// Amount of the trace to request ahead of the read position
+#define SIRIUS_READAHEAD_BYTES (4 * 1024 * 1024)
+
+std::map<std::string, SiriusTraceMap*> SiriusTraceMap::openMaps;
+std::mutex SiriusTraceMap::openMapsLock;
+
+SiriusTraceMap::SiriusTraceMap(const std::string& file, const char* d, size_t len) :
+	fileName(file), data(d), length(len), refCount(1) {}
+
+SiriusTraceMap* SiriusTraceMap::acquire(const char* file) {
+	std::lock_guard<std::mutex> lock(openMapsLock);
+
+	std::map<std::string, SiriusTraceMap*>::iterator existing = openMaps.find(file);
+	if(existing != openMaps.end()) {
+		existing->second->refCount++;
+		return existing->second;
+	}
+
+	int fd = open(file, O_RDONLY);
+	if(fd < 0) {
+		return NULL;
+	}
+
+	struct stat info;
+	if(fstat(fd, &info) != 0 || info.st_size == 0) {
+		::close(fd);
+		return NULL;
+	}
+
+	void* mapped = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+
+	if(MAP_FAILED == mapped) {
+		return NULL;
+	}
+
+	madvise(mapped, info.st_size, MADV_SEQUENTIAL);
+
+	SiriusTraceMap* traceMap = new SiriusTraceMap(file, (const char*) mapped, info.st_size);
+	openMaps[file] = traceMap;
+	return traceMap;
+}
+
+void SiriusTraceMap::release() {
+	std::lock_guard<std::mutex> lock(openMapsLock);
+
+	if(--refCount > 0) {
+		return;
+	}
+
+	openMaps.erase(fileName);
+	munmap((void*) data, length);
+	delete this;
+}
+
+void SiriusTraceMap::willNeed(const char* from, size_t bytes) {
+	// madvise needs a page aligned start address
+	const uintptr_t pageMask = ~((uintptr_t) sysconf(_SC_PAGESIZE) - 1);
+	const char* start = (const char*) (((uintptr_t) from) & pageMask);
+
+	if(from + bytes > end()) {
+		bytes = end() - from;
+	}
+
+	madvise((void*) start, (from - start) + bytes, MADV_WILLNEED);
+}
 
 SiriusReader::SiriusReader(char* file, uint32_t focusOnRank, uint32_t maxQLen, std::queue<ZodiacEvent*>* evQ, int verbose)
 {
@@ -40,12 +112,16 @@ SiriusReader::SiriusReader(char* file, uint32_t focusOnRank, uint32_t maxQLen, s
 	qLimit = maxQLen;
 	foundFinalize = false;
 
-	trace = fopen(file, "rb");
+	trace = SiriusTraceMap::acquire(file);
 	if(NULL == trace) {
 		std::cerr << "Error opening the Sirius trace file: " << file << std::endl;
 		exit(-1);
 	}
 
+	tracePos = trace->begin();
+	traceEnd = trace->end();
+	adviseEnd = tracePos;
+
 	prevEventTime = 0;
 	output = new Output("SiriusReader", verbose, 0, Output::STDOUT);
 	readInit();
@@ -58,12 +134,39 @@ void SiriusReader::close() {
 		output->verbose(CALL_INFO, 4, 0, "Closing trace file.\n");
 	}
 
-	fclose(trace);
+	trace->release();
+	trace = NULL;
+
+	for(int i = 0; i <= Z_WAIT; i++) {
+		for(size_t j = 0; j < freeEvents[i].size(); j++) {
+			delete freeEvents[i][j];
+		}
+		freeEvents[i].clear();
+	}
+}
+
+void SiriusReader::recycle(ZodiacEvent* ev) {
+	std::vector<ZodiacEvent*>& pool = freeEvents[ev->getEventType()];
+
+	if(pool.size() < qLimit) {
+		pool.push_back(ev);
+	} else {
+		delete ev;
+	}
 }
 
 uint32_t SiriusReader::generateNextEvents() {
 //	int finalized_reached = 0;
 
+	if(adviseEnd < tracePos) {
+		adviseEnd = tracePos;
+	}
+
+	if(adviseEnd < traceEnd && (adviseEnd - tracePos) < (SIRIUS_READAHEAD_BYTES / 2)) {
+		trace->willNeed(adviseEnd, SIRIUS_READAHEAD_BYTES);
+		adviseEnd += SIRIUS_READAHEAD_BYTES;
+	}
+
 	while((foundFinalize == false) && (eventQ->size() < qLimit)) {
 		generateNextEvent();
 	}
@@ -86,7 +189,7 @@ void SiriusReader::generateNextEvent() {
 
 	if(evTimeDiff > 0) {
 		output->verbose(__LINE__, __FILE__, "generateNextEvent", 8, 0, "Generated a compute event (length=%f)\n", evTimeDiff);
-		ZodiacComputeEvent* ev = new ZodiacComputeEvent(evTimeDiff);
+		ZodiacComputeEvent* ev = makeEvent<ZodiacComputeEvent>(Z_COMPUTE, evTimeDiff);
 		eventQ->push(ev);
 	} else {
 		output->verbose(__LINE__, __FILE__, "generateNextEvent", 8, 0,
@@ -129,7 +232,7 @@ void SiriusReader::generateNextEvent() {
 
 	default:
 		std::cout << "Unknown MPI command in trace (" << call_type << ") position: " <<
-			ftell(trace) << std::endl;
+			(tracePos - trace->begin()) << std::endl;
 		exit(-1);
 		break;
 	}
@@ -151,7 +254,7 @@ void SiriusReader::readAllreduce() {
 
 	output->verbose(__LINE__, __FILE__, "readAllreduce", 8, 0, "Read an MPI_Allreduce\n");
 
-	ZodiacAllreduceEvent* ev = new ZodiacAllreduceEvent(
+	ZodiacAllreduceEvent* ev = makeEvent<ZodiacAllreduceEvent>(Z_ALLREDUCE,
 			length,
 			convertToHermesType(dtype),
 			convertToHermesOp(op),
@@ -169,7 +272,7 @@ void SiriusReader::readSend() {
 
 	output->verbose(__LINE__, __FILE__, "readSend", 8, 0, "Read an MPI_Send\n");
 
-	ZodiacSendEvent* ev = new ZodiacSendEvent((uint32_t) dest, count,
+	ZodiacSendEvent* ev = makeEvent<ZodiacSendEvent>(Z_SEND, (uint32_t) dest, count,
 		convertToHermesType(dtype), tag, comm);
 	eventQ->push(ev);
 }
@@ -184,7 +287,7 @@ void SiriusReader::readRecv() {
 
 	output->verbose(__LINE__, __FILE__, "readRecv", 8, 0, "Read an MPI_Recv\n");
 
-	ZodiacRecvEvent* ev = new ZodiacRecvEvent((uint32_t) src, count,
+	ZodiacRecvEvent* ev = makeEvent<ZodiacRecvEvent>(Z_RECV, (uint32_t) src, count,
 		convertToHermesType(dtype), tag, comm);
 	eventQ->push(ev);
 }
@@ -200,7 +303,7 @@ void SiriusReader::readIrecv() {
 
 	output->verbose(__LINE__, __FILE__, "readIrecv", 8, 0, "Read an MPI_Irecv\n");
 
-	ZodiacIRecvEvent* ev = new ZodiacIRecvEvent((uint32_t) src, count,
+	ZodiacIRecvEvent* ev = makeEvent<ZodiacIRecvEvent>(Z_IRECV, (uint32_t) src, count,
 		convertToHermesType(dtype), tag, comm, req);
 	eventQ->push(ev);
 }
@@ -211,20 +314,20 @@ void SiriusReader::readWait() {
 
 	output->verbose(__LINE__, __FILE__, "readWait", 8, 0, "Read an MPI_Wait\n");
 
-	ZodiacWaitEvent* ev = new ZodiacWaitEvent(reqID);
+	ZodiacWaitEvent* ev = makeEvent<ZodiacWaitEvent>(Z_WAIT, reqID);
 	eventQ->push(ev);
 }
 
 void SiriusReader::readInit() {
 	output->verbose(__LINE__, __FILE__, "readInit", 8, 0, "Read an MPI_Init\n");
-	ZodiacInitEvent* ev = new ZodiacInitEvent();
+	ZodiacInitEvent* ev = makeEvent<ZodiacInitEvent>(Z_INIT);
 	eventQ->push(ev);
 }
 
 void SiriusReader::readFinalize() {
 	output->verbose(__LINE__, __FILE__, "readFinalize", 8, 0, "Read an MPI_Finalize\n");
 
-	ZodiacFinalizeEvent* ev = new ZodiacFinalizeEvent();
+	ZodiacFinalizeEvent* ev = makeEvent<ZodiacFinalizeEvent>(Z_FINALIZE);
 	eventQ->push(ev);
 
 	foundFinalize = true;
@@ -235,38 +338,41 @@ void SiriusReader::readBarrier() {
 
 	output->verbose(__LINE__, __FILE__, "readRecv", 8, 0, "Read an MPI_Barrier\n");
 
-	ZodiacBarrierEvent* ev = new ZodiacBarrierEvent(comm);
+	ZodiacBarrierEvent* ev = makeEvent<ZodiacBarrierEvent>(Z_BARRIER, comm);
 	eventQ->push(ev);
 }
 
-uint32_t SiriusReader::readUINT32() {
-	uint32_t temp;
-	fread(&temp, 1, sizeof(uint32_t), trace);
+template<class T>
+T SiriusReader::readValue() {
+	if((size_t) (traceEnd - tracePos) < sizeof(T)) {
+		output->fatal(CALL_INFO, -1, "Error: unexpected end of Sirius trace for rank %" PRIu32 "\n", rank);
+	}
+
+	// Records are packed so fields may be unaligned
+	T temp;
+	memcpy(&temp, tracePos, sizeof(T));
+	tracePos += sizeof(T);
 	return temp;
 }
 
+uint32_t SiriusReader::readUINT32() {
+	return readValue<uint32_t>();
+}
+
 uint64_t SiriusReader::readUINT64() {
-	uint64_t temp;
-	fread(&temp, 1, sizeof(uint64_t), trace);
-	return temp;
+	return readValue<uint64_t>();
 }
 
 double SiriusReader::readTime() {
-	double temp;
-	fread(&temp, 1, sizeof(double), trace);
-	return temp;
+	return readValue<double>();
 }
 
 int32_t SiriusReader::readINT32() {
-	int32_t temp;
-	fread(&temp, 1, sizeof(int32_t), trace);
-	return temp;
+	return readValue<int32_t>();
 }
 
 int64_t SiriusReader::readINT64() {
-	int64_t temp;
-	fread(&temp, 1, sizeof(int64_t), trace);
-	return temp;
+	return readValue<int64_t>();
 }
 
 PayloadDataType SiriusReader::convertToHermesType(uint32_t dtype) {
@@ -24,7 +24,11 @@
 
 #include <string>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <new>
 #include <queue>
+#include <vector>
 
 #include "sst/core/output.h"
 #include "sst/elements/hermes/msgapi.h"
@@ -49,6 +53,31 @@ using namespace SST::Hermes::MP;
 namespace SST {
 namespace Zodiac {
 
+/*
+ * Read-only mapping of a trace file. Readers which open the same file
+ * within one SST process share a single mapping.
+ */
+class SiriusTraceMap {
+    public:
+	static SiriusTraceMap* acquire(const char* file);
+	void release();
+
+	const char* begin() { return data; }
+	const char* end() { return data + length; }
+	void willNeed(const char* from, size_t bytes);
+
+    private:
+	SiriusTraceMap(const std::string& file, const char* data, size_t length);
+
+	std::string fileName;
+	const char* data;
+	size_t length;
+	uint32_t refCount;
+
+	static std::map<std::string, SiriusTraceMap*> openMaps;
+	static std::mutex openMapsLock;
+};
+
 class SiriusReader {
     public:
 	SiriusReader(char* file, uint32_t rank, uint32_t qLimit, std::queue<ZodiacEvent*>* eventQueue, int verbose);
@@ -58,6 +87,7 @@ class SiriusReader {
 	uint32_t getQueueLimit();
 	uint32_t getCurrentQueueSize();
 	bool hasReachedFinalize();
+	void recycle(ZodiacEvent* ev);
 
     private:
 	Output* output;
@@ -65,8 +95,29 @@ class SiriusReader {
 	uint32_t qLimit;
 	bool foundFinalize;
 	std::queue<ZodiacEvent*>* eventQ;
-	FILE* trace;
+	SiriusTraceMap* trace;
+	const char* tracePos;
+	const char* traceEnd;
+	const char* adviseEnd;
 	double prevEventTime;
+	std::vector<ZodiacEvent*> freeEvents[Z_WAIT + 1];
+
+	// Reuse a handled event of the same type if one is available
+	template<class T, class... Args>
+	T* makeEvent(ZodiacEventType type, Args... args) {
+		std::vector<ZodiacEvent*>& pool = freeEvents[type];
+		if(pool.empty()) {
+			return new T(args...);
+		}
+
+		T* ev = static_cast<T*>(pool.back());
+		pool.pop_back();
+		ev->~T();
+		return new (ev) T(args...);
+	}
+
+	template<class T>
+	inline T readValue();
 	void generateNextEvent();
 	inline uint32_t readUINT32();
 	inline uint64_t readUINT64();
@@ -264,10 +264,10 @@ void ZodiacSiriusTraceReader::handleSelfEvent(Event* ev)
 	}
 
 	zOut.verbose(__LINE__, __FILE__, "handleSelfEvent", 0, 16,
-		"Attempting to delete processed event...");
-	delete zEv;
+		"Attempting to recycle processed event...");
+	trace->recycle(zEv);
 	zOut.verbose(__LINE__, __FILE__, "handleSelfEvent", 0, 16,
-		"Successfully deleted event.");
+		"Successfully recycled event.");
 
 	zOut.verbose(__LINE__, __FILE__, "handleSelfEvent",
 		3, 1, "Finished event processing cycle.\n");